@@ -31,7 +31,7 @@ else
 		chmod 755 bin/msobkow/2.0.13/testcflib
 		mkdir lib
 		chmod 755 lib
-		cp /usr/lib/libcflib.la /usr/lib/libcflib.so.2.0.13 lib
+		cp /usr/lib/libcflib.la /usr/lib/libcflib.so.3.0.0 lib
 		chmod 755 lib/*.so.*
 		chmod 644 lib/*.la
 		strip bin/msobkow/2.0.13/*cf* lib/*.so.*
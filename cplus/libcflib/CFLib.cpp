@@ -25,8 +25,11 @@
  */
 
 #include <sys/stat.h>
+#include <time.h>
 #include <iostream>
 #include <fstream>
+#include <mutex>
+#include <unordered_map>
 
 #include <cflib/CFLib.hpp>
 #include <cflib/CFLibNotSupportedException.hpp>
@@ -86,6 +89,9 @@ namespace cflib {
 
 	const std::string CFLib::S_MsgInitMustBeCalledFirst( "cflib::CFLib::init() must be called first" );
 
+	const int CFLib::CLOCK_PRECISE = 0;
+	const int CFLib::CLOCK_COARSE = 1;
+
 	bool CFLib::initialized = false;
 
 	CFLib::CFLib() {
@@ -267,62 +273,198 @@ namespace cflib {
 		std::cout << S_CtrlG;
 	}
 
-	/* Look for tag=someValue within filename.	When found, return someValue
-	 * in the provided value parameter up to valueSize in length.	If someValue
-	 * is enclosed in quotes, remove them. */
-	char* CFLib::getValue( const char *filename, const char *tag, char *value, std::string::size_type valueSize)
-	{
-		char buffer[128], *lasts;
-		int foundTag = 0;
+	namespace {
+
+	/**
+	 *	The parsed tag=value pairs of each file passed to getValue(), so
+	 *	a lookup is usually just a hash probe instead of a scan of the file.
+	 *	A cached file is checked with stat() at most once per
+	 *	STAT_RECHECK_MILLIS, outside the lock, and parsed again when its
+	 *	device, inode, size, or nanosecond modification or change time
+	 *	differs.  At most MAX_FILES files are kept; the least recently used
+	 *	one is dropped to make room.
+	 */
+	class CFLibConfigFileCache {
+	public:
+		static const int64_t STAT_RECHECK_MILLIS;
+		static const size_t MAX_FILES;
+
+		class CFLibConfigFile {
+		public:
+			dev_t dev;
+			ino_t ino;
+			off_t size;
+			struct timespec mtim;
+			struct timespec ctim;
+			std::chrono::steady_clock::time_point checked;
+			uint64_t lastUsed;
+			std::unordered_map<std::string, std::string> values;
+
+			bool isSameFile( const struct stat& fileStat ) const {
+				return( ( dev == fileStat.st_dev )
+					&& ( ino == fileStat.st_ino )
+					&& ( size == fileStat.st_size )
+					&& ( mtim.tv_sec == fileStat.st_mtim.tv_sec )
+					&& ( mtim.tv_nsec == fileStat.st_mtim.tv_nsec )
+					&& ( ctim.tv_sec == fileStat.st_ctim.tv_sec )
+					&& ( ctim.tv_nsec == fileStat.st_ctim.tv_nsec ) );
+			}
+		};
+
+		std::mutex lock;
+		std::unordered_map<std::string, CFLibConfigFile> files;
+		uint64_t useCount = 0;
+
+		/* Parse a file the way getValue() always has: a tag runs up to the
+		 * first '=', the value is the first whitespace-delimited word after
+		 * it with quotes removed, and the first line for a tag wins. */
+		static void parse( std::istream& in, std::unordered_map<std::string, std::string>& values ) {
+			std::string line;
+			while( std::getline( in, line ) ) {
+				std::string::size_type tagBegin = line.find_first_not_of( '=' );
+				if( tagBegin == std::string::npos ) {
+					continue;
+				}
+				std::string::size_type tagEnd = line.find( '=', tagBegin );
+				if( tagEnd == std::string::npos ) {
+					continue;
+				}
+				std::string tag( line, tagBegin, tagEnd - tagBegin );
+				std::string value;
+				std::string::size_type valueBegin = line.find_first_not_of( " \t\n", tagEnd + 1 );
+				if( valueBegin != std::string::npos ) {
+					std::string::size_type valueEnd = line.find_first_of( " \t\n", valueBegin );
+					if( valueEnd == std::string::npos ) {
+						valueEnd = line.length();
+					}
+					char quote = 0x00;
+					for( std::string::size_type i = valueBegin; i < valueEnd; i++ ) {
+						char ch = line[i];
+						if( ( quote == 0x00 ) && ( ch == '"' ) ) {
+							quote = ch;
+						}
+						else if( ( quote != 0x00 ) && ( quote == ch ) ) {
+							quote = 0x00;
+						}
+						else {
+							value.push_back( ch );
+						}
+					}
+				}
+				// An empty value still claims the tag, so later lines can't
+				// supply it; getValue() reports such a tag as not found
+				values.emplace( std::move( tag ), std::move( value ) );
+			}
+		}
 
-		FILE *fd = fopen(filename, "r");
-		if (fd)
-		{
-			/* Process the file, line by line. */
-			while (fgets(buffer, sizeof(buffer), fd))
+		bool lookup( const std::string& filename, const std::string& tag, std::string& value ) {
+			std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
 			{
-				lasts = buffer;
-				/* Look for lines with tag=value. */
-				char *token = strtok_r(lasts, "=", &lasts);
-				/* Is this the tag we are looking for? */
-				if (token && !strcmp(token, tag))
+				std::lock_guard<std::mutex> guard( lock );
+				auto found = files.find( filename );
+				if( ( found != files.end() )
+					&& ( ( now - found->second.checked ) < std::chrono::milliseconds( STAT_RECHECK_MILLIS ) ) )
 				{
-					/* Parse out the value. */
-					char *zone = strtok_r(lasts, " \t\n", &lasts);
-					/* If everything looks good, copy it to our return var. */
-					if (zone && strlen(zone) > 0)
-					{
-						std::string::size_type i = 0;
-						std::string::size_type j = 0;
-						char quote = 0x00;
-						std::string::size_type len = strlen( zone );
-						/* Rather than just simple copy, remove quotes while we copy. */
-						for (i = 0; i < len && i < valueSize - 1; i++)
-						{
-							/* Start quote. */
-							if (quote == 0x00 && zone[i] == '"')
-								quote = zone[i];
-							/* End quote. */
-							else if (quote != 0x00 && quote == zone[i])
-								quote = 0x00;
-							/* Copy bytes. */
-							else
-							{
-								value[j] = zone[i];
-								j++;
-							}
+					return( findValue( found->second, tag, value ) );
+				}
+			}
+
+			// Recheck the file without holding up lookups of other files
+			struct stat fileStat;
+			if( stat( filename.c_str(), &fileStat ) != 0 ) {
+				std::lock_guard<std::mutex> guard( lock );
+				files.erase( filename );
+				return( false );
+			}
+			{
+				std::lock_guard<std::mutex> guard( lock );
+				auto found = files.find( filename );
+				if( ( found != files.end() ) && found->second.isSameFile( fileStat ) ) {
+					found->second.checked = now;
+					return( findValue( found->second, tag, value ) );
+				}
+			}
+
+			// The file is new or changed, so parse it outside the lock too.
+			// The identity recorded is from before the read, so a change made
+			// during the read is caught by the next check.
+			CFLibConfigFile parsed;
+			parsed.dev = fileStat.st_dev;
+			parsed.ino = fileStat.st_ino;
+			parsed.size = fileStat.st_size;
+			parsed.mtim = fileStat.st_mtim;
+			parsed.ctim = fileStat.st_ctim;
+			parsed.checked = now;
+			std::ifstream in( filename );
+			if( ! in.is_open() ) {
+				std::lock_guard<std::mutex> guard( lock );
+				files.erase( filename );
+				return( false );
+			}
+			parse( in, parsed.values );
+
+			std::lock_guard<std::mutex> guard( lock );
+			auto found = files.find( filename );
+			if( found == files.end() ) {
+				if( files.size() >= MAX_FILES ) {
+					auto oldest = files.begin();
+					for( auto candidate = files.begin(); candidate != files.end(); candidate++ ) {
+						if( candidate->second.lastUsed < oldest->second.lastUsed ) {
+							oldest = candidate;
 						}
-						value[j] = 0x00;
-						foundTag = 1;
 					}
-					break;
+					files.erase( oldest );
 				}
+				found = files.emplace( filename, std::move( parsed ) ).first;
+			}
+			else {
+				found->second = std::move( parsed );
+			}
+			return( findValue( found->second, tag, value ) );
+		}
+
+		/* Called with lock held. */
+		bool findValue( CFLibConfigFile& file, const std::string& tag, std::string& value ) {
+			file.lastUsed = ++useCount;
+			auto foundValue = file.values.find( tag );
+			if( ( foundValue == file.values.end() ) || foundValue->second.empty() ) {
+				return( false );
 			}
-			fclose(fd);
+			value = foundValue->second;
+			return( true );
 		}
-		if (foundTag)
-			return value;
-		return NULL;
+	};
+
+	const int64_t CFLibConfigFileCache::STAT_RECHECK_MILLIS = 1000;
+	const size_t CFLibConfigFileCache::MAX_FILES = 64;
+
+	CFLibConfigFileCache& getConfigFileCache() {
+		static CFLibConfigFileCache cache;
+		return( cache );
+	}
+
+	}
+
+	/* Look for tag=someValue within filename.	When found, return someValue
+	 * in the provided value parameter up to valueSize in length.	If someValue
+	 * is enclosed in quotes, remove them. */
+	char* CFLib::getValue( const char *filename, const char *tag, char *value, std::string::size_type valueSize)
+	{
+		if( ( filename == NULL ) || ( tag == NULL ) || ( value == NULL ) || ( valueSize == 0 ) ) {
+			return( NULL );
+		}
+		std::string found;
+		if( ! getConfigFileCache().lookup( filename, tag, found ) ) {
+			return( NULL );
+		}
+		std::string::size_type len = found.copy( value, valueSize - 1 );
+		value[len] = 0x00;
+		return( value );
+	}
+
+	bool CFLib::getValue( const std::string& filename, const std::string& tag, std::string& value )
+	{
+		return( getConfigFileCache().lookup( filename, tag, value ) );
 	}
 
 	std::chrono::system_clock::time_point* CFLib::getUTCTimestamp()
@@ -339,6 +481,45 @@ namespace cflib {
 		return( cal );
 	}
 
+	std::chrono::system_clock::time_point CFLib::getUTCTimestampInstance( int clockSource )
+	{
+#if defined(CLOCK_REALTIME_COARSE)
+		if( clockSource == CLOCK_COARSE ) {
+			struct timespec now;
+			if( clock_gettime( CLOCK_REALTIME_COARSE, &now ) == 0 ) {
+				std::chrono::nanoseconds sinceEpoch( ( (int64_t)now.tv_sec * 1000000000 ) + now.tv_nsec );
+				std::chrono::system_clock::time_point cal( std::chrono::duration_cast<std::chrono::system_clock::duration>( sinceEpoch ) );
+				return( cal );
+			}
+		}
+#endif
+		std::chrono::system_clock::time_point cal( std::chrono::system_clock::now() );
+		return( cal );
+	}
+
+	std::chrono::nanoseconds CFLib::getUTCTimestampResolution( int clockSource )
+	{
+#if defined(CLOCK_REALTIME_COARSE)
+		struct timespec resolution;
+		if( clock_getres( ( clockSource == CLOCK_COARSE ) ? CLOCK_REALTIME_COARSE : CLOCK_REALTIME, &resolution ) == 0 ) {
+			return( std::chrono::nanoseconds( ( (int64_t)resolution.tv_sec * 1000000000 ) + resolution.tv_nsec ) );
+		}
+#endif
+		return( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::system_clock::duration( 1 ) ) );
+	}
+
+	int64_t CFLib::daysFromCivil( int64_t year, int month, int64_t day ) {
+		// Count from a March-based year so the leap day is the last day
+		// of the year, in 400-year eras of 146097 days
+		year -= ( month <= 2 ) ? 1 : 0;
+		int64_t era = ( ( year >= 0 ) ? year : ( year - 399 ) ) / 400;
+		int64_t yearOfEra = year - ( era * 400 );
+		int64_t dayOfYear = ( ( ( 153 * ( month + ( ( month > 2 ) ? -3 : 9 ) ) ) + 2 ) / 5 ) + day - 1;
+		int64_t dayOfEra = ( yearOfEra * 365 ) + ( yearOfEra / 4 ) - ( yearOfEra / 100 ) + dayOfYear;
+		// 719468 is the day of era count of 1970-01-01 from 0000-03-01
+		return( ( era * 146097 ) + dayOfEra - 719468 );
+	}
+
 	std::chrono::system_clock::time_point* CFLib::getUTCGregorianCalendar(
 		int year,
 		int month,
@@ -347,37 +528,8 @@ namespace cflib {
 		int minute,
 		int second )
 	{
-		static const char S_UTC[4] = "UTC";
-
-		std::chrono::system_clock::time_point* retval;
-
-		// MSS TODO Server time is always UTC, and I'm coding for the server right now
-		year -= 1900;
-		month -= 1;
-		if( month == 12 ) {
-			year++;
-			month = 0;
-		}
-
-		struct tm tmRead = { 0 };
-
-		tmRead.tm_year = year;
-		tmRead.tm_mon = month;
-		tmRead.tm_mday = day;
-		tmRead.tm_hour = hour;
-		tmRead.tm_min = minute;
-		tmRead.tm_sec = second;
-	#if ! defined(_WINDOWS)
-		tmRead.tm_gmtoff = 0L;
-		tmRead.tm_zone = S_UTC;
-	#endif
-
-		time_t timeRead = mktime( &tmRead );
-
-		std::chrono::system_clock::time_point converted = std::chrono::system_clock::from_time_t( timeRead );
-
-		retval = new std::chrono::system_clock::time_point( converted );
-
+		std::chrono::system_clock::time_point* retval = new std::chrono::system_clock::time_point(
+			getUTCGregorianCalendarInstance( year, month, day, hour, minute, second ) );
 		return( retval );
 	}
 
@@ -389,36 +541,20 @@ namespace cflib {
 		int minute,
 		int second )
 	{
-		static const char S_UTC[4] = "UTC";
-
-		std::chrono::system_clock::time_point retval;
-
-		// MSS TODO Server time is always UTC, and I'm coding for the server right now
-		year -= 1900;
-		month -= 1;
-		if( month == 12 ) {
-			year++;
-			month = 0;
-		}
-
-		struct tm tmRead = { 0 };
-
-		tmRead.tm_year = year;
-		tmRead.tm_mon = month;
-		tmRead.tm_mday = day;
-		tmRead.tm_hour = hour;
-		tmRead.tm_min = minute;
-		tmRead.tm_sec = second;
-	#if ! defined(_WINDOWS)
-		tmRead.tm_gmtoff = 0L;
-		tmRead.tm_zone = S_UTC;
-	#endif
-
-		time_t timeRead = mktime( &tmRead );
-
-		std::chrono::system_clock::time_point converted = std::chrono::system_clock::from_time_t( timeRead );
-
-		return( converted );
+		// Carry months outside 1..12 into the year, rounding toward negative infinity
+		int64_t monthIndex = (int64_t)month - 1;
+		int64_t yearCarry = ( monthIndex >= 0 ) ? ( monthIndex / 12 ) : ( ( monthIndex - 11 ) / 12 );
+		int64_t normalizedYear = (int64_t)year + yearCarry;
+		int normalizedMonth = (int)( monthIndex - ( yearCarry * 12 ) ) + 1;
+
+		int64_t seconds = ( daysFromCivil( normalizedYear, normalizedMonth, day ) * 86400 )
+			+ ( (int64_t)hour * 3600 )
+			+ ( (int64_t)minute * 60 )
+			+ second;
+
+		std::chrono::seconds sinceEpoch( seconds );
+		std::chrono::system_clock::time_point retval( sinceEpoch );
+		return( retval );
 	}
 
 	const std::string* CFLib::getLinkName() {
@@ -429,79 +565,127 @@ namespace cflib {
 		return( &LinkVersion );
 	}
 
-	size_t CFLib::hash( const uuid_ptr_t value ) {
-		size_t hash;
-		if( value == NULL ) {
-			hash = 0;
-		}
-		else {
-			hash = ( ( ((size_t)((value)[0])) & 0x0f ) << 24 )
-				+ ( ( ((size_t)((value)[3])) & 0x0f ) << 16 )
-				+ ( ( ((size_t)((value)[9])) & 0x0f ) << 8 )
-				+ ( ((size_t)((value)[15]) & 0x0f ) );
-		}
-		return( hash );
+	/*
+	 *	hashBytes() is the wyhash final4 algorithm by Wang Yi (released to the
+	 *	public domain): 64-bit loads folded through 64x64->128 bit multiplies,
+	 *	consuming every byte of the input at several bytes per cycle.
+	 */
+	static const uint64_t WYHASH_SECRET[4] = {
+		0x2d358dccaa6c78a5ULL,
+		0x8bb84b93962eacc9ULL,
+		0x4b33a62ed433d4a3ULL,
+		0x4d5a2da51de1aa47ULL
+	};
+
+	static inline void wyhashMultiply( uint64_t& a, uint64_t& b ) {
+#if defined(__SIZEOF_INT128__)
+		__uint128_t product = a;
+		product *= b;
+		a = (uint64_t)product;
+		b = (uint64_t)( product >> 64 );
+#else
+		uint64_t ha = a >> 32;
+		uint64_t hb = b >> 32;
+		uint64_t la = (uint32_t)a;
+		uint64_t lb = (uint32_t)b;
+		uint64_t rh = ha * hb;
+		uint64_t rm0 = ha * lb;
+		uint64_t rm1 = hb * la;
+		uint64_t rl = la * lb;
+		uint64_t t = rl + ( rm0 << 32 );
+		uint64_t carry = ( t < rl ) ? 1 : 0;
+		uint64_t lo = t + ( rm1 << 32 );
+		carry += ( lo < t ) ? 1 : 0;
+		uint64_t hi = rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + carry;
+		a = lo;
+		b = hi;
+#endif
 	}
 
-	size_t CFLib::hash( const std::string* value ) {
-		size_t hash;
-		if( value == NULL ) {
-			hash = 0;
-		}
-		else {
-			std::string::size_type len = value->length();
-			if( len > 4 ) {
-				hash = ( value->at( len - 1 ) << 24 )
-					+ ( value->at( ( len / 4 ) * 2 ) << 16 )
-					+ ( value->at( len / 4 ) << 8 )
-					+ value->at( 0 );
+	static inline uint64_t wyhashMix( uint64_t a, uint64_t b ) {
+		wyhashMultiply( a, b );
+		return( a ^ b );
+	}
+
+	static inline uint64_t wyhashRead8( const BYTE* p ) {
+		uint64_t v;
+		memcpy( &v, p, 8 );
+		return( v );
+	}
+
+	static inline uint64_t wyhashRead4( const BYTE* p ) {
+		uint32_t v;
+		memcpy( &v, p, 4 );
+		return( v );
+	}
+
+	uint64_t CFLib::hashBytes( const void* value, size_t len, uint64_t seed ) {
+		const BYTE* p = (const BYTE*)value;
+		uint64_t a;
+		uint64_t b;
+		seed ^= wyhashMix( seed ^ WYHASH_SECRET[0], WYHASH_SECRET[1] );
+		if( len <= 16 ) {
+			if( len >= 4 ) {
+				a = ( wyhashRead4( p ) << 32 ) | wyhashRead4( p + ( ( len >> 3 ) << 2 ) );
+				b = ( wyhashRead4( p + len - 4 ) << 32 ) | wyhashRead4( p + len - 4 - ( ( len >> 3 ) << 2 ) );
 			}
-			else if( len > 2 ) {
-				hash = ( value->at( 2 ) << 16 )
-					+ ( value->at( 1 ) << 8 )
-					+ value->at( 0 );
+			else if( len > 0 ) {
+				a = ( ( (uint64_t)p[0] ) << 16 ) | ( ( (uint64_t)p[len >> 1] ) << 8 ) | p[len - 1];
+				b = 0;
 			}
-			else if( len > 1 ) {
-				hash = ( value->at( 1 ) << 16 )
-					+ value->at( 0 );
+			else {
+				a = 0;
+				b = 0;
 			}
-			else if( len == 1 ) {
-				hash = value->at( 0 );
+		}
+		else {
+			size_t remaining = len;
+			if( remaining > 48 ) {
+				uint64_t seed1 = seed;
+				uint64_t seed2 = seed;
+				do {
+					seed = wyhashMix( wyhashRead8( p ) ^ WYHASH_SECRET[1], wyhashRead8( p + 8 ) ^ seed );
+					seed1 = wyhashMix( wyhashRead8( p + 16 ) ^ WYHASH_SECRET[2], wyhashRead8( p + 24 ) ^ seed1 );
+					seed2 = wyhashMix( wyhashRead8( p + 32 ) ^ WYHASH_SECRET[3], wyhashRead8( p + 40 ) ^ seed2 );
+					p += 48;
+					remaining -= 48;
+				} while( remaining > 48 );
+				seed ^= seed1 ^ seed2;
 			}
-			else {
-				// An empty string has a hash of 0
-				hash = 0;
+			while( remaining > 16 ) {
+				seed = wyhashMix( wyhashRead8( p ) ^ WYHASH_SECRET[1], wyhashRead8( p + 8 ) ^ seed );
+				remaining -= 16;
+				p += 16;
 			}
+			a = wyhashRead8( p + remaining - 16 );
+			b = wyhashRead8( p + remaining - 8 );
 		}
-		return( hash );
+		a ^= WYHASH_SECRET[1];
+		b ^= seed;
+		wyhashMultiply( a, b );
+		return( wyhashMix( a ^ WYHASH_SECRET[0] ^ len, b ^ WYHASH_SECRET[1] ) );
 	}
 
-	size_t CFLib::hash( const std::string& value ) {
-		size_t hash;
-		std::string::size_type len = value.length();
-		if( len > 4 ) {
-			hash = ( value.at( len - 1 ) << 24 )
-				+ ( value.at( ( len / 4 ) * 2 ) << 16 )
-				+ ( value.at( len / 4 ) << 8 )
-				+ value.at( 0 );
-		}
-		else if( len > 2 ) {
-			hash = ( value.at( 2 ) << 16 )
-				+ ( value.at( 1 ) << 8 )
-				+ value.at( 0 );
-		}
-		else if( len > 1 ) {
-			hash = ( value.at( 1 ) << 16 )
-				+ value.at( 0 );
-		}
-		else if( len == 1 ) {
-			hash = value.at( 0 );
+	size_t CFLib::hash( const uuid_ptr_t value ) {
+		if( value == NULL ) {
+			return( 0 );
 		}
-		else {
-			// An empty string has a hash of 0
-			hash = 0;
+		// A uuid_t is 16 bytes, so both halves are read in one step each
+		uint64_t a = wyhashRead8( value ) ^ WYHASH_SECRET[1];
+		uint64_t b = wyhashRead8( value + 8 ) ^ wyhashMix( WYHASH_SECRET[0], WYHASH_SECRET[1] );
+		wyhashMultiply( a, b );
+		return( (size_t)wyhashMix( a ^ WYHASH_SECRET[0] ^ 16, b ^ WYHASH_SECRET[1] ) );
+	}
+
+	size_t CFLib::hash( const std::string* value ) {
+		if( value == NULL ) {
+			return( 0 );
 		}
-		return( hash );
+		return( (size_t)hashBytes( value->data(), value->length() ) );
+	}
+
+	size_t CFLib::hash( const std::string& value ) {
+		return( (size_t)hashBytes( value.data(), value.length() ) );
 	}
 
 	size_t CFLib::hash( const std::chrono::system_clock::time_point& value ) {
@@ -511,31 +695,7 @@ namespace cflib {
 	}
 
 	size_t CFLib::hash( const std::vector<BYTE>& value ) {
-		size_t hash;
-		std::vector<BYTE>::size_type len = value.size();
-		if( len > 4 ) {
-			hash = ( value.at( len - 1 ) << 24 )
-				+ ( value.at( ( len / 4 ) * 2 ) << 16 )
-				+ ( value.at( len / 4 ) << 8 )
-				+ value.at( 0 );
-		}
-		else if( len > 2 ) {
-			hash = ( value.at( 2 ) << 16 )
-				+ ( value.at( 1 ) << 8 )
-				+ value.at( 0 );
-		}
-		else if( len > 1 ) {
-			hash = ( value.at( 1 ) << 16 )
-				+ value.at( 0 );
-		}
-		else if( len == 1 ) {
-			hash = value.at( 0 );
-		}
-		else {
-			// An empty vector has a hash of 0
-			hash = 0;
-		}
-		return( hash );
+		return( (size_t)hashBytes( value.data(), value.size() ) );
 	}
 
 	bool CFLib::startsWith( const std::string& str, const std::string& match ) {
@@ -231,11 +231,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
+			S_Empty,							// argArgValueString,
 			S_Empty,							// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_NO_MORE_THAN + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, (int64_t)argValue, (int64_t)0, (int64_t)maxValue );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -252,11 +253,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
+			S_Empty,							// argArgValueString,
 			S_Empty,							// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_NO_MORE_THAN + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, (int64_t)argValue, (int64_t)0, (int64_t)maxValue );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -273,11 +275,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
+			S_Empty,							// argArgValueString,
 			S_Empty,							// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_NO_MORE_THAN + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, (int64_t)argValue, (int64_t)0, (int64_t)maxValue );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -294,11 +297,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
+			S_Empty,							// argArgValueString,
 			S_Empty,							// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_NO_MORE_THAN + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, (uint64_t)argValue, (uint64_t)0, (uint64_t)maxValue );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -315,11 +319,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
+			S_Empty,							// argArgValueString,
 			S_Empty,							// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_NO_MORE_THAN + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, (uint64_t)argValue, (uint64_t)0, (uint64_t)maxValue );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -336,11 +341,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
+			S_Empty,							// argArgValueString,
 			S_Empty,							// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_NO_MORE_THAN + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, (uint64_t)argValue, (uint64_t)0, (uint64_t)maxValue );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -357,11 +363,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
+			S_Empty,							// argArgValueString,
 			S_Empty,							// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_NO_MORE_THAN + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, (double)argValue, (double)0, (double)maxValue );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -378,11 +385,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
+			S_Empty,							// argArgValueString,
 			S_Empty,							// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_NO_MORE_THAN + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, (double)argValue, (double)0, (double)maxValue );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -399,11 +407,12 @@ namespace cflib {
 			argMethodName,								// argMethodName
 			argArgOffset,								// argArgOffset
 			argArgName,									// argArgName
-			CFLibXmlUtil::formatTimestamp( argValue ),	// argArgValueString,
+			S_Empty,									// argArgValueString,
 			S_Empty,									// argArgMinValueString
-			CFLibXmlUtil::formatTimestamp( maxValue ),	// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + CFLibXmlUtil::formatTimestamp( argValue ) + S_MUST_BE_NO_MORE_THAN + CFLibXmlUtil::formatTimestamp( maxValue ) ) )
+			S_Empty,									// argArgMaxValueString
+			S_Empty )									// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, argValue, argValue, maxValue );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -420,11 +429,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			argValue,							// argArgValueString,
+			S_Empty,							// argArgValueString,
 			S_Empty,							// argArgMinValueString
-			maxValue,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + argValue + S_MUST_BE_NO_MORE_THAN + maxValue ) )
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, argValue, S_Empty, maxValue );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -441,11 +451,15 @@ namespace cflib {
 			argMethodName,							// argMethodName
 			argArgOffset,							// argArgOffset
 			argArgName,								// argArgName
-			CFLibXmlUtil::formatMPFR( argValue ),	// argArgValueString,
+			S_Empty,								// argArgValueString,
 			S_Empty,								// argArgMinValueString
-			CFLibXmlUtil::formatMPFR( maxValue ),	// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + CFLibXmlUtil::formatMPFR( argValue ) + S_MUST_BE_NO_MORE_THAN + CFLibXmlUtil::formatMPFR( maxValue ) ) )
+			S_Empty,								// argArgMaxValueString
+			S_Empty )								// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX,
+			CFLibXmlUtil::formatMPFR( argValue ),
+			S_Empty,
+			CFLibXmlUtil::formatMPFR( maxValue ) );
 	}
 
 	CFLibArgumentOverflowException::CFLibArgumentOverflowException(
@@ -462,10 +476,11 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			argValue.toString(),				// argArgValueString,
+			S_Empty,							// argArgValueString,
 			S_Empty,							// argArgMinValueString
-			maxValue.toString(),				// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + argValue.toString() + S_MUST_BE_NO_MORE_THAN + maxValue.toString() ) )
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_NO_MORE_THAN, ARG_BOUND_MAX, argValue.toString(), S_Empty, maxValue.toString() );
 	}
 }
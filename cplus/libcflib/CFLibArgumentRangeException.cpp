@@ -232,11 +232,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_IS_OUT_OF_THE_RANGE + std::to_string( minValue ) + CFLib::S_DOT_DOT + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, (int64_t)argValue, (int64_t)minValue, (int64_t)maxValue );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -254,11 +255,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_IS_OUT_OF_THE_RANGE + std::to_string( minValue ) + CFLib::S_DOT_DOT + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, (int64_t)argValue, (int64_t)minValue, (int64_t)maxValue );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -276,11 +278,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_IS_OUT_OF_THE_RANGE + std::to_string( minValue ) + CFLib::S_DOT_DOT + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, (int64_t)argValue, (int64_t)minValue, (int64_t)maxValue );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -298,11 +301,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_IS_OUT_OF_THE_RANGE + std::to_string( minValue ) + CFLib::S_DOT_DOT + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, (uint64_t)argValue, (uint64_t)minValue, (uint64_t)maxValue );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -320,11 +324,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_IS_OUT_OF_THE_RANGE + std::to_string( minValue ) + CFLib::S_DOT_DOT + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, (uint64_t)argValue, (uint64_t)minValue, (uint64_t)maxValue );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -342,11 +347,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_IS_OUT_OF_THE_RANGE + std::to_string( minValue ) + CFLib::S_DOT_DOT + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, (uint64_t)argValue, (uint64_t)minValue, (uint64_t)maxValue );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -364,11 +370,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_IS_OUT_OF_THE_RANGE + std::to_string( minValue ) + CFLib::S_DOT_DOT + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, (double)argValue, (double)minValue, (double)maxValue );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -386,11 +393,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
-			std::to_string( maxValue ),			// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_IS_OUT_OF_THE_RANGE + std::to_string( minValue ) + CFLib::S_DOT_DOT + std::to_string( maxValue ) ) )
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, (double)argValue, (double)minValue, (double)maxValue );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -408,11 +416,12 @@ namespace cflib {
 			argMethodName,								// argMethodName
 			argArgOffset,								// argArgOffset
 			argArgName,									// argArgName
-			CFLibXmlUtil::formatTimestamp( argValue ),	// argArgValueString,
-			CFLibXmlUtil::formatTimestamp( minValue ),	// argArgMinValueString
-			CFLibXmlUtil::formatTimestamp( maxValue ),	// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + CFLibXmlUtil::formatTimestamp( argValue ) + S_IS_OUT_OF_THE_RANGE + CFLibXmlUtil::formatTimestamp( minValue ) + CFLib::S_DOT_DOT + CFLibXmlUtil::formatTimestamp( maxValue ) ) )
+			S_Empty,									// argArgValueString,
+			S_Empty,									// argArgMinValueString
+			S_Empty,									// argArgMaxValueString
+			S_Empty )									// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, argValue, minValue, maxValue );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -430,11 +439,12 @@ namespace cflib {
 			argMethodName,				// argMethodName
 			argArgOffset,				// argArgOffset
 			argArgName,					// argArgName
-			argValue,					// argArgValueString,
-			minValue,					// argArgMinValueString
-			maxValue,					// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + argValue + S_IS_OUT_OF_THE_RANGE + minValue + CFLib::S_DOT_DOT + maxValue ) )
+			S_Empty,					// argArgValueString,
+			S_Empty,					// argArgMinValueString
+			S_Empty,					// argArgMaxValueString
+			S_Empty )					// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, argValue, minValue, maxValue );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -452,11 +462,15 @@ namespace cflib {
 			argMethodName,							// argMethodName
 			argArgOffset,							// argArgOffset
 			argArgName,								// argArgName
-			CFLibXmlUtil::formatMPFR( argValue ),	// argArgValueString,
-			CFLibXmlUtil::formatMPFR( minValue ),	// argArgMinValueString
-			CFLibXmlUtil::formatMPFR( maxValue ),	// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + CFLibXmlUtil::formatMPFR( argValue ) + S_IS_OUT_OF_THE_RANGE + CFLibXmlUtil::formatMPFR( minValue ) + CFLib::S_DOT_DOT + CFLibXmlUtil::formatMPFR( maxValue ) ) )
+			S_Empty,								// argArgValueString,
+			S_Empty,								// argArgMinValueString
+			S_Empty,								// argArgMaxValueString
+			S_Empty )								// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX,
+			CFLibXmlUtil::formatMPFR( argValue ),
+			CFLibXmlUtil::formatMPFR( minValue ),
+			CFLibXmlUtil::formatMPFR( maxValue ) );
 	}
 
 	CFLibArgumentRangeException::CFLibArgumentRangeException(
@@ -474,10 +488,11 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			argValue.toString(),				// argArgValueString,
-			minValue.toString(),				// argArgMinValueString
-			maxValue.toString(),				// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + argValue.toString() + S_IS_OUT_OF_THE_RANGE + minValue.toString() + CFLib::S_DOT_DOT + maxValue.toString() ) )
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
+			S_Empty,							// argArgMaxValueString
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_IS_OUT_OF_THE_RANGE, ARG_BOUND_MIN | ARG_BOUND_MAX, argValue.toString(), minValue.toString(), maxValue.toString() );
 	}
 }
@@ -230,11 +230,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
 			S_Empty,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_AT_LEAST + std::to_string( minValue ) ) )
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, (int64_t)argValue, (int64_t)minValue, (int64_t)0 );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -251,11 +252,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
 			S_Empty,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_AT_LEAST + std::to_string( minValue ) ) )
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, (int64_t)argValue, (int64_t)minValue, (int64_t)0 );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -272,11 +274,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
 			S_Empty,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_AT_LEAST + std::to_string( minValue ) ) )
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, (int64_t)argValue, (int64_t)minValue, (int64_t)0 );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -293,11 +296,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
 			S_Empty,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_AT_LEAST + std::to_string( minValue ) ) )
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, (uint64_t)argValue, (uint64_t)minValue, (uint64_t)0 );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -314,11 +318,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
 			S_Empty,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_AT_LEAST + std::to_string( minValue ) ) )
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, (uint64_t)argValue, (uint64_t)minValue, (uint64_t)0 );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -335,11 +340,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
 			S_Empty,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_AT_LEAST + std::to_string( minValue ) ) )
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, (uint64_t)argValue, (uint64_t)minValue, (uint64_t)0 );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -356,11 +362,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
 			S_Empty,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_AT_LEAST + std::to_string( minValue ) ) )
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, (double)argValue, (double)minValue, (double)0 );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -377,11 +384,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			std::to_string( argValue ),			// argArgValueString,
-			std::to_string( minValue ),			// argArgMinValueString
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
 			S_Empty,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + std::to_string( argValue ) + S_MUST_BE_AT_LEAST + std::to_string( minValue ) ) )
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, (double)argValue, (double)minValue, (double)0 );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -398,11 +406,12 @@ namespace cflib {
 			argMethodName,								// argMethodName
 			argArgOffset,								// argArgOffset
 			argArgName,									// argArgName
-			CFLibXmlUtil::formatTimestamp( argValue ),	// argArgValueString,
-			CFLibXmlUtil::formatTimestamp( minValue ),	// argArgMinValueString
+			S_Empty,									// argArgValueString,
+			S_Empty,									// argArgMinValueString
 			S_Empty,									// argArgMaxValueString
-			std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + CFLibXmlUtil::formatTimestamp( argValue ) + S_MUST_BE_AT_LEAST + CFLibXmlUtil::formatTimestamp( minValue ) ) )
+			S_Empty )									// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, argValue, minValue, argValue );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -419,11 +428,12 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			argValue,							// argArgValueString,
-			minValue,							// argArgMinValueString
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
 			S_Empty,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + argValue + S_MUST_BE_AT_LEAST + minValue ) )
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, argValue, minValue, S_Empty );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -440,11 +450,15 @@ namespace cflib {
 			argMethodName,							// argMethodName
 			argArgOffset,							// argArgOffset
 			argArgName,								// argArgName
-			CFLibXmlUtil::formatMPFR( argValue ),	// argArgValueString,
-			CFLibXmlUtil::formatMPFR( minValue ),	// argArgMinValueString
+			S_Empty,								// argArgValueString,
+			S_Empty,								// argArgMinValueString
 			S_Empty,								// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + CFLibXmlUtil::formatMPFR( argValue ) + S_MUST_BE_AT_LEAST + CFLibXmlUtil::formatMPFR( minValue ) ) )
+			S_Empty )								// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN,
+			CFLibXmlUtil::formatMPFR( argValue ),
+			CFLibXmlUtil::formatMPFR( minValue ),
+			S_Empty );
 	}
 
 	CFLibArgumentUnderflowException::CFLibArgumentUnderflowException(
@@ -461,10 +475,11 @@ namespace cflib {
 			argMethodName,						// argMethodName
 			argArgOffset,						// argArgOffset
 			argArgName,							// argArgName
-			argValue.toString(),				// argArgValueString,
-			minValue.toString(),				// argArgMinValueString
+			S_Empty,							// argArgValueString,
+			S_Empty,							// argArgMinValueString
 			S_Empty,							// argArgMaxValueString
-	 		std::string( argArgName + CFLib::S_SPACE + CFLib::S_VALUE_SPACE + argValue.toString() + S_MUST_BE_AT_LEAST + minValue.toString() ) )
+			S_Empty )							// argMessageText
 	{
+		setArgBoundValues( S_MUST_BE_AT_LEAST, ARG_BOUND_MIN, argValue.toString(), minValue.toString(), S_Empty );
 	}
 }
@@ -0,0 +1,382 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#include <cflib/CFLib.hpp>
+#include <cflib/ICFLibPublic.hpp>
+#include <cflib/CFLibAsyncFileMessageLog.hpp>
+
+namespace cflib {
+
+	const std::string CFLibAsyncFileMessageLog::CLASS_NAME( "CFLibAsyncFileMessageLog" );
+	const int CFLibAsyncFileMessageLog::OVERFLOW_BLOCK = 0;
+	const int CFLibAsyncFileMessageLog::OVERFLOW_DROP = 1;
+	const int CFLibAsyncFileMessageLog::OVERFLOW_COUNT = 2;
+	const uint32_t CFLibAsyncFileMessageLog::DEFAULT_CAPACITY = 8192;
+
+	// The most lines handed to a single writev()
+	static const size_t MAX_BATCH = ( IOV_MAX < 256 ) ? IOV_MAX : 256;
+
+	CFLibAsyncFileMessageLog::CFLibAsyncFileMessageLog( uint32_t capacity, int policy ) {
+		static const std::string S_ProcName( "construct" );
+		static const std::string S_ArgCapacity( "capacity" );
+		static const std::string S_ArgPolicy( "policy" );
+		if( ( capacity < 2 ) || ( capacity > 0x40000000 ) ) {
+			throw CFLibArgumentRangeException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgCapacity,
+				(int64_t)capacity,
+				(int64_t)2,
+				(int64_t)0x40000000 );
+		}
+		if( ( policy < OVERFLOW_BLOCK ) || ( policy > OVERFLOW_COUNT ) ) {
+			throw CFLibArgumentRangeException( CLASS_NAME,
+				S_ProcName,
+				2,
+				S_ArgPolicy,
+				(int64_t)policy,
+				(int64_t)OVERFLOW_BLOCK,
+				(int64_t)OVERFLOW_COUNT );
+		}
+		uint64_t slotCount = 2;
+		while( slotCount < capacity ) {
+			slotCount <<= 1;
+		}
+		slots = new Slot[slotCount];
+		for( uint64_t i = 0; i < slotCount; i++ ) {
+			slots[i].sequence.store( i, std::memory_order_relaxed );
+		}
+		slotMask = slotCount - 1;
+		overflowPolicy = policy;
+		enqueuePos.store( 0 );
+		dequeuePos = 0;
+		writtenCount.store( 0 );
+		droppedCount.store( 0 );
+		unreportedDropCount.store( 0 );
+		ndnt.store( 0 );
+		logFd = -1;
+		writerThread = NULL;
+		running.store( false );
+		activeProducers.store( 0 );
+		stopping.store( false );
+		writerSleeping.store( false );
+		flushWaiters.store( 0 );
+	}
+
+	CFLibAsyncFileMessageLog::~CFLibAsyncFileMessageLog() {
+		closeLogFile();
+		if( slots != NULL ) {
+			delete[] slots;
+			slots = NULL;
+		}
+	}
+
+	int CFLibAsyncFileMessageLog::getMessageLogIndent() const {
+		return( ndnt.load( std::memory_order_relaxed ) );
+	}
+
+	void CFLibAsyncFileMessageLog::dedent() {
+		int cur = ndnt.load( std::memory_order_relaxed );
+		while( ( cur > 0 ) && ! ndnt.compare_exchange_weak( cur, cur - 1, std::memory_order_relaxed ) ) {
+		}
+	}
+
+	void CFLibAsyncFileMessageLog::indent() {
+		ndnt.fetch_add( 1, std::memory_order_relaxed );
+	}
+
+	int CFLibAsyncFileMessageLog::getOverflowPolicy() const {
+		return( overflowPolicy );
+	}
+
+	uint64_t CFLibAsyncFileMessageLog::getDroppedCount() const {
+		return( droppedCount.load( std::memory_order_relaxed ) );
+	}
+
+	void CFLibAsyncFileMessageLog::message( const std::string& msg ) {
+		std::string line;
+		int curIndent = ndnt.load( std::memory_order_relaxed );
+		line.reserve( 20 + curIndent + msg.length() + 1 );
+
+		time_t systime;
+		time( &systime );
+		struct tm tms;
+		gmtime_r( &systime, &tms );
+		char fmt[64] = { 0 };
+		snprintf( &fmt[0], 64, "%04d-%02d-%02d %02d:%02d:%02d ",
+			tms.tm_year + 1900, tms.tm_mon + 1, tms.tm_mday,
+			tms.tm_hour, tms.tm_min, tms.tm_sec );
+		line.append( fmt );
+		line.append( curIndent, '\t' );
+		line.append( msg );
+		if( ( ! msg.empty() ) && ( msg.back() != '\n' ) ) {
+			line.push_back( '\n' );
+		}
+
+		// closeLogFile() clears running and then waits for activeProducers
+		// to drain, so a message either sees running cleared or is queued
+		// before the writer stops.  Both are sequentially consistent.
+		activeProducers.fetch_add( 1 );
+		if( ! running.load() ) {
+			activeProducers.fetch_sub( 1 );
+			std::cout << line;
+			return;
+		}
+
+		while( ! enqueue( line ) ) {
+			if( overflowPolicy != OVERFLOW_BLOCK ) {
+				droppedCount.fetch_add( 1, std::memory_order_relaxed );
+				if( overflowPolicy == OVERFLOW_COUNT ) {
+					unreportedDropCount.fetch_add( 1, std::memory_order_relaxed );
+				}
+				activeProducers.fetch_sub( 1 );
+				return;
+			}
+			std::this_thread::yield();
+		}
+		activeProducers.fetch_sub( 1 );
+
+		if( writerSleeping.load( std::memory_order_acquire ) ) {
+			writerWakeup.notify_one();
+		}
+	}
+
+	bool CFLibAsyncFileMessageLog::enqueue( std::string& line ) {
+		// Bounded MPMC ring after Dmitry Vyukov: a slot is free for position
+		// pos when its sequence equals pos, and ready for the writer when it
+		// equals pos + 1.
+		uint64_t pos = enqueuePos.load( std::memory_order_relaxed );
+		Slot* slot;
+		for( ;; ) {
+			slot = &slots[ pos & slotMask ];
+			uint64_t seq = slot->sequence.load( std::memory_order_acquire );
+			int64_t diff = (int64_t)seq - (int64_t)pos;
+			if( diff == 0 ) {
+				if( enqueuePos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) ) {
+					break;
+				}
+			}
+			else if( diff < 0 ) {
+				return( false );
+			}
+			else {
+				pos = enqueuePos.load( std::memory_order_relaxed );
+			}
+		}
+		slot->text.swap( line );
+		slot->sequence.store( pos + 1, std::memory_order_release );
+		return( true );
+	}
+
+	void CFLibAsyncFileMessageLog::writeFully( const char* bytes, size_t length ) {
+		while( length > 0 ) {
+			ssize_t written = write( logFd, bytes, length );
+			if( written < 0 ) {
+				if( errno == EINTR ) {
+					continue;
+				}
+				return;
+			}
+			bytes += written;
+			length -= written;
+		}
+	}
+
+	size_t CFLibAsyncFileMessageLog::writeBatch() {
+		struct iovec iov[MAX_BATCH + 1];
+		size_t numIov = 0;
+		std::string dropReport;
+		uint64_t dropsToReport = unreportedDropCount.exchange( 0, std::memory_order_relaxed );
+		if( dropsToReport > 0 ) {
+			dropReport = std::to_string( dropsToReport ) + " log messages dropped\n";
+			iov[numIov].iov_base = (void*)dropReport.data();
+			iov[numIov].iov_len = dropReport.length();
+			numIov ++;
+		}
+
+		size_t numLines = 0;
+		while( numLines < MAX_BATCH ) {
+			uint64_t pos = dequeuePos + numLines;
+			Slot* slot = &slots[ pos & slotMask ];
+			if( slot->sequence.load( std::memory_order_acquire ) != pos + 1 ) {
+				break;
+			}
+			iov[numIov].iov_base = (void*)slot->text.data();
+			iov[numIov].iov_len = slot->text.length();
+			numIov ++;
+			numLines ++;
+		}
+		if( numIov == 0 ) {
+			return( 0 );
+		}
+
+		size_t iovIdx = 0;
+		while( iovIdx < numIov ) {
+			ssize_t written = writev( logFd, &iov[iovIdx], (int)( numIov - iovIdx ) );
+			if( written < 0 ) {
+				if( errno == EINTR ) {
+					continue;
+				}
+				break;
+			}
+			// Skip the fully written entries and finish a partial one by hand
+			while( ( iovIdx < numIov ) && ( (size_t)written >= iov[iovIdx].iov_len ) ) {
+				written -= iov[iovIdx].iov_len;
+				iovIdx ++;
+			}
+			if( ( iovIdx < numIov ) && ( written > 0 ) ) {
+				writeFully( (const char*)iov[iovIdx].iov_base + written, iov[iovIdx].iov_len - written );
+				iovIdx ++;
+			}
+		}
+
+		for( size_t i = 0; i < numLines; i++ ) {
+			uint64_t pos = dequeuePos + i;
+			Slot* slot = &slots[ pos & slotMask ];
+			slot->text.clear();
+			slot->sequence.store( pos + slotMask + 1, std::memory_order_release );
+		}
+		dequeuePos += numLines;
+		writtenCount.store( dequeuePos, std::memory_order_release );
+		if( flushWaiters.load() > 0 ) {
+			notifyFlushed();
+		}
+		return( numLines + ( ( dropsToReport > 0 ) ? 1 : 0 ) );
+	}
+
+	void CFLibAsyncFileMessageLog::notifyFlushed() {
+		// Taking the lock orders the writtenCount update before a waiter's
+		// predicate check, so the wakeup can't fall between check and wait
+		{
+			std::lock_guard<std::mutex> guard( flushLock );
+		}
+		flushDone.notify_all();
+	}
+
+	void CFLibAsyncFileMessageLog::runWriter() {
+		for( ;; ) {
+			if( writeBatch() > 0 ) {
+				continue;
+			}
+			if( stopping.load( std::memory_order_acquire )
+				&& ( enqueuePos.load( std::memory_order_acquire ) == dequeuePos ) )
+			{
+				break;
+			}
+			// The timeout bounds the latency of a wakeup lost between a
+			// producer checking writerSleeping and the writer starting to wait
+			std::unique_lock<std::mutex> guard( writerLock );
+			writerSleeping.store( true, std::memory_order_release );
+			writerWakeup.wait_for( guard, std::chrono::milliseconds( 10 ) );
+			writerSleeping.store( false, std::memory_order_release );
+		}
+	}
+
+	void CFLibAsyncFileMessageLog::flush() {
+		if( ! running.load() ) {
+			return;
+		}
+		uint64_t target = enqueuePos.load( std::memory_order_acquire );
+		std::unique_lock<std::mutex> guard( flushLock );
+		flushWaiters.fetch_add( 1 );
+		writerWakeup.notify_one();
+		flushDone.wait( guard, [this, target]() {
+			return( ( writtenCount.load( std::memory_order_acquire ) >= target ) || ! running.load() );
+		} );
+		flushWaiters.fetch_sub( 1 );
+	}
+
+	void CFLibAsyncFileMessageLog::openLogFile( const std::string& fileName ) {
+		static const std::string S_ProcName( "openLogFile" );
+		static const std::string S_ArgFileName( "fileName" );
+		if( fileName.empty() ) {
+			throw CFLibEmptyArgumentException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgFileName );
+		}
+		closeLogFile();
+		int fd = open( fileName.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644 );
+		if( fd < 0 ) {
+			throw CFLibWrapSystemException( CLASS_NAME,
+				S_ProcName,
+				fileName,
+				strerror( errno ) );
+		}
+		logFd = fd;
+		logFileName = fileName;
+		stopping.store( false, std::memory_order_release );
+		try {
+			writerThread = new std::thread( &CFLibAsyncFileMessageLog::runWriter, this );
+		}
+		catch( ... ) {
+			close( logFd );
+			logFd = -1;
+			logFileName.clear();
+			throw;
+		}
+		running.store( true );
+	}
+
+	void CFLibAsyncFileMessageLog::closeLogFile() {
+		if( writerThread != NULL ) {
+			running.store( false );
+			// Let messages already past the running check finish queueing;
+			// an OVERFLOW_BLOCK producer needs the writer to make room
+			while( activeProducers.load() > 0 ) {
+				writerWakeup.notify_one();
+				std::this_thread::yield();
+			}
+			stopping.store( true, std::memory_order_release );
+			writerWakeup.notify_one();
+			writerThread->join();
+			delete writerThread;
+			writerThread = NULL;
+			// The writer drains the queue before it stops; write anything it
+			// could not see as published when it made its last check
+			while( dequeuePos < enqueuePos.load( std::memory_order_acquire ) ) {
+				if( writeBatch() == 0 ) {
+					std::this_thread::yield();
+				}
+			}
+			notifyFlushed();
+		}
+		if( logFd >= 0 ) {
+			close( logFd );
+			logFd = -1;
+		}
+		logFileName.clear();
+	}
+}
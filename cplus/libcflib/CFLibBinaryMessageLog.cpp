@@ -0,0 +1,531 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#include <cflib/CFLib.hpp>
+#include <cflib/ICFLibPublic.hpp>
+#include <cflib/CFLibBinaryMessageLog.hpp>
+
+namespace cflib {
+
+	const std::string CFLibBinaryMessageLog::CLASS_NAME( "CFLibBinaryMessageLog" );
+	const char CFLibBinaryMessageLog::FILE_MAGIC[8] = { 'C', 'F', 'L', 'B', 'L', 'O', 'G', '1' };
+
+	const uint8_t CFLibBinaryMessageLog::RECORD_FORMAT = 'F';
+	const uint8_t CFLibBinaryMessageLog::RECORD_STRING = 'S';
+	const uint8_t CFLibBinaryMessageLog::RECORD_MESSAGE = 'M';
+	const uint8_t CFLibBinaryMessageLog::RECORD_TEXT = 'T';
+
+	const uint8_t CFLibBinaryMessageLog::ARG_INT64 = 'i';
+	const uint8_t CFLibBinaryMessageLog::ARG_UINT64 = 'u';
+	const uint8_t CFLibBinaryMessageLog::ARG_DOUBLE = 'd';
+	const uint8_t CFLibBinaryMessageLog::ARG_STRING = 's';
+	const uint8_t CFLibBinaryMessageLog::ARG_INTERNED = 'n';
+	const uint8_t CFLibBinaryMessageLog::ARG_TIMESTAMP = 't';
+
+	const size_t CFLibBinaryMessageLog::FLUSH_THRESHOLD = 64 * 1024;
+
+	std::atomic<uint64_t> CFLibBinaryMessageLog::nextLogId( 1 );
+
+	/**
+	 *	A process-wide table of strings and the ids assigned to them, used for
+	 *	both the registered formats and the interned string arguments.
+	 */
+	class CFLibBinaryMessageLogStrings {
+	public:
+		std::mutex lock;
+		std::unordered_map<std::string, uint32_t> ids;
+		std::vector<std::string> strings;
+
+		uint32_t intern( const std::string& str ) {
+			std::lock_guard<std::mutex> guard( lock );
+			auto found = ids.find( str );
+			if( found != ids.end() ) {
+				return( found->second );
+			}
+			uint32_t id = (uint32_t)strings.size();
+			strings.push_back( str );
+			ids[ str ] = id;
+			return( id );
+		}
+
+		std::string get( uint32_t id ) {
+			std::lock_guard<std::mutex> guard( lock );
+			if( id >= strings.size() ) {
+				return( std::string() );
+			}
+			return( strings[id] );
+		}
+	};
+
+	static void writeFully( int fd, const char* bytes, size_t length ) {
+		while( length > 0 ) {
+			ssize_t written = write( fd, bytes, length );
+			if( written < 0 ) {
+				if( errno == EINTR ) {
+					continue;
+				}
+				break;
+			}
+			bytes += written;
+			length -= written;
+		}
+	}
+
+	static CFLibBinaryMessageLogStrings& getFormats() {
+		static CFLibBinaryMessageLogStrings formats;
+		return( formats );
+	}
+
+	static CFLibBinaryMessageLogStrings& getInternedStrings() {
+		static CFLibBinaryMessageLogStrings internedStrings;
+		return( internedStrings );
+	}
+
+	CFLibBinaryMessageLog::CFLibBinaryMessageLog() {
+		logId = nextLogId.fetch_add( 1, std::memory_order_relaxed );
+		logFd.store( -1 );
+		ndnt.store( 0 );
+	}
+
+	CFLibBinaryMessageLog::~CFLibBinaryMessageLog() {
+		closeLogFile();
+	}
+
+	uint32_t CFLibBinaryMessageLog::registerFormat( const std::string& format ) {
+		return( getFormats().intern( format ) );
+	}
+
+	uint32_t CFLibBinaryMessageLog::internString( const std::string& str ) {
+		return( getInternedStrings().intern( str ) );
+	}
+
+	int CFLibBinaryMessageLog::getMessageLogIndent() const {
+		return( ndnt.load( std::memory_order_relaxed ) );
+	}
+
+	void CFLibBinaryMessageLog::dedent() {
+		int cur = ndnt.load( std::memory_order_relaxed );
+		while( ( cur > 0 ) && ! ndnt.compare_exchange_weak( cur, cur - 1, std::memory_order_relaxed ) ) {
+		}
+	}
+
+	void CFLibBinaryMessageLog::indent() {
+		ndnt.fetch_add( 1, std::memory_order_relaxed );
+	}
+
+	CFLibBinaryMessageLog::ThreadBuffer& CFLibBinaryMessageLog::getThreadBuffer() {
+		// Logs are told apart by id rather than address, so a buffer is never
+		// reused by a later log constructed at the same address
+		thread_local uint64_t lastLogId = 0;
+		thread_local ThreadBuffer* lastBuffer = NULL;
+		thread_local std::unordered_map< uint64_t, std::shared_ptr<ThreadBuffer> > threadBuffers;
+		if( lastLogId == logId ) {
+			return( *lastBuffer );
+		}
+		std::shared_ptr<ThreadBuffer>& buffer = threadBuffers[ logId ];
+		if( buffer == NULL ) {
+			buffer = std::make_shared<ThreadBuffer>();
+			std::lock_guard<std::mutex> guard( buffersLock );
+			buffers.push_back( buffer );
+		}
+		lastLogId = logId;
+		lastBuffer = buffer.get();
+		return( *lastBuffer );
+	}
+
+	void CFLibBinaryMessageLog::message( const std::string& msg ) {
+		message( LEVEL_INFO, CATEGORY_GENERAL, msg );
+	}
+
+	void CFLibBinaryMessageLog::message( int level, uint32_t category, const std::string& msg ) {
+		if( ! isEnabled( level, category ) ) {
+			return;
+		}
+		ThreadBuffer& buffer = getThreadBuffer();
+		std::lock_guard<std::mutex> guard( buffer.lock );
+		beginRecord( buffer, RECORD_TEXT, level, category );
+		appendBytes( buffer, msg );
+		endRecord( buffer );
+	}
+
+	void CFLibBinaryMessageLog::appendBytes( ThreadBuffer& buffer, const std::string& str ) {
+		appendRaw( buffer, (uint32_t)str.length() );
+		buffer.pending.append( str );
+	}
+
+	void CFLibBinaryMessageLog::beginRecord( ThreadBuffer& buffer, uint8_t recordType, int level, uint32_t category ) {
+		appendRaw( buffer, recordType );
+		appendRaw( buffer, (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::system_clock::now().time_since_epoch() ).count() );
+		appendRaw( buffer, (uint8_t)level );
+		appendRaw( buffer, category );
+		appendRaw( buffer, (uint16_t)ndnt.load( std::memory_order_relaxed ) );
+	}
+
+	void CFLibBinaryMessageLog::defineFormat( ThreadBuffer& buffer, uint32_t formatId ) {
+		if( ( formatId < buffer.formatsWritten.size() ) && buffer.formatsWritten[formatId] ) {
+			return;
+		}
+		if( formatId >= buffer.formatsWritten.size() ) {
+			buffer.formatsWritten.resize( formatId + 1, false );
+		}
+		appendRaw( buffer, RECORD_FORMAT );
+		appendRaw( buffer, formatId );
+		appendBytes( buffer, getFormats().get( formatId ) );
+		buffer.formatsWritten[formatId] = true;
+	}
+
+	void CFLibBinaryMessageLog::defineString( ThreadBuffer& buffer, uint32_t stringId ) {
+		if( ( stringId < buffer.stringsWritten.size() ) && buffer.stringsWritten[stringId] ) {
+			return;
+		}
+		if( stringId >= buffer.stringsWritten.size() ) {
+			buffer.stringsWritten.resize( stringId + 1, false );
+		}
+		appendRaw( buffer, RECORD_STRING );
+		appendRaw( buffer, stringId );
+		appendBytes( buffer, getInternedStrings().get( stringId ) );
+		buffer.stringsWritten[stringId] = true;
+	}
+
+	void CFLibBinaryMessageLog::endRecord( ThreadBuffer& buffer ) {
+		// logFd only changes while every registered buffer is locked
+		if( logFd.load( std::memory_order_relaxed ) >= 0 ) {
+			if( buffer.pending.length() >= FLUSH_THRESHOLD ) {
+				writeBuffer( buffer );
+			}
+			return;
+		}
+		// No file is open, so render the record and any definitions it
+		// needed to std::cout, and forget them so the next record carries its own.
+		std::istringstream input( buffer.pending );
+		buffer.pending.clear();
+		buffer.formatsWritten.clear();
+		buffer.stringsWritten.clear();
+		decodeRecords( input, std::cout );
+	}
+
+	void CFLibBinaryMessageLog::writeBuffer( ThreadBuffer& buffer ) {
+		std::lock_guard<std::mutex> guard( fileLock );
+		int fd = logFd.load( std::memory_order_relaxed );
+		if( fd >= 0 ) {
+			writeFully( fd, buffer.pending.data(), buffer.pending.length() );
+		}
+		buffer.pending.clear();
+	}
+
+	void CFLibBinaryMessageLog::flush() {
+		std::lock_guard<std::mutex> guard( buffersLock );
+		for( auto iter = buffers.begin(); iter != buffers.end(); iter++ ) {
+			std::lock_guard<std::mutex> bufferGuard( (*iter)->lock );
+			writeBuffer( **iter );
+		}
+	}
+
+	void CFLibBinaryMessageLog::switchLogFile( int newFd ) {
+		// Holding buffersLock keeps new threads from registering a buffer,
+		// and holding every buffer's lock keeps records from being added,
+		// until the switch is complete
+		std::lock_guard<std::mutex> guard( buffersLock );
+		std::vector< std::unique_lock<std::mutex> > bufferGuards;
+		bufferGuards.reserve( buffers.size() );
+		for( auto iter = buffers.begin(); iter != buffers.end(); iter++ ) {
+			bufferGuards.emplace_back( (*iter)->lock );
+			writeBuffer( **iter );
+			(*iter)->formatsWritten.clear();
+			(*iter)->stringsWritten.clear();
+		}
+		std::lock_guard<std::mutex> fileGuard( fileLock );
+		int oldFd = logFd.load( std::memory_order_relaxed );
+		if( oldFd >= 0 ) {
+			close( oldFd );
+		}
+		if( newFd >= 0 ) {
+			writeFully( newFd, FILE_MAGIC, sizeof( FILE_MAGIC ) );
+		}
+		logFd.store( newFd, std::memory_order_relaxed );
+	}
+
+	void CFLibBinaryMessageLog::openLogFile( const std::string& fileName ) {
+		static const std::string S_ProcName( "openLogFile" );
+		static const std::string S_ArgFileName( "fileName" );
+		if( fileName.empty() ) {
+			throw CFLibEmptyArgumentException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgFileName );
+		}
+		int fd = open( fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
+		if( fd < 0 ) {
+			throw CFLibWrapSystemException( CLASS_NAME,
+				S_ProcName,
+				fileName,
+				strerror( errno ) );
+		}
+		switchLogFile( fd );
+	}
+
+	void CFLibBinaryMessageLog::closeLogFile() {
+		switchLogFile( -1 );
+	}
+
+	/**
+	 *	Reads values from a binary log, throwing once the input is exhausted.
+	 */
+	class CFLibBinaryMessageLogDecoder {
+	public:
+		static const std::string CLASS_NAME;
+
+		std::istream& input;
+
+		CFLibBinaryMessageLogDecoder( std::istream& in )
+		: input( in )
+		{
+		}
+
+		template<typename T>
+		T read() {
+			static const std::string S_ProcName( "read" );
+			static const std::string S_MsgTruncated( "Binary log is truncated" );
+			T value;
+			if( ! input.read( (char*)&value, sizeof( T ) ) ) {
+				throw CFLibInvalidArgumentException( CLASS_NAME,
+					S_ProcName,
+					S_MsgTruncated );
+			}
+			return( value );
+		}
+
+		std::string readBytes() {
+			static const std::string S_ProcName( "readBytes" );
+			static const std::string S_MsgTruncated( "Binary log is truncated" );
+			uint32_t length = read<uint32_t>();
+			std::string str( length, '\0' );
+			if( ( length > 0 ) && ! input.read( &str[0], length ) ) {
+				throw CFLibInvalidArgumentException( CLASS_NAME,
+					S_ProcName,
+					S_MsgTruncated );
+			}
+			return( str );
+		}
+	};
+
+	const std::string CFLibBinaryMessageLogDecoder::CLASS_NAME( "CFLibBinaryMessageLogDecoder" );
+
+	static void formatTimestamp( std::string& buff, int64_t nanos, bool withMicros ) {
+		time_t systime = (time_t)( nanos / 1000000000 );
+		struct tm tms;
+		gmtime_r( &systime, &tms );
+		char fmt[64] = { 0 };
+		if( withMicros ) {
+			snprintf( &fmt[0], 64, "%04d-%02d-%02d %02d:%02d:%02d.%06d",
+				tms.tm_year + 1900, tms.tm_mon + 1, tms.tm_mday,
+				tms.tm_hour, tms.tm_min, tms.tm_sec,
+				(int)( ( nanos % 1000000000 ) / 1000 ) );
+		}
+		else {
+			snprintf( &fmt[0], 64, "%04d-%02d-%02d %02d:%02d:%02d",
+				tms.tm_year + 1900, tms.tm_mon + 1, tms.tm_mday,
+				tms.tm_hour, tms.tm_min, tms.tm_sec );
+		}
+		buff.append( fmt );
+	}
+
+	static void formatLevel( std::string& buff, uint8_t level ) {
+		static const char* const levelNames[] = { "TRACE", "DEBUG", "INFO ", "WARN ", "ERROR", "FATAL" };
+		if( level < sizeof( levelNames ) / sizeof( levelNames[0] ) ) {
+			buff.append( levelNames[level] );
+		}
+		else {
+			buff.append( "L" );
+			buff.append( std::to_string( (int)level ) );
+		}
+	}
+
+	static void formatCategory( std::string& buff, uint32_t category ) {
+		if( category == ICFLibMessageLog::CATEGORY_GENERAL ) {
+			buff.append( "[GENERAL]" );
+		}
+		else if( category == ICFLibMessageLog::CATEGORY_XML ) {
+			buff.append( "[XML]" );
+		}
+		else if( category == ICFLibMessageLog::CATEGORY_EXCEPTION ) {
+			buff.append( "[EXCEPTION]" );
+		}
+		else if( category == ICFLibMessageLog::CATEGORY_DB ) {
+			buff.append( "[DB]" );
+		}
+		else {
+			char fmt[16] = { 0 };
+			snprintf( &fmt[0], 16, "[0x%08x]", (unsigned)category );
+			buff.append( fmt );
+		}
+	}
+
+	void CFLibBinaryMessageLog::decodeFile( const std::string& fileName, std::ostream& out ) {
+		static const std::string S_ProcName( "decodeFile" );
+		static const std::string S_CouldNotAccess( "Could not access file " );
+		static const std::string S_ForReading( " for reading" );
+		static const std::string S_MsgNotBinaryLog( "File is not a binary message log: " );
+
+		std::ifstream input( fileName, std::ios::binary );
+		if( ! input.good() ) {
+			throw CFLibInvalidArgumentException( CLASS_NAME,
+				S_ProcName,
+				S_CouldNotAccess + fileName + S_ForReading );
+		}
+		char magic[sizeof( FILE_MAGIC )];
+		if( ( ! input.read( magic, sizeof( magic ) ) ) || ( memcmp( magic, FILE_MAGIC, sizeof( magic ) ) != 0 ) ) {
+			throw CFLibInvalidArgumentException( CLASS_NAME,
+				S_ProcName,
+				S_MsgNotBinaryLog + fileName );
+		}
+
+		decodeRecords( input, out );
+	}
+
+	void CFLibBinaryMessageLog::decodeRecords( std::istream& input, std::ostream& out ) {
+		static const std::string S_ProcName( "decodeRecords" );
+		static const std::string S_MsgUnknownRecord( "Unrecognized binary log record type" );
+		static const std::string S_MsgUnknownArg( "Unrecognized binary log argument type" );
+		static const std::string S_MsgUndefinedFormat( "Binary log refers to an undefined format id " );
+		static const std::string S_MsgUndefinedString( "Binary log refers to an undefined interned string id " );
+
+		CFLibBinaryMessageLogDecoder decoder( input );
+		std::unordered_map<uint32_t, std::string> formats;
+		std::unordered_map<uint32_t, std::string> strings;
+		std::string line;
+		for( ;; ) {
+			uint8_t recordType;
+			if( ! input.read( (char*)&recordType, 1 ) ) {
+				break;
+			}
+			if( recordType == RECORD_FORMAT ) {
+				uint32_t id = decoder.read<uint32_t>();
+				formats[id] = decoder.readBytes();
+				continue;
+			}
+			if( recordType == RECORD_STRING ) {
+				uint32_t id = decoder.read<uint32_t>();
+				strings[id] = decoder.readBytes();
+				continue;
+			}
+			if( ( recordType != RECORD_MESSAGE ) && ( recordType != RECORD_TEXT ) ) {
+				throw CFLibInvalidArgumentException( CLASS_NAME,
+					S_ProcName,
+					S_MsgUnknownRecord );
+			}
+
+			int64_t timestamp = decoder.read<int64_t>();
+			uint8_t level = decoder.read<uint8_t>();
+			uint32_t category = decoder.read<uint32_t>();
+			uint16_t indentLevel = decoder.read<uint16_t>();
+
+			line.clear();
+			formatTimestamp( line, timestamp, false );
+			line.push_back( ' ' );
+			formatLevel( line, level );
+			line.push_back( ' ' );
+			formatCategory( line, category );
+			line.push_back( ' ' );
+			line.append( indentLevel, '\t' );
+
+			if( recordType == RECORD_TEXT ) {
+				line.append( decoder.readBytes() );
+			}
+			else {
+				uint32_t formatId = decoder.read<uint32_t>();
+				auto foundFormat = formats.find( formatId );
+				if( foundFormat == formats.end() ) {
+					throw CFLibInvalidArgumentException( CLASS_NAME,
+						S_ProcName,
+						S_MsgUndefinedFormat + std::to_string( formatId ) );
+				}
+				const std::string& format = foundFormat->second;
+				uint8_t argCount = decoder.read<uint8_t>();
+				std::string::size_type fmtPos = 0;
+				for( uint8_t argIdx = 0; argIdx < argCount; argIdx++ ) {
+					std::string::size_type placeholder = format.find( "{}", fmtPos );
+					if( placeholder == std::string::npos ) {
+						placeholder = format.length();
+					}
+					line.append( format, fmtPos, placeholder - fmtPos );
+					fmtPos = ( placeholder < format.length() ) ? placeholder + 2 : placeholder;
+
+					uint8_t argType = decoder.read<uint8_t>();
+					if( argType == ARG_INT64 ) {
+						line.append( std::to_string( decoder.read<int64_t>() ) );
+					}
+					else if( argType == ARG_UINT64 ) {
+						line.append( std::to_string( decoder.read<uint64_t>() ) );
+					}
+					else if( argType == ARG_DOUBLE ) {
+						char fmt[64] = { 0 };
+						snprintf( &fmt[0], 64, "%g", decoder.read<double>() );
+						line.append( fmt );
+					}
+					else if( argType == ARG_STRING ) {
+						line.append( decoder.readBytes() );
+					}
+					else if( argType == ARG_INTERNED ) {
+						uint32_t stringId = decoder.read<uint32_t>();
+						auto foundString = strings.find( stringId );
+						if( foundString == strings.end() ) {
+							throw CFLibInvalidArgumentException( CLASS_NAME,
+								S_ProcName,
+								S_MsgUndefinedString + std::to_string( stringId ) );
+						}
+						line.append( foundString->second );
+					}
+					else if( argType == ARG_TIMESTAMP ) {
+						formatTimestamp( line, decoder.read<int64_t>(), true );
+					}
+					else {
+						throw CFLibInvalidArgumentException( CLASS_NAME,
+							S_ProcName,
+							S_MsgUnknownArg );
+					}
+				}
+				if( fmtPos < format.length() ) {
+					line.append( format, fmtPos, std::string::npos );
+				}
+			}
+			if( line.back() != '\n' ) {
+				line.push_back( '\n' );
+			}
+			out << line;
+		}
+	}
+}
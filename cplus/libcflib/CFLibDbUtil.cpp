@@ -47,24 +47,19 @@ namespace cflib {
 		dbServerTZOffsetSeconds = value;
 	}
 
+	std::chrono::system_clock::time_point CFLibDbUtil::getDbServerTimeFromUTCTimeInstance( const std::chrono::system_clock::time_point& value ) {
+		return( value + std::chrono::seconds( getDbServerTZOffsetSeconds() ) );
+	}
+
+	std::chrono::system_clock::time_point CFLibDbUtil::getUTCTimeFromDBServerTimeInstance( const std::chrono::system_clock::time_point& value ) {
+		return( value - std::chrono::seconds( getDbServerTZOffsetSeconds() ) );
+	}
+
 	std::chrono::system_clock::time_point* CFLibDbUtil::getDbServerTimeFromUTCTime( const std::chrono::system_clock::time_point* value ) {
 		if( value == NULL ) {
 			return( NULL );
 		}
-
-		std::time_t time = std::chrono::system_clock::to_time_t( *value );
-		// MSS TODO WORKING Need to convert UTC time to current system time
-		// time += CFLib::getUTCTimezoneOffset();
-		std::tm utc = *std::localtime( &time );
-#if ! defined(_WINDOWS)
-		utc.tm_gmtoff = getDbServerTZOffsetSeconds();
-		utc.tm_zone = NULL;
-#endif
-		time_t timeConverted = mktime( &utc );
-
-		std::chrono::duration<long,std::ratio<1>> *dur = new std::chrono::duration<long,std::ratio<1>>( timeConverted );
-		std::chrono::system_clock::time_point* retval = new std::chrono::system_clock::time_point( *dur );
-
+		std::chrono::system_clock::time_point* retval = new std::chrono::system_clock::time_point( getDbServerTimeFromUTCTimeInstance( *value ) );
 		return( retval );
 	}
 
@@ -72,20 +67,7 @@ namespace cflib {
 		if( value == NULL ) {
 			return( NULL );
 		}
-
-		std::time_t time = std::chrono::system_clock::to_time_t( *value );
-		time += getDbServerTZOffsetSeconds();
-		std::tm dbtime = *std::localtime( &time );
-		// MSS TODO WORKING Need to calculate tm_gmtoff from current system settings under WSL Ubuntu
-		// dbtime.tm_gmtoff = CFLib::getUTCTimezoneOffset();
-#if ! defined(_WINDOWS)
-		dbtime.tm_zone = NULL;
-#endif
-		time_t timeConverted = mktime( &dbtime );
-
-		std::chrono::duration<long,std::ratio<1>> *dur = new std::chrono::duration<long,std::ratio<1>>( timeConverted );
-		std::chrono::system_clock::time_point* retval = new std::chrono::system_clock::time_point( *dur );
-
+		std::chrono::system_clock::time_point* retval = new std::chrono::system_clock::time_point( getUTCTimeFromDBServerTimeInstance( *value ) );
 		return( retval );
 	}
 }
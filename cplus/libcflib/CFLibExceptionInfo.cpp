@@ -24,11 +24,35 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
+#include <any>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <ios>
+#include <memory>
+#include <new>
+#include <optional>
+#include <regex>
+#include <stdexcept>
+#include <system_error>
+#include <typeinfo>
+#include <variant>
+
+#include <xercesc/sax/SAXException.hpp>
+#include <xercesc/sax/SAXParseException.hpp>
+#include <xercesc/util/XMLString.hpp>
+
 #include <cflib/CFLib.hpp>
 #include <cflib/CFLibExceptionInfo.hpp>
+#include <cflib/CFLibRuntimeException.hpp>
+#include <cflib/CFLibXmlUtil.hpp>
 
 namespace cflib {
 
+	// Captured Xerces messages are held as UTF-16 in a std::u16string
+	static_assert( sizeof( XMLCh ) == sizeof( char16_t ), "XMLCh must be a 16-bit code unit" );
+
 	const std::string CFLibExceptionInfo::S_Empty( "" );
 	const std::string CFLibExceptionInfo::S_EXCEPTION( "Exception" );
 	const std::string CFLibExceptionInfo::S_CaughtXercesException( "Caught xerces " );
@@ -64,6 +88,15 @@ namespace cflib {
 	const std::string CFLibExceptionInfo::S_bad_variant_access( "bad_variant_access" );
 	const std::string CFLibExceptionInfo::S_std_exception( "exception" );
 
+	const int CFLibExceptionInfo::ARG_VALUE_TEXT = 0;
+	const int CFLibExceptionInfo::ARG_VALUE_INT64 = 1;
+	const int CFLibExceptionInfo::ARG_VALUE_UINT64 = 2;
+	const int CFLibExceptionInfo::ARG_VALUE_DOUBLE = 3;
+	const int CFLibExceptionInfo::ARG_VALUE_TIMESTAMP = 4;
+
+	const int CFLibExceptionInfo::ARG_BOUND_MIN = 0x1;
+	const int CFLibExceptionInfo::ARG_BOUND_MAX = 0x2;
+
 	CFLibExceptionInfo::~CFLibExceptionInfo() {
 	}
 
@@ -74,6 +107,11 @@ namespace cflib {
 		excClassFieldName = S_Empty;
 		excMethodName = S_Empty;
 		excArgOffset = -1LL;
+		excArgValueKind = ARG_VALUE_TEXT;
+		excArgBounds = 0;
+		excArgBoundText = NULL;
+		excXercesMessagePending = false;
+		excTextPending.store( false );
 		excArgName = S_Empty;
 		excArgValueString = S_Empty;
 		excArgMinValueString = S_Empty;
@@ -88,38 +126,75 @@ namespace cflib {
 		excClassFieldName = S_Empty;
 		excMethodName = S_Empty;
 		excArgOffset = -1LL;
+		excArgValueKind = ARG_VALUE_TEXT;
+		excArgBounds = 0;
+		excArgBoundText = NULL;
+		excXercesMessagePending = false;
+		excTextPending.store( false );
+		excXercesMessage.clear();
 		excArgName = S_Empty;
 		excArgValueString = S_Empty;
 		excArgMinValueString = S_Empty;
 		excArgMaxValueString = S_Empty;
 	}
 
-	CFLibExceptionInfo::CFLibExceptionInfo( const CFLibExceptionInfo& src ) {
-		excFlags = src.getFlags();
-		excCause = src.getCause();
-		excExceptionName = src.getExceptionName();
-		excClassFieldName = src.getClassFieldName();
-		excMethodName = src.getMethodName();
-		excArgOffset = src.getArgOffset();
-		excArgName = src.getArgName();
-		excArgValueString = src.getArgValueString();
-		excArgMinValueString = src.getArgMinValueString();
-		excArgMaxValueString = src.getArgMaxValueString();
-		excMessageText = src.getMessageText();
+	CFLibExceptionInfo::CFLibExceptionInfo( const CFLibExceptionInfo& src )
+	: CFLibExceptionInfo( src, std::lock_guard<std::mutex>( src.excTextLock ) )
+	{
+	}
+
+	// Pending raw values are copied raw, so copying an exception while
+	// it is being thrown and caught does not force its text to be formatted
+	CFLibExceptionInfo::CFLibExceptionInfo( const CFLibExceptionInfo& src, const std::lock_guard<std::mutex>& srcLocked )
+	: excFlags( src.excFlags ),
+	  excCause( src.excCause ),
+	  excExceptionName( src.excExceptionName ),
+	  excClassFieldName( src.excClassFieldName ),
+	  excMethodName( src.excMethodName ),
+	  excArgOffset( src.excArgOffset ),
+	  excArgName( src.excArgName ),
+	  excTextPending( src.excTextPending.load( std::memory_order_relaxed ) ),
+	  excArgValueKind( src.excArgValueKind ),
+	  excArgBounds( src.excArgBounds ),
+	  excArgRawValues{ src.excArgRawValues[0], src.excArgRawValues[1], src.excArgRawValues[2] },
+	  excArgBoundText( src.excArgBoundText ),
+	  excArgValueString( src.excArgValueString ),
+	  excArgMinValueString( src.excArgMinValueString ),
+	  excArgMaxValueString( src.excArgMaxValueString ),
+	  excMessageText( src.excMessageText ),
+	  excXercesMessagePending( src.excXercesMessagePending ),
+	  excXercesMessage( src.excXercesMessage )
+	{
 	}
 
 	CFLibExceptionInfo& CFLibExceptionInfo::operator =( const CFLibExceptionInfo& src ) {
-		excFlags = src.getFlags();
-		excCause = src.getCause();
-		excExceptionName = src.getExceptionName();
-		excClassFieldName = src.getClassFieldName();
-		excMethodName = src.getMethodName();
-		excArgOffset = src.getArgOffset();
-		excArgName = src.getArgName();
-		excArgValueString = src.getArgValueString();
-		excArgMinValueString = src.getArgMinValueString();
-		excArgMaxValueString = src.getArgMaxValueString();
-		excMessageText = src.getMessageText();
+		if( &src == this ) {
+			return *this;
+		}
+
+		std::lock_guard<std::mutex> srcLocked( src.excTextLock );
+
+		excFlags = src.excFlags;
+		excCause = src.excCause;
+		excExceptionName = src.excExceptionName;
+		excClassFieldName = src.excClassFieldName;
+		excMethodName = src.excMethodName;
+		excArgOffset = src.excArgOffset;
+		excArgName = src.excArgName;
+
+		excArgValueKind = src.excArgValueKind;
+		excArgRawValues[0] = src.excArgRawValues[0];
+		excArgRawValues[1] = src.excArgRawValues[1];
+		excArgRawValues[2] = src.excArgRawValues[2];
+		excArgBounds = src.excArgBounds;
+		excArgBoundText = src.excArgBoundText;
+		excArgValueString = src.excArgValueString;
+		excArgMinValueString = src.excArgMinValueString;
+		excArgMaxValueString = src.excArgMaxValueString;
+		excMessageText = src.excMessageText;
+		excXercesMessagePending = src.excXercesMessagePending;
+		excXercesMessage = src.excXercesMessage;
+		excTextPending.store( src.excTextPending.load( std::memory_order_relaxed ) );
 
 		return *this;
 	}
@@ -143,6 +218,11 @@ namespace cflib {
 		excClassFieldName = argClassFieldName;
 		excMethodName = argMethodName;
 		excArgOffset = argArgOffset;
+		excArgValueKind = ARG_VALUE_TEXT;
+		excArgBounds = 0;
+		excArgBoundText = NULL;
+		excXercesMessagePending = false;
+		excTextPending.store( false );
 		excArgName = argArgName;
 		excArgValueString = argArgValueString;
 		excArgMinValueString = argArgMinValueString;
@@ -167,6 +247,11 @@ namespace cflib {
 		excClassFieldName = argClassFieldName;
 		excMethodName = argMethodName;
 		excArgOffset = argArgOffset;
+		excArgValueKind = ARG_VALUE_TEXT;
+		excArgBounds = 0;
+		excArgBoundText = NULL;
+		excXercesMessagePending = false;
+		excTextPending.store( false );
 		excArgName = argArgName;
 		excArgValueString = argArgValueString;
 		excArgMinValueString = S_Empty;
@@ -188,6 +273,11 @@ namespace cflib {
 		excClassFieldName = argClassFieldName;
 		excMethodName = argMethodName;
 		excArgOffset = -1LL;
+		excArgValueKind = ARG_VALUE_TEXT;
+		excArgBounds = 0;
+		excArgBoundText = NULL;
+		excXercesMessagePending = false;
+		excTextPending.store( false );
 		excArgName = S_Empty;
 		excArgValueString = S_Empty;
 		excArgMinValueString = S_Empty;
@@ -208,6 +298,11 @@ namespace cflib {
 		excClassFieldName = argClassFieldName;
 		excMethodName = argMethodName;
 		excArgOffset = -1LL;
+		excArgValueKind = ARG_VALUE_TEXT;
+		excArgBounds = 0;
+		excArgBoundText = NULL;
+		excXercesMessagePending = false;
+		excTextPending.store( false );
 		excArgName = S_Empty;
 		excArgValueString = S_Empty;
 		excArgMinValueString = S_Empty;
@@ -227,6 +322,11 @@ namespace cflib {
 		excClassFieldName = argClassFieldName;
 		excMethodName = S_Empty;
 		excArgOffset = -1LL;
+		excArgValueKind = ARG_VALUE_TEXT;
+		excArgBounds = 0;
+		excArgBoundText = NULL;
+		excXercesMessagePending = false;
+		excTextPending.store( false );
 		excArgName = S_Empty;
 		excArgValueString = S_Empty;
 		excArgMinValueString = S_Empty;
@@ -245,6 +345,11 @@ namespace cflib {
 		excClassFieldName = argClassFieldName;
 		excMethodName = S_Empty;
 		excArgOffset = -1LL;
+		excArgValueKind = ARG_VALUE_TEXT;
+		excArgBounds = 0;
+		excArgBoundText = NULL;
+		excXercesMessagePending = false;
+		excTextPending.store( false );
 		excArgName = S_Empty;
 		excArgValueString = S_Empty;
 		excArgMinValueString = S_Empty;
@@ -262,6 +367,11 @@ namespace cflib {
 		excClassFieldName = S_Empty;
 		excMethodName = S_Empty;
 		excArgOffset = -1LL;
+		excArgValueKind = ARG_VALUE_TEXT;
+		excArgBounds = 0;
+		excArgBoundText = NULL;
+		excXercesMessagePending = false;
+		excTextPending.store( false );
 		excArgName = S_Empty;
 		excArgValueString = S_Empty;
 		excArgMinValueString = S_Empty;
@@ -314,66 +424,334 @@ namespace cflib {
 	}
 
 	void CFLibExceptionInfo::setArgName( const std::string& value ) {
+		formatPendingArgValues();
 		excArgName = value;
 	}
 
 	const std::string& CFLibExceptionInfo::getArgValueString() const {
+		formatPendingArgValues();
 		return( excArgValueString );
 	}
 
 	void CFLibExceptionInfo::setArgValueString( const std::string& value ) {
+		formatPendingArgValues();
 		excArgValueString = value;
 	}
 
 	const std::string& CFLibExceptionInfo::getArgMinValueString() const {
+		formatPendingArgValues();
 		return( excArgMinValueString );
 	}
 
 	void CFLibExceptionInfo::setArgMinValueString( const std::string& value ) {
+		formatPendingArgValues();
 		excArgMinValueString = value;
 	}
 
 	const std::string& CFLibExceptionInfo::getArgMaxValueString() const {
+		formatPendingArgValues();
 		return( excArgMaxValueString );
 	}
 
 	void CFLibExceptionInfo::setArgMaxValueString( const std::string& value ) {
+		formatPendingArgValues();
 		excArgMaxValueString = value;
 	}
 
 	const std::string& CFLibExceptionInfo::getMessageText() const {
+		formatPendingArgValues();
 		return( excMessageText );
 	}
 
 	std::string CFLibExceptionInfo::getMessageTextFirstLine() {
-		auto firstCR = excMessageText.find_first_of( '\r' );
-		auto firstNL = excMessageText.find_first_of( '\n' );
+		const std::string& messageText = getMessageText();
+		auto firstCR = messageText.find_first_of( '\r' );
+		auto firstNL = messageText.find_first_of( '\n' );
 		if( ( firstCR == std::string::npos ) && ( firstNL == std::string::npos ) ) {
-			return( excMessageText );
+			return( messageText );
 		}
 		else if( ( firstCR != std::string::npos ) && ( firstNL == std::string::npos ) ) {
-			return( excMessageText.substr( 0, firstCR ) );
+			return( messageText.substr( 0, firstCR ) );
 		}
 		else if( ( firstCR == std::string::npos ) && ( firstNL != std::string::npos ) ) {
-			return( excMessageText.substr( 0, firstNL ) );
+			return( messageText.substr( 0, firstNL ) );
 		}
 		else if( firstCR < firstNL ) {
-			return( excMessageText.substr( 0, firstCR ) );
+			return( messageText.substr( 0, firstCR ) );
 		}
 		else {
-			return( excMessageText.substr( 0, firstNL ) );
+			return( messageText.substr( 0, firstNL ) );
 		}
 	}
 
 	void CFLibExceptionInfo::setMessageText( const std::string& value ) {
+		formatPendingArgValues();
 		excMessageText = value;
 	}
 
+	void CFLibExceptionInfo::setArgBoundValues( const std::string& boundText, int argBounds, int64_t argValue, int64_t minValue, int64_t maxValue ) {
+		excArgValueKind = ARG_VALUE_INT64;
+		excArgBounds = argBounds;
+		excArgRawValues[0].int64Value = argValue;
+		excArgRawValues[1].int64Value = minValue;
+		excArgRawValues[2].int64Value = maxValue;
+		excArgBoundText = &boundText;
+		excTextPending.store( true );
+	}
+
+	void CFLibExceptionInfo::setArgBoundValues( const std::string& boundText, int argBounds, uint64_t argValue, uint64_t minValue, uint64_t maxValue ) {
+		excArgValueKind = ARG_VALUE_UINT64;
+		excArgBounds = argBounds;
+		excArgRawValues[0].uint64Value = argValue;
+		excArgRawValues[1].uint64Value = minValue;
+		excArgRawValues[2].uint64Value = maxValue;
+		excArgBoundText = &boundText;
+		excTextPending.store( true );
+	}
+
+	void CFLibExceptionInfo::setArgBoundValues( const std::string& boundText, int argBounds, double argValue, double minValue, double maxValue ) {
+		excArgValueKind = ARG_VALUE_DOUBLE;
+		excArgBounds = argBounds;
+		excArgRawValues[0].doubleValue = argValue;
+		excArgRawValues[1].doubleValue = minValue;
+		excArgRawValues[2].doubleValue = maxValue;
+		excArgBoundText = &boundText;
+		excTextPending.store( true );
+	}
+
+	void CFLibExceptionInfo::setArgBoundValues( const std::string& boundText, int argBounds,
+		const std::chrono::system_clock::time_point& argValue,
+		const std::chrono::system_clock::time_point& minValue,
+		const std::chrono::system_clock::time_point& maxValue )
+	{
+		excArgValueKind = ARG_VALUE_TIMESTAMP;
+		excArgBounds = argBounds;
+		excArgRawValues[0].int64Value = argValue.time_since_epoch().count();
+		excArgRawValues[1].int64Value = minValue.time_since_epoch().count();
+		excArgRawValues[2].int64Value = maxValue.time_since_epoch().count();
+		excArgBoundText = &boundText;
+		excTextPending.store( true );
+	}
+
+	void CFLibExceptionInfo::setArgBoundValues( const std::string& boundText, int argBounds,
+		const std::string& argValue,
+		const std::string& minValue,
+		const std::string& maxValue )
+	{
+		excArgValueKind = ARG_VALUE_TEXT;
+		excArgBounds = argBounds;
+		excArgValueString = argValue;
+		excArgMinValueString = minValue;
+		excArgMaxValueString = maxValue;
+		excArgBoundText = &boundText;
+		excTextPending.store( true );
+	}
+
+	static std::string formatArgRawValue( int kind, const cflibexcargvalue_t& value ) {
+		if( kind == CFLibExceptionInfo::ARG_VALUE_INT64 ) {
+			return( std::to_string( value.int64Value ) );
+		}
+		else if( kind == CFLibExceptionInfo::ARG_VALUE_UINT64 ) {
+			return( std::to_string( value.uint64Value ) );
+		}
+		else if( kind == CFLibExceptionInfo::ARG_VALUE_DOUBLE ) {
+			return( std::to_string( value.doubleValue ) );
+		}
+		else {
+			std::chrono::system_clock::time_point timestamp{ std::chrono::system_clock::duration( value.int64Value ) };
+			return( CFLibXmlUtil::formatTimestamp( timestamp ) );
+		}
+	}
+
+	void CFLibExceptionInfo::formatPendingArgValues() const {
+		if( ! excTextPending.load( std::memory_order_acquire ) ) {
+			return;
+		}
+		std::lock_guard<std::mutex> guard( excTextLock );
+		if( excTextPending.load( std::memory_order_relaxed ) ) {
+			formatPendingArgValuesLocked();
+			excTextPending.store( false, std::memory_order_release );
+		}
+	}
+
+	void CFLibExceptionInfo::formatPendingArgValuesLocked() const {
+		if( excArgValueKind != ARG_VALUE_TEXT ) {
+			excArgValueString = formatArgRawValue( excArgValueKind, excArgRawValues[0] );
+			if( ( excArgBounds & ARG_BOUND_MIN ) != 0 ) {
+				excArgMinValueString = formatArgRawValue( excArgValueKind, excArgRawValues[1] );
+			}
+			if( ( excArgBounds & ARG_BOUND_MAX ) != 0 ) {
+				excArgMaxValueString = formatArgRawValue( excArgValueKind, excArgRawValues[2] );
+			}
+			excArgValueKind = ARG_VALUE_TEXT;
+		}
+		if( excArgBoundText != NULL ) {
+			const std::string* boundText = excArgBoundText;
+			excArgBoundText = NULL;
+			excMessageText.clear();
+			excMessageText.append( excArgName );
+			excMessageText.append( CFLib::S_SPACE );
+			excMessageText.append( CFLib::S_VALUE_SPACE );
+			excMessageText.append( excArgValueString );
+			excMessageText.append( *boundText );
+			if( ( excArgBounds & ARG_BOUND_MIN ) != 0 ) {
+				excMessageText.append( excArgMinValueString );
+			}
+			if( ( ( excArgBounds & ARG_BOUND_MIN ) != 0 ) && ( ( excArgBounds & ARG_BOUND_MAX ) != 0 ) ) {
+				excMessageText.append( CFLib::S_DOT_DOT );
+			}
+			if( ( excArgBounds & ARG_BOUND_MAX ) != 0 ) {
+				excMessageText.append( excArgMaxValueString );
+			}
+		}
+		if( excXercesMessagePending ) {
+			excXercesMessagePending = false;
+			excMessageText.clear();
+			char* cUseMessage = xercesc::XMLString::transcode( reinterpret_cast<const XMLCh*>( excXercesMessage.c_str() ) );
+			if( cUseMessage != NULL ) {
+				excMessageText.append( cUseMessage );
+				xercesc::XMLString::release( &cUseMessage );
+			}
+			excXercesMessage.clear();
+		}
+	}
+
+	void CFLibExceptionInfo::captureXercesException( const std::string& exceptionName,
+		const std::string& className,
+		const std::string& methodName,
+		const char16_t* message )
+	{
+		reset();
+		excFlags = CFLIB_EXCEPT_XERCES;
+		excCause = S_CaughtXercesException;
+		excExceptionName = exceptionName;
+		excClassFieldName = className;
+		excMethodName = methodName;
+		excMessageText.clear();
+		if( message != NULL ) {
+			excXercesMessage.assign( message );
+			excXercesMessagePending = true;
+			excTextPending.store( true );
+		}
+	}
+
+	void CFLibExceptionInfo::captureSystemException( const std::string& exceptionName,
+		const std::string& className,
+		const std::string& methodName,
+		const char* message )
+	{
+		reset();
+		excFlags = CFLIB_EXCEPT_SYSTEM;
+		excCause = S_CaughtSystemException;
+		excExceptionName = exceptionName;
+		excClassFieldName = className;
+		excMethodName = methodName;
+		excMessageText.assign( message );
+	}
+
+	bool CFLibExceptionInfo::captureCurrentException( const std::string& className, const std::string& methodName ) {
+		std::exception_ptr current = std::current_exception();
+		if( current == NULL ) {
+			return( false );
+		}
+		try {
+			std::rethrow_exception( current );
+		}
+		catch( const CFLibRuntimeException& e ) {
+			*this = e;
+		}
+		catch( const xercesc::SAXNotRecognizedException& e ) {
+			captureXercesException( S_SAXNotRecognizedException, className, methodName, reinterpret_cast<const char16_t*>( e.getMessage() ) );
+		}
+		catch( const xercesc::SAXNotSupportedException& e ) {
+			captureXercesException( S_SAXNotSupportedException, className, methodName, reinterpret_cast<const char16_t*>( e.getMessage() ) );
+		}
+		catch( const xercesc::SAXParseException& e ) {
+			captureXercesException( S_SAXParseException, className, methodName, reinterpret_cast<const char16_t*>( e.getMessage() ) );
+		}
+		catch( const xercesc::SAXException& e ) {
+			captureXercesException( S_SAXException, className, methodName, reinterpret_cast<const char16_t*>( e.getMessage() ) );
+		}
+		catch( const std::invalid_argument& e ) {
+			captureSystemException( S_invalid_argument, className, methodName, e.what() );
+		}
+		catch( const std::domain_error& e ) {
+			captureSystemException( S_domain_error, className, methodName, e.what() );
+		}
+		catch( const std::length_error& e ) {
+			captureSystemException( S_length_error, className, methodName, e.what() );
+		}
+		catch( const std::out_of_range& e ) {
+			captureSystemException( S_out_of_range, className, methodName, e.what() );
+		}
+		catch( const std::future_error& e ) {
+			captureSystemException( S_future_error, className, methodName, e.what() );
+		}
+		catch( const std::logic_error& e ) {
+			captureSystemException( S_logic_error, className, methodName, e.what() );
+		}
+		catch( const std::bad_optional_access& e ) {
+			captureSystemException( S_bad_optional_access, className, methodName, e.what() );
+		}
+		catch( const std::range_error& e ) {
+			captureSystemException( S_range_error, className, methodName, e.what() );
+		}
+		catch( const std::overflow_error& e ) {
+			captureSystemException( S_overflow_error, className, methodName, e.what() );
+		}
+		catch( const std::regex_error& e ) {
+			captureSystemException( S_regex_error, className, methodName, e.what() );
+		}
+		catch( const std::ios_base::failure& e ) {
+			captureSystemException( S_ios_base_failure, className, methodName, e.what() );
+		}
+		catch( const std::filesystem::filesystem_error& e ) {
+			captureSystemException( S_filesystem_error, className, methodName, e.what() );
+		}
+		catch( const std::system_error& e ) {
+			captureSystemException( S_system_error, className, methodName, e.what() );
+		}
+		catch( const std::bad_typeid& e ) {
+			captureSystemException( S_bad_typeid, className, methodName, e.what() );
+		}
+		catch( const std::bad_any_cast& e ) {
+			captureSystemException( S_bad_any_cast, className, methodName, e.what() );
+		}
+		catch( const std::bad_cast& e ) {
+			captureSystemException( S_bad_cast, className, methodName, e.what() );
+		}
+		catch( const std::bad_weak_ptr& e ) {
+			captureSystemException( S_bad_weak_ptr, className, methodName, e.what() );
+		}
+		catch( const std::bad_function_call& e ) {
+			captureSystemException( S_bad_function_call, className, methodName, e.what() );
+		}
+		catch( const std::bad_array_new_length& e ) {
+			captureSystemException( S_bad_array_new_length, className, methodName, e.what() );
+		}
+		catch( const std::bad_alloc& e ) {
+			captureSystemException( S_bad_alloc, className, methodName, e.what() );
+		}
+		catch( const std::bad_exception& e ) {
+			captureSystemException( S_bad_exception, className, methodName, e.what() );
+		}
+		catch( const std::bad_variant_access& e ) {
+			captureSystemException( S_bad_variant_access, className, methodName, e.what() );
+		}
+		catch( const std::exception& e ) {
+			captureSystemException( S_std_exception, className, methodName, e.what() );
+		}
+		catch( ... ) {
+			return( false );
+		}
+		return( true );
+	}
+
 	std::string CFLibExceptionInfo::getFormattedSystemText( 
 		const std::string& argExceptionName,
 		const std::string& argClassFieldName,
 		const std::string& argMethodName,
-		const std::string& argMessageText )
+		const std::string& argMessageText ) const
 	{
 		std::string retval( S_CaughtSystemException );
 
@@ -398,7 +776,7 @@ namespace cflib {
 		const std::string& argExceptionName,
 		const std::string& argClassFieldName,
 		const std::string& argMethodName,
-		const std::string& argMessageText )
+		const std::string& argMessageText ) const
 	{
 		std::string retval( S_CaughtXercesException );
 
@@ -429,7 +807,7 @@ namespace cflib {
 		const std::string& argArgValueString,
 		const std::string& argArgMinValueString,
 		const std::string& argArgMaxValueString,
-		const std::string& argMessageText )
+		const std::string& argMessageText ) const
 	{
 		static const std::string S_Argument( " argument " );
 
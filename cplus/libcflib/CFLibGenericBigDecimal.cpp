@@ -55,6 +55,8 @@ namespace cflib {
 	const std::string CFLibGenericBigDecimal::S_MpfrFunctionRoundedUp( "MPFR function rounded up the result" );
 	const std::string CFLibGenericBigDecimal::S_MpfrSetStr( "mpfr_set_str" );
 	const std::string CFLibGenericBigDecimal::S_BaseArg3CannotBeOne( "base (arg 3) cannot be 1" );
+	const std::string CFLibGenericBigDecimal::S_BelowAbsoluteMinValue( "Value is less than the minimum of the digits and precision" );
+	const std::string CFLibGenericBigDecimal::S_AboveAbsoluteMaxValue( "Value is greater than the maximum of the digits and precision" );
 
 	const int CFLibGenericBigDecimal::MIN_DIGITS = 1;
 	const int CFLibGenericBigDecimal::MAX_DIGITS = ((( MPFR_PREC_MAX / 8 ) - 1) > 1990 ) ? 1990 : ((int)(( MPFR_PREC_MAX / 8 ) - 1 ));
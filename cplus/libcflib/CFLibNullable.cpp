@@ -24,31 +24,31 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cflib/CFLib.hpp>
-#include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
+#include <cflib/CFLibNullArgumentException.hpp>
 
 namespace cflib {
 
 const std::string CFLibNullable::S_GET_VALUE( "getValue" );
 const std::string CFLibNullable::S_VALUE( "value" );
 
-CFLibNullable::CFLibNullable() {
-	nullFlag = true;
-}
-
-CFLibNullable::CFLibNullable( const bool value ) {
-	nullFlag = value;
-}
-
-CFLibNullable::~CFLibNullable() {
-}
-
-const bool CFLibNullable::isNull() const {
-	return( nullFlag );
-}
-
-void CFLibNullable::setNullFlag( const bool value ) {
-	nullFlag = value;
+template<> const std::string TCFLibNullable<bool>::CLASS_NAME( "CFLibNullableBool" );
+template<> const std::string TCFLibNullable<int16_t>::CLASS_NAME( "CFLibNullableInt16" );
+template<> const std::string TCFLibNullable<int32_t>::CLASS_NAME( "CFLibNullableInt32" );
+template<> const std::string TCFLibNullable<int64_t>::CLASS_NAME( "CFLibNullableInt64" );
+template<> const std::string TCFLibNullable<uint16_t>::CLASS_NAME( "CFLibNullableUInt16" );
+template<> const std::string TCFLibNullable<uint32_t>::CLASS_NAME( "CFLibNullableUInt32" );
+template<> const std::string TCFLibNullable<uint64_t>::CLASS_NAME( "CFLibNullableUInt64" );
+template<> const std::string TCFLibNullable<float>::CLASS_NAME( "CFLibNullableFloat" );
+template<> const std::string TCFLibNullable<double>::CLASS_NAME( "CFLibNullableDouble" );
+template<> const std::string TCFLibNullable<float, true>::CLASS_NAME( "CFLibPackedNullableFloat" );
+template<> const std::string TCFLibNullable<double, true>::CLASS_NAME( "CFLibPackedNullableDouble" );
+
+void CFLibNullable::throwNullValue( const std::string& className ) {
+	throw CFLibNullArgumentException( className,
+		S_GET_VALUE,
+		0,
+		S_VALUE );
 }
 
 }
@@ -0,0 +1,187 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <chrono>
+#include <ctime>
+#include <thread>
+
+#include <cflib/CFLib.hpp>
+#include <cflib/ICFLibPublic.hpp>
+#include <cflib/CFLibRingBufferMessageLog.hpp>
+
+namespace cflib {
+
+	const std::string CFLibRingBufferMessageLog::CLASS_NAME( "CFLibRingBufferMessageLog" );
+	const uint32_t CFLibRingBufferMessageLog::DEFAULT_CAPACITY = 4096;
+
+	CFLibRingBufferMessageLog::CFLibRingBufferMessageLog( uint32_t capacity ) {
+		static const std::string S_ProcName( "construct" );
+		static const std::string S_ArgCapacity( "capacity" );
+		if( ( capacity < 1 ) || ( capacity > 0x40000000 ) ) {
+			throw CFLibArgumentRangeException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgCapacity,
+				(int64_t)capacity,
+				(int64_t)1,
+				(int64_t)0x40000000 );
+		}
+		uint64_t recordCount = 1;
+		while( recordCount < capacity ) {
+			recordCount <<= 1;
+		}
+		records = new Record[recordCount];
+		for( uint64_t i = 0; i < recordCount; i++ ) {
+			records[i].busy.clear();
+			// No record has been written for the first lap of tickets yet
+			records[i].ticket = UINT64_MAX;
+			records[i].timestampNanos = 0;
+			records[i].threadNumber = 0;
+			records[i].indentLevel = 0;
+		}
+		recordMask = recordCount - 1;
+		nextTicket.store( 0 );
+		clearedTicket.store( 0 );
+		ndnt.store( 0 );
+	}
+
+	CFLibRingBufferMessageLog::~CFLibRingBufferMessageLog() {
+		if( records != NULL ) {
+			delete[] records;
+			records = NULL;
+		}
+	}
+
+	uint32_t CFLibRingBufferMessageLog::getThreadNumber() {
+		static std::atomic<uint32_t> threadCount( 0 );
+		thread_local uint32_t threadNumber = threadCount.fetch_add( 1, std::memory_order_relaxed ) + 1;
+		return( threadNumber );
+	}
+
+	void CFLibRingBufferMessageLog::message( const std::string& msg ) {
+		uint64_t ticket = nextTicket.fetch_add( 1, std::memory_order_relaxed );
+		Record& record = records[ ticket & recordMask ];
+		int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::system_clock::now().time_since_epoch() ).count();
+		while( record.busy.test_and_set( std::memory_order_acquire ) ) {
+			std::this_thread::yield();
+		}
+		// A slower writer from an earlier lap must not overwrite a newer record
+		if( ( record.ticket == UINT64_MAX ) || ( record.ticket < ticket ) ) {
+			record.ticket = ticket;
+			record.timestampNanos = now;
+			record.threadNumber = getThreadNumber();
+			record.indentLevel = ndnt.load( std::memory_order_relaxed );
+			record.text.assign( msg );
+		}
+		record.busy.clear( std::memory_order_release );
+	}
+
+	void CFLibRingBufferMessageLog::clearCache() {
+		clearedTicket.store( nextTicket.load( std::memory_order_acquire ), std::memory_order_release );
+		rendered.clear();
+	}
+
+	uint64_t CFLibRingBufferMessageLog::getMessageCount() const {
+		return( nextTicket.load( std::memory_order_acquire ) - clearedTicket.load( std::memory_order_acquire ) );
+	}
+
+	uint64_t CFLibRingBufferMessageLog::getCapacity() const {
+		return( recordMask + 1 );
+	}
+
+	uint64_t CFLibRingBufferMessageLog::getRecordCount() const {
+		uint64_t count = getMessageCount();
+		return( ( count < getCapacity() ) ? count : getCapacity() );
+	}
+
+	const std::string& CFLibRingBufferMessageLog::getCacheContents() const {
+		rendered.clear();
+		uint64_t end = nextTicket.load( std::memory_order_acquire );
+		uint64_t begin = clearedTicket.load( std::memory_order_acquire );
+		if( end - begin > getCapacity() ) {
+			begin = end - getCapacity();
+		}
+		std::string text;
+		for( uint64_t ticket = begin; ticket < end; ticket++ ) {
+			Record& record = records[ ticket & recordMask ];
+			while( record.busy.test_and_set( std::memory_order_acquire ) ) {
+				std::this_thread::yield();
+			}
+			bool current = ( record.ticket == ticket );
+			int64_t timestampNanos = record.timestampNanos;
+			uint32_t threadNumber = record.threadNumber;
+			int indentLevel = record.indentLevel;
+			if( current ) {
+				text.assign( record.text );
+			}
+			record.busy.clear( std::memory_order_release );
+			// Skip slots still being filled, or already overwritten by a later lap
+			if( ! current ) {
+				continue;
+			}
+
+			time_t systime = (time_t)( timestampNanos / 1000000000 );
+			struct tm tms;
+			gmtime_r( &systime, &tms );
+			char fmt[64] = { 0 };
+			snprintf( &fmt[0], 64, "%04d-%02d-%02d %02d:%02d:%02d.%06d [%u] ",
+				tms.tm_year + 1900, tms.tm_mon + 1, tms.tm_mday,
+				tms.tm_hour, tms.tm_min, tms.tm_sec,
+				(int)( ( timestampNanos % 1000000000 ) / 1000 ),
+				threadNumber );
+			rendered.append( fmt );
+			rendered.append( indentLevel, '\t' );
+			rendered.append( text );
+			if( rendered.back() != '\n' ) {
+				rendered.push_back( '\n' );
+			}
+		}
+		return( rendered );
+	}
+
+	int CFLibRingBufferMessageLog::getMessageLogIndent() const {
+		return( ndnt.load( std::memory_order_relaxed ) );
+	}
+
+	void CFLibRingBufferMessageLog::dedent() {
+		int cur = ndnt.load( std::memory_order_relaxed );
+		while( ( cur > 0 ) && ! ndnt.compare_exchange_weak( cur, cur - 1, std::memory_order_relaxed ) ) {
+		}
+	}
+
+	void CFLibRingBufferMessageLog::indent() {
+		ndnt.fetch_add( 1, std::memory_order_relaxed );
+	}
+
+	void CFLibRingBufferMessageLog::openLogFile( const std::string& fileName ) {
+		// Do-nothing stub; ring buffer logs don't write to files
+	}
+
+	void CFLibRingBufferMessageLog::closeLogFile() {
+		// Do-nothing stub; ring buffer logs don't write to files
+	}
+}
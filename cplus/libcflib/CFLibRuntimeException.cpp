@@ -36,27 +36,64 @@ namespace cflib {
 	CFLibRuntimeException::~CFLibRuntimeException() {
 	}
 
+	const std::runtime_error& CFLibRuntimeException::getDeferredWhat() {
+		static const std::runtime_error deferredWhat( CAUSE_NAME );
+		return( deferredWhat );
+	}
+
+	const char* CFLibRuntimeException::what() const noexcept {
+		if( ! excWhatFormatted.load( std::memory_order_acquire ) ) {
+			try {
+				// Format any deferred argument values before taking excTextLock,
+				// so the accessors below find nothing pending and never lock it.
+				formatPendingArgValues();
+				std::lock_guard<std::mutex> guard( excTextLock );
+				if( ! excWhatFormatted.load( std::memory_order_relaxed ) ) {
+					excWhatText = getFormattedText(
+						getCause(),
+						getExceptionName(),
+						getClassFieldName(),
+						getMethodName(),
+						getArgOffset(),
+						getArgName(),
+						getArgValueString(),
+						getArgMinValueString(),
+						getArgMaxValueString(),
+						getMessageText() );
+					excWhatFormatted.store( true, std::memory_order_release );
+				}
+			}
+			catch( ... ) {
+				return( getCause().c_str() );
+			}
+		}
+		return( excWhatText.c_str() );
+	}
+
+	CFLibRuntimeException& CFLibRuntimeException::operator =( const CFLibRuntimeException& src ) {
+		if( &src == this ) {
+			return *this;
+		}
+		CFLibExceptionInfo::operator =( src );
+		std::runtime_error::operator =( src );
+		excWhatFormatted.store( false );
+		excWhatText.clear();
+		return *this;
+	}
+
 	CFLibRuntimeException::CFLibRuntimeException(
 		const CFLibRuntimeException& src )
 	: cflib::CFLibExceptionInfo( src ),
-	  std::runtime_error( src )
+	  std::runtime_error( src ),
+	  excWhatFormatted( false )
 	{
 	}
 
 	CFLibRuntimeException::CFLibRuntimeException(
 		CFLibExceptionInfo& src )
 	: cflib::CFLibExceptionInfo( src ),
-	  std::runtime_error( cflib::CFLibExceptionInfo::getFormattedText(
-			src.getCause(),				// Cause
-			src.getExceptionName(),		// ExceptionName
-			src.getClassFieldName(),	// argClassFieldName
-			src.getMethodName(),		// argMethodName
-			src.getArgOffset(),			// argArgOffset
-			src.getArgName(),			// argArgName
-			src.getArgValueString(),	// argArgValueString,
-			src.getArgMinValueString(),	// argArgMinValueString
-			src.getArgMaxValueString(),	// argArgMaxValueString
-			src.getMessageText() ) )	// argMessageText
+	  std::runtime_error( getDeferredWhat() ),
+	  excWhatFormatted( false )
 	{
 	}
 
@@ -73,17 +110,8 @@ namespace cflib {
 			S_Empty,					// argArgMinValueString
 			S_Empty,					// argArgMaxValueString
 			S_Empty ),					// argMessageText
-		std::runtime_error( cflib::CFLibExceptionInfo::getFormattedText(
-			CAUSE_NAME,					// Cause
-			CLASS_NAME,					// ExceptionName
-			S_Empty,					// argClassFieldName
-			S_Empty,					// argMethodName
-			0LL,						// argArgOffset
-			S_Empty,					// argArgName
-			S_Empty,					// argArgValueString,
-			S_Empty,					// argArgMinValueString
-			S_Empty,					// argArgMaxValueString
-			S_Empty ) )					// argMessageText
+		std::runtime_error( getDeferredWhat() ),
+		excWhatFormatted( false )
 	{
 	}
 
@@ -110,17 +138,8 @@ namespace cflib {
 			argArgMinValueString,		// argArgMinValueString
 			argArgMaxValueString,		// argArgMaxValueString
 			argMessageText ),			// argMessageText
-		std::runtime_error( cflib::CFLibExceptionInfo::getFormattedText(
-			argCause,					// Cause
-			argExceptionName,			// ExceptionName
-			argClassFieldName,			// argClassFieldName
-			argMethodName,				// argMethodName
-			argArgOffset,				// argArgOffset
-			argArgName,					// argArgName
-			argArgValueString,			// argArgValueString,
-			argArgMinValueString,		// argArgMinValueString
-			argArgMaxValueString,		// argArgMaxValueString
-			argMessageText ) )			// argMessageText
+		std::runtime_error( getDeferredWhat() ),
+		excWhatFormatted( false )
 	{
 	}
 
@@ -145,17 +164,8 @@ namespace cflib {
 			S_Empty,					// argArgMinValueString
 			S_Empty,					// argArgMaxValueString
 			argMessageText ),			// argMessageText
-		std::runtime_error( cflib::CFLibExceptionInfo::getFormattedText(
-			argCause,					// Cause
-			argExceptionName,			// ExceptionName
-			argClassFieldName,			// argClassFieldName
-			argMethodName,				// argMethodName
-			argArgOffset,				// argArgOffset
-			argArgName,					// argArgName
-			argArgValueString,			// argArgValueString,
-			S_Empty,					// argArgMinValueString
-			S_Empty,					// argArgMaxValueString
-			argMessageText ) )			// argMessageText
+		std::runtime_error( getDeferredWhat() ),
+		excWhatFormatted( false )
 	{
 	}
 
@@ -177,17 +187,8 @@ namespace cflib {
 			S_Empty,					// argArgMinValueString
 			S_Empty,					// argArgMaxValueString
 			argMessageText ),			// argMessageText
-		std::runtime_error( cflib::CFLibExceptionInfo::getFormattedText(
-			argCause,					// Cause
-			argExceptionName,			// ExceptionName
-			argClassFieldName,			// argClassFieldName
-			argMethodName,				// argMethodName
-			0LL,						// argArgOffset
-			S_Empty,					// argArgName
-			S_Empty,					// argArgValueString,
-			S_Empty,					// argArgMinValueString
-			S_Empty,					// argArgMaxValueString
-			argMessageText ) )			// argMessageText
+		std::runtime_error( getDeferredWhat() ),
+		excWhatFormatted( false )
 	{
 	}
 
@@ -208,17 +209,8 @@ namespace cflib {
 			S_Empty,					// argArgMinValueString
 			S_Empty,					// argArgMaxValueString
 			argMessageText ),			// argMessageText
-		std::runtime_error( cflib::CFLibExceptionInfo::getFormattedText(
-			argCause,					// Cause
-			CLASS_NAME,					// ExceptionName
-			argClassFieldName,			// argClassFieldName
-			argMethodName,				// argMethodName
-			0LL,						// argArgOffset
-			S_Empty,					// argArgName
-			S_Empty,					// argArgValueString,
-			S_Empty,					// argArgMinValueString
-			S_Empty,					// argArgMaxValueString
-			argMessageText ) )			// argMessageText
+		std::runtime_error( getDeferredWhat() ),
+		excWhatFormatted( false )
 	{
 	}
 
@@ -240,17 +232,8 @@ namespace cflib {
 			S_Empty,					// argArgMinValueString
 			S_Empty,					// argArgMaxValueString
 			msg ),						// argMessageText
-		std::runtime_error( cflib::CFLibExceptionInfo::getFormattedText(
-			CAUSE_NAME,					// Cause
-			CLASS_NAME,					// ExceptionName
-			argClassFieldName,			// argClassFieldName
-			methName,					// argMethodName
-			argOffset,					// argArgOffset
-			argName,					// argArgName
-			S_Empty,					// argArgValueString,
-			S_Empty,					// argArgMinValueString
-			S_Empty,					// argArgMaxValueString
-			msg ) )						// argMessageText
+		std::runtime_error( getDeferredWhat() ),
+		excWhatFormatted( false )
 	{
 	}
 
@@ -270,17 +253,8 @@ namespace cflib {
 			S_Empty,					// argArgMinValueString
 			S_Empty,					// argArgMaxValueString
 			msg ),						// argMessageText
-		std::runtime_error( cflib::CFLibExceptionInfo::getFormattedText(
-			CAUSE_NAME,					// Cause
-			CLASS_NAME,					// ExceptionName
-			argClassFieldName,			// argClassFieldName
-			methName,					// argMethodName
-			0LL,						// argArgOffset
-			S_Empty,					// argArgName
-			S_Empty,					// argArgValueString,
-			S_Empty,					// argArgMinValueString
-			S_Empty,					// argArgMaxValueString
-			msg ) )						// argMessageText
+		std::runtime_error( getDeferredWhat() ),
+		excWhatFormatted( false )
 	{
 	}
 
@@ -299,17 +273,8 @@ namespace cflib {
 			S_Empty,					// argArgMinValueString
 			S_Empty,					// argArgMaxValueString
 			msg ),						// argMessageText
-		std::runtime_error( cflib::CFLibExceptionInfo::getFormattedText(
-			CAUSE_NAME,					// Cause
-			CLASS_NAME,					// ExceptionName
-			fieldName,					// argClassFieldName
-			S_Empty,					// argMethodName
-			0LL,						// argArgOffset
-			S_Empty,					// argArgName
-			S_Empty,					// argArgValueString,
-			S_Empty,					// argArgMinValueString
-			S_Empty,					// argArgMaxValueString
-			msg ) )						// argMessageText
+		std::runtime_error( getDeferredWhat() ),
+		excWhatFormatted( false )
 	{
 	}
 
@@ -327,17 +292,8 @@ namespace cflib {
 			S_Empty,					// argArgMinValueString
 			S_Empty,					// argArgMaxValueString
 			msg ),						// argMessageText
-		std::runtime_error( cflib::CFLibExceptionInfo::getFormattedText(
-			CAUSE_NAME,					// Cause
-			CLASS_NAME,					// ExceptionName
-			S_Empty,					// argClassFieldName
-			S_Empty,					// argMethodName
-			0LL,						// argArgOffset
-			S_Empty,					// argArgName
-			S_Empty,					// argArgValueString,
-			S_Empty,					// argArgMinValueString
-			S_Empty,					// argArgMaxValueString
-			msg ) )						// argMessageText
+		std::runtime_error( getDeferredWhat() ),
+		excWhatFormatted( false )
 	{
 	}
 }
@@ -0,0 +1,296 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cflib/CFLibStatus.hpp>
+#include <cflib/CFLibXmlUtil.hpp>
+#include <cflib/CFLibNullArgumentException.hpp>
+#include <cflib/CFLibInvalidArgumentException.hpp>
+#include <cflib/CFLibArgumentOverflowException.hpp>
+#include <cflib/CFLibArgumentUnderflowException.hpp>
+#include <cflib/CFLibArgumentRangeException.hpp>
+
+namespace cflib {
+
+	const std::string CFLibStatus::CLASS_NAME( "CFLibStatus" );
+
+	const int CFLibStatus::STATUS_OK = 0;
+	const int CFLibStatus::STATUS_NULL = 1;
+	const int CFLibStatus::STATUS_INVALID_ARGUMENT = 2;
+	const int CFLibStatus::STATUS_OVERFLOW = 3;
+	const int CFLibStatus::STATUS_UNDERFLOW = 4;
+
+	CFLibStatus::CFLibStatus() {
+		statusCode = STATUS_OK;
+		argOffset = 0;
+		className = &CFLibExceptionInfo::S_Empty;
+		methodName = &CFLibExceptionInfo::S_Empty;
+		boundKind = CFLibExceptionInfo::ARG_VALUE_TEXT;
+		bound.int64Value = 0;
+	}
+
+	CFLibStatus::CFLibStatus( int argStatusCode,
+		const std::string& argClassName,
+		const std::string& argMethodName,
+		size_t argArgOffset,
+		const std::string& argArgName,
+		const std::string& argArgValue,
+		const std::string& argDetail )
+	: argName( argArgName ),
+	  argValue( argArgValue ),
+	  detail( argDetail )
+	{
+		statusCode = argStatusCode;
+		argOffset = argArgOffset;
+		className = &argClassName;
+		methodName = &argMethodName;
+		boundKind = CFLibExceptionInfo::ARG_VALUE_TEXT;
+		bound.int64Value = 0;
+	}
+
+	CFLibStatus::CFLibStatus( const CFLibStatus& src )
+	: argName( src.argName ),
+	  argValue( src.argValue ),
+	  detail( src.detail )
+	{
+		statusCode = src.statusCode;
+		argOffset = src.argOffset;
+		className = src.className;
+		methodName = src.methodName;
+		boundKind = src.boundKind;
+		bound = src.bound;
+	}
+
+	CFLibStatus& CFLibStatus::operator =( const CFLibStatus& src ) {
+		statusCode = src.statusCode;
+		argOffset = src.argOffset;
+		className = src.className;
+		methodName = src.methodName;
+		argName = src.argName;
+		argValue = src.argValue;
+		detail = src.detail;
+		boundKind = src.boundKind;
+		bound = src.bound;
+		return( *this );
+	}
+
+	CFLibStatus::~CFLibStatus() {
+	}
+
+	const std::string& CFLibStatus::getClassName() const {
+		return( *className );
+	}
+
+	const std::string& CFLibStatus::getMethodName() const {
+		return( *methodName );
+	}
+
+	size_t CFLibStatus::getArgOffset() const {
+		return( argOffset );
+	}
+
+	const std::string& CFLibStatus::getArgName() const {
+		return( argName );
+	}
+
+	const std::string& CFLibStatus::getArgValue() const {
+		return( argValue );
+	}
+
+	const std::string& CFLibStatus::getDetail() const {
+		return( detail );
+	}
+
+	void CFLibStatus::setBound( int64_t value ) {
+		boundKind = CFLibExceptionInfo::ARG_VALUE_INT64;
+		bound.int64Value = value;
+	}
+
+	void CFLibStatus::setBound( uint64_t value ) {
+		boundKind = CFLibExceptionInfo::ARG_VALUE_UINT64;
+		bound.uint64Value = value;
+	}
+
+	void CFLibStatus::setBound( double value ) {
+		boundKind = CFLibExceptionInfo::ARG_VALUE_DOUBLE;
+		bound.doubleValue = value;
+	}
+
+	std::string CFLibStatus::getBoundString() const {
+		if( boundKind == CFLibExceptionInfo::ARG_VALUE_INT64 ) {
+			return( std::to_string( bound.int64Value ) );
+		}
+		else if( boundKind == CFLibExceptionInfo::ARG_VALUE_UINT64 ) {
+			return( std::to_string( bound.uint64Value ) );
+		}
+		else if( boundKind == CFLibExceptionInfo::ARG_VALUE_DOUBLE ) {
+			return( std::to_string( bound.doubleValue ) );
+		}
+		else {
+			return( CFLibExceptionInfo::S_Empty );
+		}
+	}
+
+	std::string CFLibStatus::getInvalidArgumentMessage() const {
+		static const std::string S_ValueSep( ", \"" );
+		if( argValue.empty() ) {
+			return( detail );
+		}
+		std::string retval( detail );
+		retval.append( S_ValueSep );
+		retval.append( argValue );
+		retval.append( CFLibXmlUtil::S_IS_INVALID );
+		return( retval );
+	}
+
+	CFLibRuntimeException* CFLibStatus::newException() const {
+		static const std::string S_ProcName( "newException" );
+
+		if( statusCode == STATUS_OK ) {
+			return( NULL );
+		}
+		else if( statusCode == STATUS_NULL ) {
+			return( new CFLibNullArgumentException( *className,
+				*methodName,
+				argOffset,
+				argName ) );
+		}
+		else if( statusCode == STATUS_INVALID_ARGUMENT ) {
+			return( new CFLibInvalidArgumentException( *className,
+				*methodName,
+				argOffset,
+				argName,
+				getInvalidArgumentMessage() ) );
+		}
+		else if( statusCode == STATUS_OVERFLOW ) {
+			if( boundKind == CFLibExceptionInfo::ARG_VALUE_TEXT ) {
+				return( new CFLibArgumentOverflowException( *className,
+					*methodName,
+					argOffset,
+					argName,
+					detail ) );
+			}
+			return( new CFLibArgumentOverflowException( *className,
+				*methodName,
+				argOffset,
+				argName,
+				argValue,
+				getBoundString() ) );
+		}
+		else if( statusCode == STATUS_UNDERFLOW ) {
+			if( boundKind == CFLibExceptionInfo::ARG_VALUE_TEXT ) {
+				return( new CFLibArgumentUnderflowException( *className,
+					*methodName,
+					argOffset,
+					argName,
+					detail ) );
+			}
+			return( new CFLibArgumentUnderflowException( *className,
+				*methodName,
+				argOffset,
+				argName,
+				argValue,
+				getBoundString() ) );
+		}
+		else {
+			return( new CFLibArgumentRangeException( CLASS_NAME,
+				S_ProcName,
+				0,
+				CFLibExceptionInfo::S_Empty,
+				(int64_t)statusCode,
+				(int64_t)STATUS_OK,
+				(int64_t)STATUS_UNDERFLOW ) );
+		}
+	}
+
+	void CFLibStatus::throwException() const {
+		static const std::string S_ProcName( "throwException" );
+		if( statusCode == STATUS_OK ) {
+			return;
+		}
+		else if( statusCode == STATUS_NULL ) {
+			throw CFLibNullArgumentException( *className,
+				*methodName,
+				argOffset,
+				argName );
+		}
+		else if( statusCode == STATUS_INVALID_ARGUMENT ) {
+			throw CFLibInvalidArgumentException( *className,
+				*methodName,
+				argOffset,
+				argName,
+				getInvalidArgumentMessage() );
+		}
+		else if( ( statusCode == STATUS_OVERFLOW ) && ( boundKind == CFLibExceptionInfo::ARG_VALUE_TEXT ) ) {
+			throw CFLibArgumentOverflowException( *className,
+				*methodName,
+				argOffset,
+				argName,
+				detail );
+		}
+		else if( statusCode == STATUS_OVERFLOW ) {
+			throw CFLibArgumentOverflowException( *className,
+				*methodName,
+				argOffset,
+				argName,
+				argValue,
+				getBoundString() );
+		}
+		else if( ( statusCode == STATUS_UNDERFLOW ) && ( boundKind == CFLibExceptionInfo::ARG_VALUE_TEXT ) ) {
+			throw CFLibArgumentUnderflowException( *className,
+				*methodName,
+				argOffset,
+				argName,
+				detail );
+		}
+		else if( statusCode == STATUS_UNDERFLOW ) {
+			throw CFLibArgumentUnderflowException( *className,
+				*methodName,
+				argOffset,
+				argName,
+				argValue,
+				getBoundString() );
+		}
+		else {
+			throw CFLibArgumentRangeException( CLASS_NAME,
+				S_ProcName,
+				0,
+				CFLibExceptionInfo::S_Empty,
+				(int64_t)statusCode,
+				(int64_t)STATUS_OK,
+				(int64_t)STATUS_UNDERFLOW );
+		}
+	}
+
+	std::string CFLibStatus::getMessage() const {
+		if( statusCode == STATUS_OK ) {
+			return( CFLibExceptionInfo::S_Empty );
+		}
+		CFLibRuntimeException* exc = newException();
+		std::string retval( exc->what() );
+		delete exc;
+		return( retval );
+	}
+}
@@ -0,0 +1,71 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cflib/CFLibUuid.hpp>
+#include <cflib/CFLibInvalidArgumentException.hpp>
+
+namespace cflib {
+
+	const std::string CFLibUuid::CLASS_NAME( "CFLibUuid" );
+
+	static const std::string S_ProcParse( "parse" );
+	static const std::string S_Value( "value" );
+	static constexpr std::string_view S_InvalidUuidFormat( "Invalid value format, must be xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx, \"" );
+	static constexpr std::string_view S_IsInvalid( "\" is invalid" );
+
+	CFLibUuid CFLibUuid::parse( const std::string& value ) {
+		CFLibUuid retval;
+		if( ! tryParse( value, retval ) ) {
+			std::string buff( S_InvalidUuidFormat );
+			buff.append( value );
+			buff.append( S_IsInvalid );
+			throw CFLibInvalidArgumentException( CLASS_NAME,
+				S_ProcParse,
+				1,
+				S_Value,
+				buff );
+		}
+		return( retval );
+	}
+
+	CFLibUuid CFLibUuid::generate() {
+		CFLibUuid retval;
+		uuid_generate_random( retval.bytes );
+		return( retval );
+	}
+
+	CFLibUuid CFLibUuid::generateTime() {
+		CFLibUuid retval;
+		uuid_generate_time( retval.bytes );
+		return( retval );
+	}
+
+	std::string CFLibUuid::toString() const {
+		std::string retval( FORMATTED_LENGTH, '\0' );
+		format( &retval[0] );
+		return( retval );
+	}
+}
@@ -0,0 +1,137 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <algorithm>
+
+#include <cflib/CFLib.hpp>
+#include <cflib/CFLibWorkerPool.hpp>
+
+namespace cflib {
+
+	const std::string CFLibWorkerPool::CLASS_NAME( "CFLibWorkerPool" );
+
+	CFLibWorkerPool::CFLibWorkerPool( unsigned numThreads ) {
+		stopping = false;
+		if( numThreads == 0 ) {
+			unsigned hardwareThreads = std::thread::hardware_concurrency();
+			numThreads = ( hardwareThreads > 1 ) ? hardwareThreads - 1 : 0;
+		}
+		threads.reserve( numThreads );
+		try {
+			for( unsigned threadIdx = 0; threadIdx < numThreads; threadIdx ++ ) {
+				threads.push_back( std::thread( &CFLibWorkerPool::runWorker, this ) );
+			}
+		}
+		catch( ... ) {
+			// Could not start another thread, so make do with those running
+		}
+	}
+
+	CFLibWorkerPool::~CFLibWorkerPool() {
+		{
+			std::lock_guard<std::mutex> guard( lock );
+			stopping = true;
+		}
+		wake.notify_all();
+		for( std::thread& thread : threads ) {
+			thread.join();
+		}
+	}
+
+	CFLibWorkerPool& CFLibWorkerPool::getSharedPool() {
+		static CFLibWorkerPool sharedPool;
+		return( sharedPool );
+	}
+
+	unsigned CFLibWorkerPool::getNumThreads() const {
+		return( (unsigned)threads.size() );
+	}
+
+	void CFLibWorkerPool::runTasks( Batch& batch ) {
+		for( ;; ) {
+			size_t taskIdx = batch.nextTask.fetch_add( 1 );
+			if( taskIdx >= batch.numTasks ) {
+				return;
+			}
+			(*batch.task)( taskIdx );
+			if( batch.tasksDone.fetch_add( 1 ) + 1 == batch.numTasks ) {
+				std::lock_guard<std::mutex> guard( lock );
+				batchDone.notify_all();
+			}
+		}
+	}
+
+	void CFLibWorkerPool::runWorker() {
+		std::unique_lock<std::mutex> guard( lock );
+		for( ;; ) {
+			wake.wait( guard, [this]() { return( stopping || ! batches.empty() ); } );
+			if( stopping ) {
+				return;
+			}
+			std::shared_ptr<Batch> batch = batches.front();
+			if( batch->nextTask.load() >= batch->numTasks ) {
+				// Every task has been claimed, so stop offering the batch
+				batches.pop_front();
+				continue;
+			}
+			guard.unlock();
+			runTasks( *batch );
+			guard.lock();
+		}
+	}
+
+	void CFLibWorkerPool::forEach( size_t numTasks, const std::function<void( size_t )>& task ) {
+		if( numTasks == 0 ) {
+			return;
+		}
+		if( threads.empty() || ( numTasks == 1 ) ) {
+			for( size_t taskIdx = 0; taskIdx < numTasks; taskIdx ++ ) {
+				task( taskIdx );
+			}
+			return;
+		}
+
+		std::shared_ptr<Batch> batch = std::make_shared<Batch>();
+		batch->task = &task;
+		batch->numTasks = numTasks;
+		batch->nextTask.store( 0 );
+		batch->tasksDone.store( 0 );
+		{
+			std::lock_guard<std::mutex> guard( lock );
+			batches.push_back( batch );
+		}
+		wake.notify_all();
+
+		runTasks( *batch );
+
+		std::unique_lock<std::mutex> guard( lock );
+		batchDone.wait( guard, [&batch]() { return( batch->tasksDone.load() == batch->numTasks ); } );
+		auto queued = std::find( batches.begin(), batches.end(), batch );
+		if( queued != batches.end() ) {
+			batches.erase( queued );
+		}
+	}
+}
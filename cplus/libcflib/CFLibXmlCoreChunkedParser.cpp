@@ -0,0 +1,512 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+
+#include <xercesc/sax/InputSource.hpp>
+#include <xercesc/util/BinInputStream.hpp>
+
+#include <cflib/ICFLibPublic.hpp>
+#include <cflib/CFLibXmlCoreChunkedParser.hpp>
+
+namespace cflib {
+
+	const std::string CFLibXmlCoreChunkedParser::CLASS_NAME( "CFLibXmlCoreChunkedParser" );
+
+	/**
+	 *	Find the first occurrence of a terminator such as "-->" at or after ofs,
+	 *	returning length if it is not present.
+	 */
+	static size_t findTerminator( const char* bytes, size_t length, size_t ofs, const char* term, size_t termLen ) {
+		while( ofs + termLen <= length ) {
+			const char* hit = (const char*)memchr( bytes + ofs, term[0], length - ofs - termLen + 1 );
+			if( hit == NULL ) {
+				return( length );
+			}
+			ofs = hit - bytes;
+			if( memcmp( hit, term, termLen ) == 0 ) {
+				return( ofs );
+			}
+			ofs ++;
+		}
+		return( length );
+	}
+
+	/**
+	 *	Find the '>' closing a tag or markup declaration that starts at ofs,
+	 *	skipping quoted literals and, for the DOCTYPE, the internal subset.
+	 */
+	static size_t findTagEnd( const char* bytes, size_t length, size_t ofs ) {
+		int bracketDepth = 0;
+		while( ofs < length ) {
+			char ch = bytes[ofs];
+			if( ( ch == '"' ) || ( ch == '\'' ) ) {
+				const char* close = (const char*)memchr( bytes + ofs + 1, ch, length - ofs - 1 );
+				if( close == NULL ) {
+					return( length );
+				}
+				ofs = close - bytes;
+			}
+			else if( ch == '[' ) {
+				bracketDepth ++;
+			}
+			else if( ch == ']' ) {
+				bracketDepth --;
+			}
+			else if( ( ch == '>' ) && ( bracketDepth <= 0 ) ) {
+				return( ofs );
+			}
+			ofs ++;
+		}
+		return( length );
+	}
+
+	/**
+	 *	Reads a chunk document in three pieces: the file's prolog and root
+	 *	start tag, the chunk's records straight from the mapped file, and
+	 *	the root end tag.
+	 */
+	class CFLibXmlCoreChunkBinInputStream : public xercesc::BinInputStream {
+	protected:
+		static const int SEGMENT_COUNT = 3;
+		const XMLByte* segmentBytes[SEGMENT_COUNT];
+		XMLSize_t segmentLength[SEGMENT_COUNT];
+		int curSegment;
+		XMLSize_t segmentOffset;
+		XMLFilePos position;
+
+	public:
+		CFLibXmlCoreChunkBinInputStream( const std::string& prefix, const char* bytes, size_t length, const std::string& suffix ) {
+			segmentBytes[0] = (const XMLByte*)prefix.data();
+			segmentLength[0] = prefix.length();
+			segmentBytes[1] = (const XMLByte*)bytes;
+			segmentLength[1] = length;
+			segmentBytes[2] = (const XMLByte*)suffix.data();
+			segmentLength[2] = suffix.length();
+			curSegment = 0;
+			segmentOffset = 0;
+			position = 0;
+		}
+
+		virtual ~CFLibXmlCoreChunkBinInputStream() {
+		}
+
+		virtual XMLFilePos curPos() const {
+			return( position );
+		}
+
+		virtual XMLSize_t readBytes( XMLByte* const toFill, const XMLSize_t maxToRead ) {
+			XMLSize_t filled = 0;
+			while( ( filled < maxToRead ) && ( curSegment < SEGMENT_COUNT ) ) {
+				XMLSize_t available = segmentLength[curSegment] - segmentOffset;
+				if( available == 0 ) {
+					curSegment ++;
+					segmentOffset = 0;
+					continue;
+				}
+				XMLSize_t copied = ( available < maxToRead - filled ) ? available : maxToRead - filled;
+				memcpy( toFill + filled, segmentBytes[curSegment] + segmentOffset, copied );
+				segmentOffset += copied;
+				filled += copied;
+			}
+			position += filled;
+			return( filled );
+		}
+
+		virtual const XMLCh* getContentType() const {
+			return( NULL );
+		}
+	};
+
+	class CFLibXmlCoreChunkInputSource : public xercesc::InputSource {
+	protected:
+		CFLibXmlCoreParser* coreParser;
+		const std::string& prefix;
+		const char* bytes;
+		size_t length;
+		const std::string& suffix;
+
+	public:
+		CFLibXmlCoreChunkInputSource( CFLibXmlCoreParser* parser,
+			const std::string& chunkPrefix,
+			const char* chunkBytes,
+			size_t chunkLength,
+			const std::string& chunkSuffix,
+			const char* bufId )
+		: xercesc::InputSource( bufId ),
+		  prefix( chunkPrefix ),
+		  suffix( chunkSuffix )
+		{
+			coreParser = parser;
+			bytes = chunkBytes;
+			length = chunkLength;
+		}
+
+		virtual ~CFLibXmlCoreChunkInputSource() {
+			if( coreParser != NULL ) {
+				coreParser->setDocumentLocator( NULL );
+				coreParser = NULL;
+			}
+		}
+
+		virtual xercesc::BinInputStream* makeStream() const {
+			CFLibXmlCoreLineCountBinInputStream* retStream = new CFLibXmlCoreLineCountBinInputStream( coreParser,
+				new CFLibXmlCoreChunkBinInputStream( prefix, bytes, length, suffix ) );
+			retStream->setSystemId( getSystemId() );
+			retStream->setPublicId( getPublicId() );
+			return( retStream );
+		}
+	};
+
+	CFLibXmlCoreChunkedParser::CFLibXmlCoreChunkedParser( ICFLibXmlCoreSaxParserFactory* factory, unsigned numThreads )
+	: CFLibXmlCoreParallelParser( factory, numThreads )
+	{
+	}
+
+	CFLibXmlCoreChunkedParser::~CFLibXmlCoreChunkedParser() {
+		clear();
+	}
+
+	bool CFLibXmlCoreChunkedParser::findRecordBoundaries( const char* bytes,
+		size_t length,
+		size_t targetChunkSize,
+		size_t& rootContentBegin,
+		size_t& rootContentEnd,
+		std::string& rootQName,
+		std::vector<size_t>& splitPoints )
+	{
+		static const std::string S_ProcName( "findRecordBoundaries" );
+		static const std::string S_MsgNoRootElement( "Document has no root element" );
+		static const std::string S_MsgUnterminatedMarkup( "Document ends inside markup" );
+		static const std::string S_MsgRootNotClosed( "Root element is not closed" );
+
+		rootContentBegin = 0;
+		rootContentEnd = 0;
+		rootQName.clear();
+		splitPoints.clear();
+
+		size_t depth = 0;
+		size_t nextSplit = 0;
+		size_t ofs = 0;
+		while( ofs < length ) {
+			const char* lt = (const char*)memchr( bytes + ofs, '<', length - ofs );
+			if( lt == NULL ) {
+				break;
+			}
+			size_t tagBegin = lt - bytes;
+			size_t remaining = length - tagBegin;
+			size_t tagEnd;
+			if( ( remaining >= 2 ) && ( lt[1] == '?' ) ) {
+				tagEnd = findTerminator( bytes, length, tagBegin + 2, "?>", 2 );
+				ofs = tagEnd + 2;
+			}
+			else if( ( remaining >= 4 ) && ( memcmp( lt, "<!--", 4 ) == 0 ) ) {
+				tagEnd = findTerminator( bytes, length, tagBegin + 4, "-->", 3 );
+				ofs = tagEnd + 3;
+			}
+			else if( ( remaining >= 9 ) && ( memcmp( lt, "<![CDATA[", 9 ) == 0 ) ) {
+				tagEnd = findTerminator( bytes, length, tagBegin + 9, "]]>", 3 );
+				ofs = tagEnd + 3;
+			}
+			else if( ( remaining >= 2 ) && ( lt[1] == '!' ) ) {
+				tagEnd = findTagEnd( bytes, length, tagBegin + 2 );
+				ofs = tagEnd + 1;
+			}
+			else if( ( remaining >= 2 ) && ( lt[1] == '/' ) ) {
+				tagEnd = findTagEnd( bytes, length, tagBegin + 2 );
+				ofs = tagEnd + 1;
+				if( depth > 0 ) {
+					depth --;
+				}
+				if( depth == 0 ) {
+					rootContentEnd = tagBegin;
+					return( true );
+				}
+			}
+			else {
+				if( depth == 0 ) {
+					size_t nameEnd = tagBegin + 1;
+					while( ( nameEnd < length )
+						&& ( bytes[nameEnd] != '>' ) && ( bytes[nameEnd] != '/' )
+						&& ( bytes[nameEnd] != ' ' ) && ( bytes[nameEnd] != '\t' )
+						&& ( bytes[nameEnd] != '\r' ) && ( bytes[nameEnd] != '\n' ) )
+					{
+						nameEnd ++;
+					}
+					rootQName.assign( bytes + tagBegin + 1, nameEnd - tagBegin - 1 );
+				}
+				else if( ( depth == 1 ) && ( tagBegin >= nextSplit ) ) {
+					if( nextSplit > 0 ) {
+						splitPoints.push_back( tagBegin );
+					}
+					nextSplit = tagBegin + ( ( targetChunkSize > 0 ) ? targetChunkSize : 1 );
+				}
+				tagEnd = findTagEnd( bytes, length, tagBegin + 1 );
+				ofs = tagEnd + 1;
+				if( ( tagEnd < length ) && ( bytes[tagEnd - 1] != '/' ) ) {
+					depth ++;
+					if( depth == 1 ) {
+						rootContentBegin = ofs;
+					}
+				}
+				else if( depth == 0 ) {
+					rootContentBegin = ofs;
+					rootContentEnd = ofs;
+					return( false );
+				}
+			}
+			if( tagEnd >= length ) {
+				throw CFLibInvalidArgumentException( CLASS_NAME,
+					S_ProcName,
+					S_MsgUnterminatedMarkup );
+			}
+		}
+		if( rootQName.empty() ) {
+			throw CFLibInvalidArgumentException( CLASS_NAME,
+				S_ProcName,
+				S_MsgNoRootElement );
+		}
+		throw CFLibInvalidArgumentException( CLASS_NAME,
+			S_ProcName,
+			S_MsgRootNotClosed );
+	}
+
+	bool CFLibXmlCoreChunkedParser::isSplittableEncoding( const char* bytes, size_t length ) {
+		const unsigned char* ubytes = (const unsigned char*)bytes;
+		size_t ofs = 0;
+		if( ( length >= 3 ) && ( ubytes[0] == 0xef ) && ( ubytes[1] == 0xbb ) && ( ubytes[2] == 0xbf ) ) {
+			ofs = 3;
+		}
+		else if( length >= 2 ) {
+			// UTF-16 and UTF-32 byte order marks, and the unmarked UTF-16,
+			// UTF-32 and EBCDIC forms of "<?" from the XML 1.0 appendix F
+			if( ( ( ubytes[0] == 0xfe ) && ( ubytes[1] == 0xff ) )
+				|| ( ( ubytes[0] == 0xff ) && ( ubytes[1] == 0xfe ) )
+				|| ( ubytes[0] == 0x00 )
+				|| ( ( ubytes[0] == 0x3c ) && ( ubytes[1] == 0x00 ) )
+				|| ( ( ubytes[0] == 0x4c ) && ( ubytes[1] == 0x6f ) ) )
+			{
+				return( false );
+			}
+		}
+
+		static const char S_XmlDecl[] = "<?xml";
+		static const size_t S_XmlDeclLen = sizeof( S_XmlDecl ) - 1;
+		if( ( length <= ofs + S_XmlDeclLen )
+			|| ( memcmp( bytes + ofs, S_XmlDecl, S_XmlDeclLen ) != 0 )
+			|| ( ! isspace( (unsigned char)bytes[ofs + S_XmlDeclLen] ) ) )
+		{
+			// Without a declaration the document is UTF-8
+			return( true );
+		}
+		size_t declEnd = findTerminator( bytes, length, ofs + S_XmlDeclLen, "?>", 2 );
+		std::string decl( bytes + ofs + S_XmlDeclLen, declEnd - ofs - S_XmlDeclLen );
+		std::string::size_type encodingAttr = decl.find( "encoding" );
+		if( encodingAttr == std::string::npos ) {
+			return( true );
+		}
+		std::string::size_type quote = decl.find_first_of( "\"'", encodingAttr );
+		if( quote == std::string::npos ) {
+			return( false );
+		}
+		std::string::size_type nameEnd = decl.find( decl[quote], quote + 1 );
+		if( nameEnd == std::string::npos ) {
+			return( false );
+		}
+		std::string encoding( decl, quote + 1, nameEnd - quote - 1 );
+		std::transform( encoding.begin(), encoding.end(), encoding.begin(),
+			[]( unsigned char ch ) { return( (char)toupper( ch ) ); } );
+		return( ( encoding == "UTF-8" )
+			|| ( encoding == "UTF8" )
+			|| ( encoding == "US-ASCII" )
+			|| ( encoding == "ASCII" )
+			|| ( encoding.compare( 0, 9, "ISO-8859-" ) == 0 )
+			|| ( encoding.compare( 0, 11, "WINDOWS-125" ) == 0 ) );
+	}
+
+	std::vector<std::string>::size_type CFLibXmlCoreChunkedParser::splitFile( const std::string& fileName, unsigned numChunks ) {
+		static const std::string S_ProcName( "splitFile" );
+		static const std::string S_ArgFileName( "fileName" );
+		static const std::string S_MsgEncodingNotSupported( "Only ASCII compatible encodings can be split into chunks" );
+		if( fileName.empty() ) {
+			throw CFLibEmptyArgumentException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgFileName );
+		}
+		if( numChunks == 0 ) {
+			numChunks = getThreadCount() * 4;
+		}
+
+		int fd = open( fileName.c_str(), O_RDONLY );
+		if( fd < 0 ) {
+			throw CFLibWrapSystemException( CLASS_NAME,
+				S_ProcName,
+				fileName,
+				strerror( errno ) );
+		}
+		struct stat fileStat;
+		if( fstat( fd, &fileStat ) != 0 ) {
+			int err = errno;
+			close( fd );
+			throw CFLibWrapSystemException( CLASS_NAME,
+				S_ProcName,
+				fileName,
+				strerror( err ) );
+		}
+		size_t length = (size_t)fileStat.st_size;
+		const char* bytes = NULL;
+		if( length > 0 ) {
+			void* mapped = mmap( NULL, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+			if( mapped == MAP_FAILED ) {
+				int err = errno;
+				close( fd );
+				throw CFLibWrapSystemException( CLASS_NAME,
+					S_ProcName,
+					fileName,
+					strerror( err ) );
+			}
+			madvise( mapped, length, MADV_SEQUENTIAL );
+			bytes = (const char*)mapped;
+		}
+		close( fd );
+
+		MappedFile* mappedFile = new MappedFile();
+		mappedFile->fileName = fileName;
+		mappedFile->bytes = bytes;
+		mappedFile->length = length;
+		mappedFile->prefixNewLines = 0;
+		mappedFiles.push_back( mappedFile );
+
+		if( ! isSplittableEncoding( bytes, length ) ) {
+			throw CFLibNotSupportedException( CLASS_NAME,
+				S_ProcName,
+				S_MsgEncodingNotSupported );
+		}
+
+		size_t rootContentBegin;
+		size_t rootContentEnd;
+		std::string rootQName;
+		std::vector<size_t> splitPoints;
+		if( ! findRecordBoundaries( bytes, length, length / numChunks, rootContentBegin, rootContentEnd, rootQName, splitPoints ) ) {
+			// An empty root element has no records to split, so parse the file as is
+			addFile( fileName );
+			chunkFile.resize( getJobCount(), NULL );
+			chunkBegin.resize( getJobCount(), 0 );
+			chunkEnd.resize( getJobCount(), 0 );
+			chunkLineAdjustment.resize( getJobCount(), 0 );
+			return( 1 );
+		}
+
+		mappedFile->prefix.assign( bytes, rootContentBegin );
+		mappedFile->suffix = "</" + rootQName + ">";
+		mappedFile->prefixNewLines = std::count( bytes, bytes + rootContentBegin, '\n' );
+
+		std::vector<std::string>::size_type firstJob = getJobCount();
+		chunkFile.resize( firstJob, NULL );
+		chunkBegin.resize( firstJob, 0 );
+		chunkEnd.resize( firstJob, 0 );
+		chunkLineAdjustment.resize( firstJob, 0 );
+
+		splitPoints.push_back( rootContentEnd );
+		size_t begin = rootContentBegin;
+		int64_t line = 1 + (int64_t)mappedFile->prefixNewLines;
+		for( size_t chunkIdx = 0; chunkIdx < splitPoints.size(); chunkIdx++ ) {
+			size_t end = splitPoints[chunkIdx];
+			// Chunk text follows the prefix, which ends on the chunk's first line
+			chunkLineAdjustment.push_back( line - 1 - (int64_t)mappedFile->prefixNewLines );
+			chunkFile.push_back( mappedFile );
+			chunkBegin.push_back( begin );
+			chunkEnd.push_back( end );
+			jobNames.push_back( fileName + "#" + std::to_string( chunkIdx ) );
+			jobContents.push_back( NULL );
+			line += std::count( bytes + begin, bytes + end, '\n' );
+			begin = end;
+		}
+		return( splitPoints.size() );
+	}
+
+	int64_t CFLibXmlCoreChunkedParser::getChunkLineAdjustment( std::vector<std::string>::size_type jobIdx ) const {
+		if( jobIdx >= chunkLineAdjustment.size() ) {
+			return( 0 );
+		}
+		return( chunkLineAdjustment[jobIdx] );
+	}
+
+	void CFLibXmlCoreChunkedParser::parseJob( CFLibXmlCoreSaxParser* parser, std::vector<std::string>::size_type jobIdx ) {
+		if( ( jobIdx >= chunkFile.size() ) || ( chunkFile[jobIdx] == NULL ) ) {
+			parser->setLineNumberAdjustment( 0, 0 );
+			CFLibXmlCoreParallelParser::parseJob( parser, jobIdx );
+		}
+		else {
+			const MappedFile* mappedFile = chunkFile[jobIdx];
+			// The chunk's first line is the line the prefix ends on
+			parser->setLineNumberAdjustment( 1 + mappedFile->prefixNewLines, chunkLineAdjustment[jobIdx] );
+			CFLibXmlCoreChunkInputSource inputSource( parser,
+				mappedFile->prefix,
+				mappedFile->bytes + chunkBegin[jobIdx],
+				chunkEnd[jobIdx] - chunkBegin[jobIdx],
+				mappedFile->suffix,
+				jobNames[jobIdx].c_str() );
+			parser->parse( inputSource );
+		}
+		chunkParsed( parser, jobIdx );
+	}
+
+	void CFLibXmlCoreChunkedParser::chunkParsed( CFLibXmlCoreSaxParser* parser, std::vector<std::string>::size_type jobIdx ) {
+	}
+
+	void CFLibXmlCoreChunkedParser::unmapFiles() {
+		for( auto iter = mappedFiles.begin(); iter != mappedFiles.end(); iter++ ) {
+			MappedFile* mappedFile = *iter;
+			if( mappedFile != NULL ) {
+				if( mappedFile->bytes != NULL ) {
+					munmap( (void*)mappedFile->bytes, mappedFile->length );
+				}
+				delete mappedFile;
+				*iter = NULL;
+			}
+		}
+		mappedFiles.clear();
+	}
+
+	void CFLibXmlCoreChunkedParser::clear() {
+		CFLibXmlCoreParallelParser::clear();
+		chunkFile.clear();
+		chunkBegin.clear();
+		chunkEnd.clear();
+		chunkLineAdjustment.clear();
+		unmapFiles();
+	}
+}
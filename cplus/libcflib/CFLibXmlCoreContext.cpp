@@ -194,7 +194,7 @@ namespace cflib {
 	}
 
 	void CFLibXmlCoreContext::clearElementText() {
-		elementText = CFLib::S_EMPTY; 
+		elementText.clear();
 	}
 
 	std::string CFLibXmlCoreContext::getElementText() const {
@@ -205,10 +205,20 @@ namespace cflib {
 		if( ( chars == NULL ) || ( length <= 0 ) ) {
 			return;
 		}
-		char* transcoded = xercesc::XMLString::transcode( chars );
-		std::string cplusstr( transcoded );
-		xercesc::XMLString::release( &transcoded );
-		elementText.append( cplusstr );
+		if( parser != NULL ) {
+			parser->getUtf8Transcoder().append( elementText, chars, length );
+		}
+		else {
+			CFLibXmlCoreUtf8Transcoder transcoder;
+			transcoder.append( elementText, chars, length );
+			transcoder.reset( elementText );
+		}
+	}
+
+	void CFLibXmlCoreContext::finishElementText() {
+		if( parser != NULL ) {
+			parser->getUtf8Transcoder().reset( elementText );
+		}
 	}
 
 	CFLibXmlCoreElementHandler* CFLibXmlCoreContext::getElementHandler() const {
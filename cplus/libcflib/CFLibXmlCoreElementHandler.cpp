@@ -46,6 +46,7 @@ namespace cflib {
 				S_ArgCoreParser );
 		}
 		parser = coreParser;
+		elementTextRequired = true;
 	}
 
 	CFLibXmlCoreElementHandler::~CFLibXmlCoreElementHandler() {
@@ -78,6 +79,10 @@ namespace cflib {
 		parser = coreParser;
 	}
 
+	void CFLibXmlCoreElementHandler::setElementTextRequired( bool value ) {
+		elementTextRequired = value;
+	}
+
 	void CFLibXmlCoreElementHandler::addElementHandler( const std::string& qName, CFLibXmlCoreElementHandler* handler ) {
 		static const std::string S_ProcName( "addElementHandler" );
 		static const std::string S_ArgQName( "qName" );
@@ -135,12 +140,22 @@ namespace cflib {
 	}
 
 	void CFLibXmlCoreElementHandler::fatalError( const xercesc::SAXParseException& exception ) {
+		ICFLibMessageLog* log = getLog();
+		if( ( log != NULL ) && ! log->isEnabled( ICFLibMessageLog::LEVEL_FATAL, ICFLibMessageLog::CATEGORY_XML ) ) {
+			return;
+		}
 		char* cMessage = xercesc::XMLString::transcode( exception.getMessage () );
-		std::string cppMessage( cMessage );
-		std::string Msg( "Fatal error: " + cppMessage + " near " + parser->getLocationInfo() + "\n" );
+		std::string Msg( "Fatal error: " );
+		Msg.append( cMessage );
 		xercesc::XMLString::release( &cMessage );
-		if( getLog() != NULL ) {
-			getLog()->message( Msg );
+		Msg.append( " near " );
+		if( parser->getDocumentLocator() != NULL ) {
+			parser->getLocation().appendTo( Msg );
+			Msg.append( " " );
+		}
+		Msg.append( "\n" );
+		if( log != NULL ) {
+			log->message( ICFLibMessageLog::LEVEL_FATAL, ICFLibMessageLog::CATEGORY_XML, Msg );
 		}
 		else {
 			std::cerr << Msg;
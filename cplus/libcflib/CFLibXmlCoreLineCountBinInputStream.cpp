@@ -34,15 +34,15 @@ namespace cflib {
 		chainedInput = chain;
 		publicId = NULL;
 		systemId = NULL;
-		myLineNumber = 0;
-		myColNumber = 0;
 		if( coreParser != NULL ) {
+			coreParser->setLineCountStream( this );
 			coreParser->setDocumentLocator( this );
 		}
 	}
 
 	CFLibXmlCoreLineCountBinInputStream::~CFLibXmlCoreLineCountBinInputStream() {
 		if( coreParser != NULL ) {
+			coreParser->setLineCountStream( NULL );
 			coreParser->setDocumentLocator( NULL );
 			coreParser = NULL;
 		}
@@ -58,8 +58,6 @@ namespace cflib {
 			xercesc::XMLString::release( &systemId );
 			systemId = NULL;
 		}
-		myLineNumber = 0;
-		myColNumber = 0;
 	}
 
 	CFLibXmlCoreParser* CFLibXmlCoreLineCountBinInputStream::getParser() {
@@ -111,11 +109,11 @@ namespace cflib {
 	}
 
 	XMLFileLoc CFLibXmlCoreLineCountBinInputStream::getLineNumber() const {
-		return( myLineNumber );
+		return( 0 );
 	}
 
 	XMLFileLoc CFLibXmlCoreLineCountBinInputStream::getColumnNumber() const {
-		return( myColNumber );
+		return( 0 );
 	}
 
 	XMLFilePos CFLibXmlCoreLineCountBinInputStream::curPos() const {
@@ -131,18 +129,6 @@ namespace cflib {
 	}
 
 	XMLSize_t CFLibXmlCoreLineCountBinInputStream::readBytes( XMLByte *const toFill, const XMLSize_t maxToRead ) {
-		XMLSize_t actuallyRead = chainedInput->readBytes( toFill, maxToRead );
-		if( actuallyRead > 0 ) {
-			for( XMLSize_t i = 0; i < actuallyRead; i++ ) {
-				if( toFill[i] == '\n' ) {
-					myLineNumber ++;
-					myColNumber = 0;
-				}
-				else {
-					myColNumber ++;
-				}
-			}
-		}
-		return( actuallyRead );
+		return( chainedInput->readBytes( toFill, maxToRead ) );
 	}
 }
@@ -25,51 +25,39 @@
  */
 
 #include <cflib/CFLib.hpp>
-#include <cflib/CFLibNullableBool.hpp>
-#include <cflib/CFLibNullArgumentException.hpp>
+#include <cflib/CFLibXmlCoreLocation.hpp>
 
 namespace cflib {
 
-const std::string CFLibNullableBool::CLASS_NAME( "CFLibNullableBool" );;
+	const std::string CFLibXmlCoreLocation::CLASS_NAME( "CFLibXmlCoreLocation" );
 
-CFLibNullableBool::CFLibNullableBool() {
-	value = 0;
-}
-
-CFLibNullableBool::CFLibNullableBool( const bool arg ) {
-	setNullFlag( false );
-	value = arg;
-}
-
-CFLibNullableBool::~CFLibNullableBool() {
-}
-
-const bool CFLibNullableBool::getValue() const {
-	if( nullFlag ) {
-		throw CFLibNullArgumentException( CLASS_NAME,
-			S_GET_VALUE,
-			0,
-			S_VALUE );
+	CFLibXmlCoreLocation::CFLibXmlCoreLocation() {
+		lineNumber = 0;
+		columnNumber = 0;
+		byteOffset = 0;
 	}
-	return( value );
-}
 
-const bool* CFLibNullableBool::getReference() const {
-	if( nullFlag ) {
-		return( NULL );
+	const std::string& CFLibXmlCoreLocation::getDocumentName() const {
+		if( documentName == NULL ) {
+			return( CFLib::S_EMPTY );
+		}
+		return( *documentName );
 	}
-	else {
-		return( &value );
-	}
-}
-
-void CFLibNullableBool::setValue( const bool arg ) {
-	setNullFlag( false );
-	value = arg;
-}
 
-void CFLibNullableBool::setNull() {
-	setNullFlag( true );
-}
+	std::string CFLibXmlCoreLocation::toString() const {
+		std::string buff;
+		appendTo( buff, true );
+		return( buff );
+	}
 
+	void CFLibXmlCoreLocation::appendTo( std::string& buff, bool withColumn ) const {
+		buff.append( getDocumentName() );
+		buff.append( "[" );
+		buff.append( std::to_string( lineNumber ) );
+		if( withColumn ) {
+			buff.append( "," );
+			buff.append( std::to_string( columnNumber ) );
+		}
+		buff.append( "]" );
+	}
 }
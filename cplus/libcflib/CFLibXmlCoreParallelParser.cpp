@@ -0,0 +1,361 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <thread>
+
+#include <cflib/ICFLibPublic.hpp>
+#include <cflib/ICFLibXmlCoreSaxParserFactory.hpp>
+#include <cflib/CFLibXmlCoreParseResult.hpp>
+#include <cflib/CFLibXmlCoreParallelParser.hpp>
+
+namespace cflib {
+
+	const std::string CFLibXmlCoreParallelParser::CLASS_NAME( "CFLibXmlCoreParallelParser" );
+
+	/**
+	 *	Holds the shared grammar pool locked for the life of a run(), so the
+	 *	pool is unlocked however the run ends.
+	 */
+	class CFLibXmlCoreGrammarPoolLock {
+	protected:
+		xercesc::XMLGrammarPool* grammarPool;
+
+	public:
+		CFLibXmlCoreGrammarPoolLock( xercesc::XMLGrammarPool* pool ) {
+			grammarPool = pool;
+			grammarPool->lockPool();
+		}
+
+		~CFLibXmlCoreGrammarPoolLock() {
+			grammarPool->unlockPool();
+		}
+
+		CFLibXmlCoreGrammarPoolLock( const CFLibXmlCoreGrammarPoolLock& ) = delete;
+		CFLibXmlCoreGrammarPoolLock& operator=( const CFLibXmlCoreGrammarPoolLock& ) = delete;
+	};
+
+	CFLibXmlCoreParallelParser::CFLibXmlCoreParallelParser( ICFLibXmlCoreSaxParserFactory* factory, unsigned numThreads ) {
+		static const std::string S_ProcName( "construct" );
+		static const std::string S_ArgFactory( "factory" );
+		if( ! CFLib::isInitialized() ) {
+			throw CFLibUsageException( CLASS_NAME,
+				S_ProcName,
+				CFLib::S_MsgInitMustBeCalledFirst );
+		}
+		if( factory == NULL ) {
+			throw CFLibNullArgumentException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgFactory );
+		}
+		parserFactory = factory;
+		if( numThreads == 0 ) {
+			numThreads = std::thread::hardware_concurrency();
+			if( numThreads == 0 ) {
+				numThreads = 1;
+			}
+		}
+		threadCount = numThreads;
+		workQueues = NULL;
+		workQueueLocks = NULL;
+	}
+
+	CFLibXmlCoreParallelParser::~CFLibXmlCoreParallelParser() {
+		clear();
+		releaseParsers();
+	}
+
+	unsigned CFLibXmlCoreParallelParser::getThreadCount() const {
+		return( threadCount );
+	}
+
+	xercesc::Grammar* CFLibXmlCoreParallelParser::loadSharedGrammar( const std::string& xsdFileName ) {
+		static const std::string S_ProcName( "loadSharedGrammar" );
+		static const std::string S_ArgXsdFileName( "xsdFileName" );
+		if( ! CFLib::isInitialized() ) {
+			throw CFLibUsageException( CLASS_NAME,
+				S_ProcName,
+				CFLib::S_MsgInitMustBeCalledFirst );
+		}
+		if( xsdFileName.empty() ) {
+			throw CFLibEmptyArgumentException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgXsdFileName );
+		}
+		xercesc::SAX2XMLReader* xmlReader = xercesc::XMLReaderFactory::createXMLReader( xercesc::XMLPlatformUtils::fgMemoryManager,
+			CFLibXmlCoreParser::getGrammarPool() );
+		xercesc::Grammar* grammar = NULL;
+		try {
+			xmlReader->setFeature( xercesc::XMLUni::fgSAX2CoreNameSpaces, true );
+			xmlReader->setFeature( xercesc::XMLUni::fgXercesSchema, true );
+			grammar = xmlReader->loadGrammar( xsdFileName.c_str(), xercesc::Grammar::SchemaGrammarType, true );
+		}
+		catch( ... ) {
+			delete xmlReader;
+			throw;
+		}
+		delete xmlReader;
+		return( grammar );
+	}
+
+	void CFLibXmlCoreParallelParser::addFile( const std::string& fileName ) {
+		static const std::string S_ProcName( "addFile" );
+		static const std::string S_ArgFileName( "fileName" );
+		if( fileName.empty() ) {
+			throw CFLibEmptyArgumentException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgFileName );
+		}
+		jobNames.push_back( fileName );
+		jobContents.push_back( NULL );
+	}
+
+	void CFLibXmlCoreParallelParser::addBuffer( const std::string& bufName, const std::string& contents ) {
+		jobNames.push_back( bufName );
+		jobContents.push_back( new std::string( contents ) );
+	}
+
+	std::vector<std::string>::size_type CFLibXmlCoreParallelParser::getJobCount() const {
+		return( jobNames.size() );
+	}
+
+	const std::TCFLibOwningVector<CFLibXmlCoreParseResult*>& CFLibXmlCoreParallelParser::getResults() const {
+		return( results );
+	}
+
+	void CFLibXmlCoreParallelParser::clearResults() {
+		for( auto iter = results.begin(); iter != results.end(); iter++ ) {
+			if( *iter != NULL ) {
+				delete *iter;
+				*iter = NULL;
+			}
+		}
+		results.clear();
+	}
+
+	void CFLibXmlCoreParallelParser::clear() {
+		clearResults();
+		for( auto iter = jobContents.begin(); iter != jobContents.end(); iter++ ) {
+			if( *iter != NULL ) {
+				delete *iter;
+				*iter = NULL;
+			}
+		}
+		jobContents.clear();
+		jobNames.clear();
+	}
+
+	const std::TCFLibOwningVector<CFLibXmlCoreParseResult*>& CFLibXmlCoreParallelParser::run() {
+		static const std::string S_ProcName( "run" );
+		clearResults();
+		std::vector<std::string>::size_type numJobs = jobNames.size();
+		results.reserve( numJobs );
+		for( std::vector<std::string>::size_type jobIdx = 0; jobIdx < numJobs; jobIdx++ ) {
+			results.push_back( new CFLibXmlCoreParseResult( jobNames[jobIdx] ) );
+		}
+		if( numJobs == 0 ) {
+			return( results );
+		}
+
+		unsigned numWorkers = threadCount;
+		if( numWorkers > numJobs ) {
+			numWorkers = (unsigned)numJobs;
+		}
+
+		// Parsers are created and initialized on this thread so the factory
+		// and the parsers' initParser() implementations need not be thread safe.
+		try {
+			createParsers( numWorkers );
+		}
+		catch( ... ) {
+			releaseParsers();
+			throw;
+		}
+
+		try {
+			workQueues = new std::vector< std::deque<std::vector<std::string>::size_type> >( numWorkers );
+			workQueueLocks = new std::vector<std::mutex>( numWorkers );
+			for( std::vector<std::string>::size_type jobIdx = 0; jobIdx < numJobs; jobIdx++ ) {
+				(*workQueues)[ jobIdx % numWorkers ].push_back( jobIdx );
+			}
+
+			CFLibXmlCoreGrammarPoolLock poolLock( CFLibXmlCoreParser::getGrammarPool() );
+
+			std::vector<std::thread> workers;
+			workers.reserve( numWorkers );
+			try {
+				for( unsigned workerIdx = 0; workerIdx < numWorkers; workerIdx++ ) {
+					workers.push_back( std::thread( &CFLibXmlCoreParallelParser::runWorker, this, workerIdx ) );
+				}
+			}
+			catch( ... ) {
+				// The workers already started drain every queue between them,
+				// so they finish and can be joined before the error is rethrown
+				for( auto iter = workers.begin(); iter != workers.end(); iter++ ) {
+					iter->join();
+				}
+				throw;
+			}
+			for( auto iter = workers.begin(); iter != workers.end(); iter++ ) {
+				iter->join();
+			}
+		}
+		catch( ... ) {
+			endRun();
+			throw;
+		}
+
+		endRun();
+
+		return( results );
+	}
+
+	void CFLibXmlCoreParallelParser::endRun() {
+		releaseParsers();
+		if( workQueues != NULL ) {
+			delete workQueues;
+			workQueues = NULL;
+		}
+		if( workQueueLocks != NULL ) {
+			delete workQueueLocks;
+			workQueueLocks = NULL;
+		}
+	}
+
+	CFLibXmlCoreSaxParser* CFLibXmlCoreParallelParser::newSharedPoolParser() {
+		CFLibXmlCoreSaxParser* parser = parserFactory->newXmlCoreSaxParser( NULL );
+		if( ! parser->isXmlReaderInitialized() ) {
+			try {
+				parser->setUseSharedGrammarPool( true );
+				parser->initParser();
+			}
+			catch( ... ) {
+				delete parser;
+				throw;
+			}
+		}
+		return( parser );
+	}
+
+	void CFLibXmlCoreParallelParser::createParsers( unsigned numWorkers ) {
+		for( unsigned workerIdx = 0; workerIdx < numWorkers; workerIdx++ ) {
+			parsers.push_back( newSharedPoolParser() );
+		}
+	}
+
+	CFLibXmlCoreSaxParser* CFLibXmlCoreParallelParser::getJobParser( unsigned workerIdx, std::vector<std::string>::size_type jobIdx ) {
+		return( parsers[workerIdx] );
+	}
+
+	void CFLibXmlCoreParallelParser::releaseParsers() {
+		deleteParsers();
+	}
+
+	void CFLibXmlCoreParallelParser::deleteParsers() {
+		for( auto iter = parsers.begin(); iter != parsers.end(); iter++ ) {
+			if( *iter != NULL ) {
+				delete *iter;
+				*iter = NULL;
+			}
+		}
+		parsers.clear();
+	}
+
+	void CFLibXmlCoreParallelParser::parseJob( CFLibXmlCoreSaxParser* parser, std::vector<std::string>::size_type jobIdx ) {
+		if( jobContents[jobIdx] != NULL ) {
+			parser->parseStringContents( jobNames[jobIdx], *jobContents[jobIdx] );
+		}
+		else {
+			parser->parse( jobNames[jobIdx].c_str() );
+		}
+	}
+
+	bool CFLibXmlCoreParallelParser::takeJob( unsigned workerIdx, std::vector<std::string>::size_type& jobIdx ) {
+		{
+			std::lock_guard<std::mutex> guard( (*workQueueLocks)[workerIdx] );
+			std::deque<std::vector<std::string>::size_type>& ownQueue = (*workQueues)[workerIdx];
+			if( ! ownQueue.empty() ) {
+				jobIdx = ownQueue.front();
+				ownQueue.pop_front();
+				return( true );
+			}
+		}
+		// Nothing left of our own; steal the last job of the next busy worker.
+		// No jobs are added during a run, so once every queue is empty we are done.
+		unsigned numWorkers = (unsigned)workQueues->size();
+		for( unsigned offset = 1; offset < numWorkers; offset++ ) {
+			unsigned victimIdx = ( workerIdx + offset ) % numWorkers;
+			std::lock_guard<std::mutex> guard( (*workQueueLocks)[victimIdx] );
+			std::deque<std::vector<std::string>::size_type>& victimQueue = (*workQueues)[victimIdx];
+			if( ! victimQueue.empty() ) {
+				jobIdx = victimQueue.back();
+				victimQueue.pop_back();
+				return( true );
+			}
+		}
+		return( false );
+	}
+
+	void CFLibXmlCoreParallelParser::runWorker( unsigned workerIdx ) {
+		static const std::string S_ProcName( "runWorker" );
+		CFLibCachedMessageLog docLog;
+		std::vector<std::string>::size_type jobIdx;
+		while( takeJob( workerIdx, jobIdx ) ) {
+			CFLibXmlCoreParseResult* result = results[jobIdx];
+			CFLibXmlCoreSaxParser* parser = getJobParser( workerIdx, jobIdx );
+			CFLIB_EXCEPTION_DECLINFO
+			docLog.clearCache();
+			parser->setLog( &docLog );
+			try {
+				parseJob( parser, jobIdx );
+			}
+			catch( ... ) {
+				// Unlike CFLIB_EXCEPTION_CATCH_FALLTHROUGH, a worker must not let
+				// an unrecognized exception escape the thread
+				if( ! exceptionInfo.captureCurrentException( CLASS_NAME, S_ProcName ) ) {
+					static const std::string S_MsgUnknownException( "Unrecognized exception" );
+					exceptionInfo.setIsSystemException();
+					exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException );
+					exceptionInfo.setClassFieldName( CLASS_NAME );
+					exceptionInfo.setMethodName( S_ProcName );
+					exceptionInfo.setMessageText( S_MsgUnknownException );
+				}
+			}
+
+			if( CFLIB_EXCEPTION_EMPTY ) {
+				result->setSucceeded( true );
+			}
+			else {
+				result->setSucceeded( false );
+				result->setExceptionMessage( CFLIB_EXCEPTION_FORMATTEDMESSAGE );
+			}
+			result->setMessages( docLog.getCacheContents() );
+			parser->setLog( NULL );
+		}
+	}
+}
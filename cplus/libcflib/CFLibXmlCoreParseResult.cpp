@@ -24,52 +24,46 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cflib/CFLib.hpp>
-#include <cflib/CFLibNullableUInt16.hpp>
-#include <cflib/CFLibNullArgumentException.hpp>
+#include <cflib/CFLibXmlCoreParseResult.hpp>
 
 namespace cflib {
 
-const std::string CFLibNullableUInt16::CLASS_NAME( "CFLibNullableUInt16" );;
+	const std::string CFLibXmlCoreParseResult::CLASS_NAME( "CFLibXmlCoreParseResult" );
 
-CFLibNullableUInt16::CFLibNullableUInt16() {
-	value = 0;
-}
+	CFLibXmlCoreParseResult::CFLibXmlCoreParseResult( const std::string& docName )
+	: documentName( docName )
+	{
+		succeeded = false;
+	}
 
-CFLibNullableUInt16::CFLibNullableUInt16( const uint16_t arg ) {
-	setNullFlag( false );
-	value = arg;
-}
+	CFLibXmlCoreParseResult::~CFLibXmlCoreParseResult() {
+	}
 
-CFLibNullableUInt16::~CFLibNullableUInt16() {
-}
+	const std::string& CFLibXmlCoreParseResult::getDocumentName() const {
+		return( documentName );
+	}
 
-const uint16_t CFLibNullableUInt16::getValue() const {
-	if( nullFlag ) {
-		throw CFLibNullArgumentException( CLASS_NAME,
-			S_GET_VALUE,
-			0,
-			S_VALUE );
+	bool CFLibXmlCoreParseResult::getSucceeded() const {
+		return( succeeded );
 	}
-	return( value );
-}
 
-const uint16_t* CFLibNullableUInt16::getReference() const {
-	if( nullFlag ) {
-		return( NULL );
+	void CFLibXmlCoreParseResult::setSucceeded( bool value ) {
+		succeeded = value;
 	}
-	else {
-		return( &value );
+
+	const std::string& CFLibXmlCoreParseResult::getMessages() const {
+		return( messages );
 	}
-}
 
-void CFLibNullableUInt16::setValue( const uint16_t arg ) {
-	setNullFlag( false );
-	value = arg;
-}
+	void CFLibXmlCoreParseResult::setMessages( const std::string& value ) {
+		messages = value;
+	}
 
-void CFLibNullableUInt16::setNull() {
-	setNullFlag( true );
-}
+	const std::string& CFLibXmlCoreParseResult::getExceptionMessage() const {
+		return( exceptionMessage );
+	}
 
+	void CFLibXmlCoreParseResult::setExceptionMessage( const std::string& value ) {
+		exceptionMessage = value;
+	}
 }
@@ -25,9 +25,12 @@
  */
 
 #include <iostream>
+#include <xercesc/util/BinFileInputStream.hpp>
+#include <xercesc/util/BinFileOutputStream.hpp>
 #include <cflib/CFLibXmlCore.hpp>
 #include <cflib/CFLibXmlCoreParser.hpp>
 #include <cflib/CFLibXmlCoreElementHandler.hpp>
+#include <cflib/CFLibXmlCoreLineCountBinInputStream.hpp>
 
 namespace cflib {
 
@@ -84,6 +87,11 @@ namespace cflib {
 		contextStack = new std::vector<CFLibXmlCoreContext*>();
 		xmlCoreContextFactory = NULL;
 		docLocator = NULL;
+		lineCountStream = NULL;
+		docLocatorDocumentNameKnown = false;
+		docLocatorDocumentIdPtr = NULL;
+		lineAdjustmentFrom = 0;
+		lineAdjustment = 0;
 	}
 
 	CFLibXmlCoreParser::CFLibXmlCoreParser( ICFLibMessageLog* jlog )
@@ -101,6 +109,11 @@ namespace cflib {
 		contextStack = new std::vector<CFLibXmlCoreContext*>();
 		xmlCoreContextFactory = NULL;
 		docLocator = NULL;
+		lineCountStream = NULL;
+		docLocatorDocumentNameKnown = false;
+		docLocatorDocumentIdPtr = NULL;
+		lineAdjustmentFrom = 0;
+		lineAdjustment = 0;
 	}
 
 	CFLibXmlCoreParser::~CFLibXmlCoreParser() {
@@ -151,15 +164,80 @@ namespace cflib {
 		return( useGrammar );
 	}
 
+	bool CFLibXmlCoreParser::loadGrammarCache( const std::string& cacheFileName ) {
+		static const std::string S_ProcName( "loadGrammarCache" );
+		static const std::string S_ArgCacheFileName( "cacheFileName" );
+		if( ! CFLib::isInitialized() ) {
+			throw CFLibUsageException( CLASS_NAME,
+				S_ProcName,
+				CFLib::S_MsgInitMustBeCalledFirst );
+		}
+		if( cacheFileName.empty() ) {
+			throw CFLibEmptyArgumentException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgCacheFileName );
+		}
+		xercesc::BinFileInputStream cacheStream( cacheFileName.c_str() );
+		if( ! cacheStream.getIsOpen() ) {
+			return( false );
+		}
+		try {
+			grammarPool->deserializeGrammars( &cacheStream );
+		}
+		catch( const xercesc::XMLException& e ) {
+			// Discard whatever part of a stale cache was restored, but never
+			// grammars that were already in the pool
+			if( e.getCode() != xercesc::XMLExcepts::XSer_GrammarPool_NotEmpty ) {
+				grammarPool->clear();
+			}
+			return( false );
+		}
+		return( true );
+	}
+
+	void CFLibXmlCoreParser::saveGrammarCache( const std::string& cacheFileName ) {
+		static const std::string S_ProcName( "saveGrammarCache" );
+		static const std::string S_ArgCacheFileName( "cacheFileName" );
+		static const std::string S_CouldNotAccess( "Could not access file " );
+		static const std::string S_ForWriting( " for writing" );
+		if( ! CFLib::isInitialized() ) {
+			throw CFLibUsageException( CLASS_NAME,
+				S_ProcName,
+				CFLib::S_MsgInitMustBeCalledFirst );
+		}
+		if( cacheFileName.empty() ) {
+			throw CFLibEmptyArgumentException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgCacheFileName );
+		}
+		xercesc::BinFileOutputStream cacheStream( cacheFileName.c_str() );
+		if( ! cacheStream.getIsOpen() ) {
+			throw CFLibInvalidArgumentException( CLASS_NAME,
+				S_ProcName,
+				S_CouldNotAccess + cacheFileName + S_ForWriting );
+		}
+		grammarPool->serializeGrammars( &cacheStream );
+	}
+
 	const xercesc::Locator* CFLibXmlCoreParser::getDocumentLocator() const {
 		return( docLocator );
 	}
 
 	void CFLibXmlCoreParser::setDocumentLocator( xercesc::Locator* newLocator ) {
 		docLocator = newLocator;
+		docLocatorDocumentName.reset();
+		docLocatorDocumentNameKnown = false;
+		docLocatorDocumentIdPtr = NULL;
+		docLocatorDocumentId.clear();
 		xercesc::DefaultHandler::setDocumentLocator( newLocator );
 	}
 
+	void CFLibXmlCoreParser::setLineCountStream( CFLibXmlCoreLineCountBinInputStream* stream ) {
+		lineCountStream = stream;
+	}
+
 	ICFLibMessageLog* CFLibXmlCoreParser::getLog() const {
 		return( log );
 	}
@@ -168,6 +246,18 @@ namespace cflib {
 		log = jlog;
 	}
 
+	void CFLibXmlCoreParser::setLineNumberAdjustment( XMLFileLoc fromLine, int64_t adjustment ) {
+		lineAdjustmentFrom = fromLine;
+		lineAdjustment = adjustment;
+	}
+
+	XMLFileLoc CFLibXmlCoreParser::adjustLineNumber( XMLFileLoc lineNumber ) const {
+		if( ( lineAdjustment != 0 ) && ( lineNumber >= lineAdjustmentFrom ) ) {
+			return( (XMLFileLoc)( (int64_t)lineNumber + lineAdjustment ) );
+		}
+		return( lineNumber );
+	}
+
 	CFLibXmlCoreElementHandler* CFLibXmlCoreParser::getRootElementHandler() {
 		return( rootElementHandler );
 	}
@@ -176,44 +266,51 @@ namespace cflib {
 		rootElementHandler = handler;
 	}
 
-	std::string CFLibXmlCoreParser::getLocationInfo() {
+	CFLibXmlCoreLocation CFLibXmlCoreParser::getLocation() {
+		CFLibXmlCoreLocation location;
 		const xercesc::Locator* locator = getDocumentLocator();
-		std::string buff;
-		if( locator != NULL ) {
-
-			std::string* pathName = NULL;
-
-			const XMLCh* docName = locator->getSystemId();
-			if( docName != NULL ) {
-				char* cDocName = xercesc::XMLString::transcode( docName );
-				pathName = new std::string( cDocName );
-				xercesc::XMLString::release( &cDocName );
-			}
-
-			if( pathName == NULL ) {
-				docName = locator->getPublicId();
+		if( locator == NULL ) {
+			return( location );
+		}
+		// The scanner's locator reports the id of the entity being read, so
+		// the name changes inside external entities.  The id pointer is
+		// compared first; when it moves, the copy of the id text avoids
+		// transcoding the name again if the text is unchanged.
+		const XMLCh* docName = locator->getSystemId();
+		if( docName == NULL ) {
+			docName = locator->getPublicId();
+		}
+		if( ( ! docLocatorDocumentNameKnown ) || ( docName != docLocatorDocumentIdPtr ) ) {
+			bool sameId = docLocatorDocumentNameKnown
+				&& ( docName != NULL )
+				&& ( docLocatorDocumentIdPtr != NULL )
+				&& ( docLocatorDocumentId == docName );
+			if( ! sameId ) {
+				docLocatorDocumentName.reset();
+				docLocatorDocumentId.clear();
 				if( docName != NULL ) {
 					char* cDocName = xercesc::XMLString::transcode( docName );
-					pathName = new std::string( cDocName );
+					docLocatorDocumentName = std::make_shared<const std::string>( cDocName );
 					xercesc::XMLString::release( &cDocName );
+					docLocatorDocumentId.assign( docName );
 				}
 			}
+			docLocatorDocumentIdPtr = docName;
+			docLocatorDocumentNameKnown = true;
+		}
+		location.documentName = docLocatorDocumentName;
+		location.lineNumber = adjustLineNumber( locator->getLineNumber() );
+		location.columnNumber = locator->getColumnNumber();
+		if( lineCountStream != NULL ) {
+			location.byteOffset = lineCountStream->curPos();
+		}
+		return( location );
+	}
 
-			if( pathName != NULL ) {
-				buff.append( *pathName );
-				delete pathName;
-				pathName = NULL;
-			}
-
-			XMLFileLoc line = locator->getLineNumber();
-			if( line >= 0 ) {
-				buff.append( "[" + std::to_string( line ) );
-				XMLFileLoc col = locator->getColumnNumber();
-				if( col >= 0 ) {
-					buff.append( "," + std::to_string( col ) );
-				}
-				buff.append( "]" );
-			}
+	std::string CFLibXmlCoreParser::getLocationInfo() {
+		std::string buff;
+		if( getDocumentLocator() != NULL ) {
+			getLocation().appendTo( buff );
 			buff.append( " " );
 		}
 		return( buff );
@@ -282,7 +379,7 @@ namespace cflib {
 		}
 
 		buff.append( "[" );
-		buff.append( CFLibXmlUtil::formatInt64( ex.getLineNumber() ) );
+		buff.append( CFLibXmlUtil::formatInt64( adjustLineNumber( ex.getLineNumber() ) ) );
 		buff.append( "," );
 		buff.append( CFLibXmlUtil::formatInt64( ex.getColumnNumber() ) );
 		buff.append( "]: " );
@@ -299,59 +396,44 @@ namespace cflib {
 
 	void CFLibXmlCoreParser::warning( const xercesc::SAXParseException& ex )
 	{
-		std::string fmt = formatMessage( ex );
 		if( log != NULL ) {
-			log->message( "WARN:  " + fmt );
+			CFLIB_LOG( log, ICFLibMessageLog::LEVEL_WARN, ICFLibMessageLog::CATEGORY_XML, "WARN:  " + formatMessage( ex ) );
 		}
 		else {
-			std::cerr << "WARN:  " + fmt + "\n";
+			std::cerr << "WARN:  " + formatMessage( ex ) + "\n";
 		}
 	}
 
 	void CFLibXmlCoreParser::error( const xercesc::SAXParseException& ex )
 	{
-		std::string fmt = formatMessage( ex );
 		if( log != NULL ) {
-			log->message( "ERROR: " + fmt );
+			CFLIB_LOG( log, ICFLibMessageLog::LEVEL_ERROR, ICFLibMessageLog::CATEGORY_XML, "ERROR: " + formatMessage( ex ) );
 		}
 		else {
-			std::cerr << "ERROR: " + fmt + "\n";
+			std::cerr << "ERROR: " + formatMessage( ex ) + "\n";
 		}
 	}
 
 	void CFLibXmlCoreParser::fatalError( const xercesc::SAXParseException& ex )
 	{
-		std::string fmt = formatMessage( ex );
 		if( log != NULL ) {
-			log->message( "FATAL: " + fmt );
+			CFLIB_LOG( log, ICFLibMessageLog::LEVEL_FATAL, ICFLibMessageLog::CATEGORY_XML, "FATAL: " + formatMessage( ex ) );
 		}
 		else {
-			std::cerr << "FATAL: " + fmt + "\n";
+			std::cerr << "FATAL: " + formatMessage( ex ) + "\n";
 		}
 	}
 
 	std::string CFLibXmlCoreParser::getFormattedNearLocation() {
 		std::string retval;
-		const xercesc::Locator* loc = getDocumentLocator();
-		if( loc != NULL ) {
+		if( getDocumentLocator() != NULL ) {
+			CFLibXmlCoreLocation location = getLocation();
 			retval.append( " near " );
-			const XMLCh* systemId = loc->getSystemId();
-			if( systemId != NULL ) {
-				char* cSystemId = xercesc::XMLString::transcode( systemId );
-				std::string cppSystemId( cSystemId );
-				retval.append( cppSystemId );
-				xercesc::XMLString::release( &cSystemId );
+			if( location.lineNumber > 0 ) {
+				location.appendTo( retval, location.columnNumber > 0 );
 			}
-			XMLFileLoc lineno = loc->getLineNumber();
-			if( lineno > 0 ) {
-				retval.append( "[" );
-				retval.append( CFLibXmlUtil::formatInt64( lineno ) );
-				XMLFileLoc colno = loc->getColumnNumber();
-				if( colno > 0 ) {
-					retval.append( "," );
-					retval.append( std::to_string( colno ) );
-				}
-				retval.append( "]" );
+			else {
+				retval.append( location.getDocumentName() );
 			}
 		}
 		return( retval );
@@ -365,6 +447,10 @@ namespace cflib {
 		return( contextStack->back()->getElementText() );
 	}
 
+	CFLibXmlCoreUtf8Transcoder& CFLibXmlCoreParser::getUtf8Transcoder() {
+		return( utf8Transcoder );
+	}
+
 	void CFLibXmlCoreParser::startElement(
 		const XMLCh* const uri,
 		const XMLCh* const localname,
@@ -380,6 +466,7 @@ namespace cflib {
 		}
 
 		CFLibXmlCoreContext* prev = contextStack->back();
+		prev->finishElementText();
 		CFLibXmlCoreElementHandler* prevHandler = prev->getElementHandler();
 
 		CFLibXmlCoreElementHandler* curHandler = prevHandler->getElementHandler( qname );
@@ -407,6 +494,7 @@ namespace cflib {
 		const XMLCh* const qname )
 	{
 		CFLibXmlCoreContext* curContext = contextStack->back();
+		curContext->finishElementText();
 		CFLibXmlCoreElementHandler* curHandler = curContext->getElementHandler();
 		if( curHandler != NULL ) {
 			try {
@@ -427,44 +515,21 @@ namespace cflib {
 		if( ( chars == NULL ) || ( length <= 0 ) ) {
 			return;
 		}
-		if( getCurContext() != NULL ) {
-			getCurContext()->appendElementText( chars, length );
+		CFLibXmlCoreContext* curContext = getCurContext();
+		if( curContext == NULL ) {
+			return;
+		}
+		CFLibXmlCoreElementHandler* curHandler = curContext->getElementHandler();
+		if( ( curHandler != NULL ) && ! curHandler->isElementTextRequired() ) {
+			return;
 		}
+		curContext->appendElementText( chars, length );
 	}
 
 	std::string* CFLibXmlCoreParser::appendLocatorInformation( std::string* buff ) {
-
-		const xercesc::Locator* locator = getDocumentLocator();
-		if( locator != NULL ) {
-
-			std::string* pathName = NULL;
-
-			const XMLCh* systemId = locator->getSystemId();
-			if( systemId != NULL ) {
-				char* cSystemId = xercesc::XMLString::transcode( systemId );
-				pathName = new std::string( cSystemId );
-				xercesc::XMLString::release( &cSystemId );
-			}
-
-			if( pathName == NULL ) {
-				const XMLCh* publicId = locator->getPublicId();
-				char* cPublicId = xercesc::XMLString::transcode( publicId );
-				pathName = new std::string( cPublicId );
-				xercesc::XMLString::release( &cPublicId );
-			}
-
-			if( pathName != NULL ) {
-				buff->append( *pathName );
-				delete pathName;
-				pathName = NULL;
-			}
-
-			XMLFileLoc line = locator->getLineNumber();
-			if( line >= 0 ) {
-				buff->append( "[" + std::to_string( line ) + "]" );
-			}
+		if( getDocumentLocator() != NULL ) {
+			getLocation().appendTo( *buff, false );
 		}
-
 		return( buff );
 	}
 
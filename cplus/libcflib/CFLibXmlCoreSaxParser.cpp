@@ -35,6 +35,10 @@ namespace cflib {
 
 	const std::string CFLibXmlCoreSaxParser::CLASS_NAME( "CFLibXmlCoreSaxParser" );
 	const std::string CFLibXmlCoreSaxParser::S_SaxXmlReaderMustBeInitialized( "XmlReader must be initialized first" );
+	const int CFLibXmlCoreSaxParser::VALIDATION_FULL = 0;
+	const int CFLibXmlCoreSaxParser::VALIDATION_FIRST_N = 1;
+	const int CFLibXmlCoreSaxParser::VALIDATION_OFF = 2;
+	const uint32_t CFLibXmlCoreSaxParser::DEFAULT_VALIDATE_FIRST_COUNT = 1;
 
 	CFLibXmlCoreSaxParser::CFLibXmlCoreSaxParser()
 	: CFLibXmlCoreParser()
@@ -47,6 +51,12 @@ namespace cflib {
 		}
 		saxXmlReader = NULL;
 		memBufInputSource = NULL;
+		useSharedGrammarPool = false;
+		validationMode = VALIDATION_FULL;
+		validateFirstCount = DEFAULT_VALIDATE_FIRST_COUNT;
+		documentsValidated = 0;
+		readerValidating = false;
+		documentIssueCount = 0;
 	}
 
 	CFLibXmlCoreSaxParser::CFLibXmlCoreSaxParser( ICFLibMessageLog* jLogger )
@@ -60,6 +70,12 @@ namespace cflib {
 		}
 		saxXmlReader = NULL;
 		memBufInputSource = NULL;
+		useSharedGrammarPool = false;
+		validationMode = VALIDATION_FULL;
+		validateFirstCount = DEFAULT_VALIDATE_FIRST_COUNT;
+		documentsValidated = 0;
+		readerValidating = false;
+		documentIssueCount = 0;
 	}
 
 	CFLibXmlCoreSaxParser::~CFLibXmlCoreSaxParser() {
@@ -89,15 +105,114 @@ namespace cflib {
 			return;
 		}
 		CFLibXmlCoreParser::initParser();
-		xercesc::SAX2XMLReader* xmlReader = xercesc::XMLReaderFactory::createXMLReader();
-		xmlReader->setFeature( xercesc::XMLUni::fgSAX2CoreValidation, true );
+		xercesc::SAX2XMLReader* xmlReader;
+		if( useSharedGrammarPool ) {
+			xmlReader = xercesc::XMLReaderFactory::createXMLReader( xercesc::XMLPlatformUtils::fgMemoryManager,
+				CFLibXmlCoreParser::getGrammarPool() );
+		}
+		else {
+			xmlReader = xercesc::XMLReaderFactory::createXMLReader();
+		}
 		xmlReader->setFeature( xercesc::XMLUni::fgSAX2CoreNameSpaces, true );
-		xmlReader->setFeature( xercesc::XMLUni::fgXercesSchema, true );
 		// MSS TODO WORKING BLOWS CHUNKS xmlReader->setProperty( xercesc::XMLString::replicate( xchGrammarPoolPropertyName ), CFLibXmlCoreParser::getGrammarPool() );
 		xmlReader->setFeature( xercesc::XMLUni::fgXercesUseCachedGrammarInParse, true );
 		xmlReader->setContentHandler( this );
 		xmlReader->setErrorHandler( this );
 		saxXmlReader = xmlReader;
+		applyValidationMode();
+	}
+
+	bool CFLibXmlCoreSaxParser::isXmlReaderInitialized() const {
+		return( saxXmlReader != NULL );
+	}
+
+	bool CFLibXmlCoreSaxParser::isUsingSharedGrammarPool() const {
+		return( useSharedGrammarPool );
+	}
+
+	void CFLibXmlCoreSaxParser::setUseSharedGrammarPool( bool value ) {
+		static const std::string S_ProcName( "setUseSharedGrammarPool" );
+		static const std::string S_MsgReaderAlreadyCreated( "The grammar pool must be selected before initParser() is called" );
+		if( saxXmlReader != NULL ) {
+			throw CFLibUsageException( CLASS_NAME,
+				S_ProcName,
+				S_MsgReaderAlreadyCreated );
+		}
+		useSharedGrammarPool = value;
+	}
+
+	int CFLibXmlCoreSaxParser::getValidationMode() const {
+		return( validationMode );
+	}
+
+	void CFLibXmlCoreSaxParser::setValidationMode( int value ) {
+		static const std::string S_ProcName( "setValidationMode" );
+		static const std::string S_ArgValue( "value" );
+		if( ( value < VALIDATION_FULL ) || ( value > VALIDATION_OFF ) ) {
+			throw CFLibArgumentRangeException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgValue,
+				(int64_t)value,
+				(int64_t)VALIDATION_FULL,
+				(int64_t)VALIDATION_OFF );
+		}
+		validationMode = value;
+	}
+
+	uint32_t CFLibXmlCoreSaxParser::getValidateFirstCount() const {
+		return( validateFirstCount );
+	}
+
+	void CFLibXmlCoreSaxParser::setValidateFirstCount( uint32_t value ) {
+		validateFirstCount = value;
+	}
+
+	uint64_t CFLibXmlCoreSaxParser::getDocumentsValidated() const {
+		return( documentsValidated );
+	}
+
+	void CFLibXmlCoreSaxParser::resetDocumentsValidated() {
+		documentsValidated = 0;
+	}
+
+	void CFLibXmlCoreSaxParser::applyValidationMode() {
+		bool validate;
+		if( validationMode == VALIDATION_OFF ) {
+			validate = false;
+		}
+		else if( validationMode == VALIDATION_FIRST_N ) {
+			validate = ( documentsValidated < validateFirstCount );
+		}
+		else {
+			validate = true;
+		}
+		saxXmlReader->setFeature( xercesc::XMLUni::fgSAX2CoreValidation, validate );
+		saxXmlReader->setFeature( xercesc::XMLUni::fgXercesSchema, validate );
+		saxXmlReader->setFeature( xercesc::XMLUni::fgXercesLoadSchema, validate );
+		readerValidating = validate;
+		documentIssueCount = 0;
+	}
+
+	void CFLibXmlCoreSaxParser::countValidatedDocument() {
+		if( readerValidating && ( documentIssueCount == 0 ) ) {
+			documentsValidated ++;
+		}
+	}
+
+	void CFLibXmlCoreSaxParser::warning( const xercesc::SAXParseException& ex ) {
+		documentIssueCount ++;
+		CFLibXmlCoreParser::warning( ex );
+	}
+
+	void CFLibXmlCoreSaxParser::error( const xercesc::SAXParseException& ex ) {
+		documentIssueCount ++;
+		CFLibXmlCoreParser::error( ex );
+	}
+
+	void CFLibXmlCoreSaxParser::fatalError( const xercesc::SAXParseException& ex ) {
+		documentIssueCount ++;
+		CFLibXmlCoreParser::fatalError( ex );
 	}
 
 	xercesc::Grammar* CFLibXmlCoreSaxParser::loadGrammar( const std::string& xsdFileName ) {
@@ -114,6 +229,7 @@ namespace cflib {
 				S_MsgInitParserMustBeCalledFirst );
 		}
 		xercesc::Grammar* grammar = saxXmlReader->loadGrammar( xsdFileName.data(), xercesc::Grammar::GrammarType::SchemaGrammarType, true );
+		documentsValidated = 0;
 		return( grammar );
 	}
 
@@ -166,7 +282,9 @@ namespace cflib {
 		xmlbuff[len] = 0;
 		memBufInputSource = new CFLibXmlCoreLineCountMemBufInputSource( this, xmlbuff, len, systemid, false, xercesc::XMLPlatformUtils::fgMemoryManager );
 		try {
+			applyValidationMode();
 			saxXmlReader->parse( *memBufInputSource );
+			countValidatedDocument();
 		}
 		CFLIB_EXCEPTION_CATCH_FALLTHROUGH
 
@@ -208,7 +326,9 @@ namespace cflib {
 		xmlbuff[len] = 0;
 		memBufInputSource = new CFLibXmlCoreLineCountMemBufInputSource( this, xmlbuff, len, bufname.c_str(), false, xercesc::XMLPlatformUtils::fgMemoryManager );
 		try {
+			applyValidationMode();
 			saxXmlReader->parse( *memBufInputSource );
+			countValidatedDocument();
 		}
 		CFLIB_EXCEPTION_CATCH_FALLTHROUGH
 
@@ -236,6 +356,8 @@ namespace cflib {
 				S_ProcName,
 				S_SaxXmlReaderMustBeInitialized );
 		}
+		applyValidationMode();
 		saxXmlReader->parse( src );
+		countValidatedDocument();
 	}
 }
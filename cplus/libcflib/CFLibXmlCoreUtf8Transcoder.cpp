@@ -0,0 +1,136 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cflib/CFLibXmlCoreUtf8Transcoder.hpp>
+
+namespace cflib {
+
+	const std::string CFLibXmlCoreUtf8Transcoder::CLASS_NAME( "CFLibXmlCoreUtf8Transcoder" );
+
+	static const uint32_t REPLACEMENT_CHARACTER = 0xfffd;
+
+	CFLibXmlCoreUtf8Transcoder::CFLibXmlCoreUtf8Transcoder() {
+		pendingHighSurrogate = 0;
+	}
+
+	CFLibXmlCoreUtf8Transcoder::~CFLibXmlCoreUtf8Transcoder() {
+	}
+
+	void CFLibXmlCoreUtf8Transcoder::reset( std::string& target ) {
+		if( pendingHighSurrogate != 0 ) {
+			pendingHighSurrogate = 0;
+			appendCodePoint( target, REPLACEMENT_CHARACTER );
+		}
+	}
+
+	void CFLibXmlCoreUtf8Transcoder::appendCodePoint( std::string& target, uint32_t codePoint ) {
+		if( codePoint < 0x80 ) {
+			target.push_back( (char)codePoint );
+		}
+		else if( codePoint < 0x800 ) {
+			target.push_back( (char)( 0xc0 | ( codePoint >> 6 ) ) );
+			target.push_back( (char)( 0x80 | ( codePoint & 0x3f ) ) );
+		}
+		else if( codePoint < 0x10000 ) {
+			target.push_back( (char)( 0xe0 | ( codePoint >> 12 ) ) );
+			target.push_back( (char)( 0x80 | ( ( codePoint >> 6 ) & 0x3f ) ) );
+			target.push_back( (char)( 0x80 | ( codePoint & 0x3f ) ) );
+		}
+		else {
+			target.push_back( (char)( 0xf0 | ( codePoint >> 18 ) ) );
+			target.push_back( (char)( 0x80 | ( ( codePoint >> 12 ) & 0x3f ) ) );
+			target.push_back( (char)( 0x80 | ( ( codePoint >> 6 ) & 0x3f ) ) );
+			target.push_back( (char)( 0x80 | ( codePoint & 0x3f ) ) );
+		}
+	}
+
+	void CFLibXmlCoreUtf8Transcoder::append( std::string& target, const XMLCh* chars, XMLSize_t length ) {
+		if( ( chars == NULL ) || ( length <= 0 ) ) {
+			return;
+		}
+
+		// Most text is ASCII, so reserve one byte per character up front, but never
+		// shrink the growth factor the string would have applied on its own.
+		std::string::size_type required = target.length() + length;
+		if( required > target.capacity() ) {
+			std::string::size_type doubled = target.capacity() * 2;
+			target.reserve( ( doubled > required ) ? doubled : required );
+		}
+
+		const XMLCh* cur = chars;
+		const XMLCh* end = chars + length;
+
+		if( pendingHighSurrogate != 0 ) {
+			XMLCh high = pendingHighSurrogate;
+			pendingHighSurrogate = 0;
+			if( ( *cur >= 0xdc00 ) && ( *cur <= 0xdfff ) ) {
+				appendCodePoint( target, 0x10000 + ( ( (uint32_t)( high - 0xd800 ) ) << 10 ) + (uint32_t)( *cur - 0xdc00 ) );
+				cur ++;
+			}
+			else {
+				appendCodePoint( target, REPLACEMENT_CHARACTER );
+			}
+		}
+
+		while( cur < end ) {
+			const XMLCh* run = cur;
+			while( ( run < end ) && ( *run < 0x80 ) ) {
+				run ++;
+			}
+			if( run > cur ) {
+				std::string::size_type oldLen = target.length();
+				std::string::size_type runLen = run - cur;
+				target.resize( oldLen + runLen );
+				char* out = &target[ oldLen ];
+				for( std::string::size_type i = 0; i < runLen; i++ ) {
+					out[i] = (char)( cur[i] );
+				}
+				cur = run;
+				continue;
+			}
+
+			XMLCh ch = *cur++;
+			if( ( ch >= 0xd800 ) && ( ch <= 0xdbff ) ) {
+				if( cur >= end ) {
+					pendingHighSurrogate = ch;
+				}
+				else if( ( *cur >= 0xdc00 ) && ( *cur <= 0xdfff ) ) {
+					appendCodePoint( target, 0x10000 + ( ( (uint32_t)( ch - 0xd800 ) ) << 10 ) + (uint32_t)( *cur - 0xdc00 ) );
+					cur ++;
+				}
+				else {
+					appendCodePoint( target, REPLACEMENT_CHARACTER );
+				}
+			}
+			else if( ( ch >= 0xdc00 ) && ( ch <= 0xdfff ) ) {
+				appendCodePoint( target, REPLACEMENT_CHARACTER );
+			}
+			else {
+				appendCodePoint( target, (uint32_t)ch );
+			}
+		}
+	}
+}
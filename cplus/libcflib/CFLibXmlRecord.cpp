@@ -0,0 +1,228 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cflib/CFLibXmlRecord.hpp>
+#include <cflib/CFLibArgumentRangeException.hpp>
+#include <cflib/CFLibXmlUtil.hpp>
+
+namespace cflib {
+
+	const std::string CFLibXmlRecord::CLASS_NAME( "CFLibXmlRecord" );
+
+	// Namespace scope rather than function-local, so the per-record
+	// accessors do not test an initialization guard on every call
+	static const std::string S_ProcGetAttributeName( "getAttributeName" );
+	static const std::string S_ArgIdx( "idx" );
+	static const std::string S_ProcGetAttributeValue( "getAttributeValue" );
+	static const std::string S_ProcTryGetAttributeInt16( "tryGetAttributeInt16" );
+	static const std::string S_ProcTryGetAttributeInt32( "tryGetAttributeInt32" );
+	static const std::string S_ProcTryGetAttributeInt64( "tryGetAttributeInt64" );
+	static const std::string S_ProcTryGetAttributeUInt16( "tryGetAttributeUInt16" );
+	static const std::string S_ProcTryGetAttributeUInt32( "tryGetAttributeUInt32" );
+	static const std::string S_ProcTryGetAttributeUInt64( "tryGetAttributeUInt64" );
+	static const std::string S_ProcTryGetAttributeFloat( "tryGetAttributeFloat" );
+	static const std::string S_ProcTryGetAttributeDouble( "tryGetAttributeDouble" );
+	static const std::string S_ProcTryGetAttributeTimestamp( "tryGetAttributeTimestamp" );
+	static const std::string S_ProcTryGetAttributeUuid( "tryGetAttributeUuid" );
+	static const std::string S_Empty( "" );
+	static const std::string S_AttributeNotFound( "Attribute not found" );
+
+	CFLibXmlRecord::CFLibXmlRecord() {
+		attrCount = 0;
+	}
+
+	CFLibXmlRecord::~CFLibXmlRecord() {
+	}
+
+	void CFLibXmlRecord::clear() {
+		elementName.clear();
+		attrCount = 0;
+	}
+
+	const std::string& CFLibXmlRecord::getElementName() const {
+		return( elementName );
+	}
+
+	void CFLibXmlRecord::setElementName( const XMLCh* qName, CFLibXmlCoreUtf8Transcoder& transcoder ) {
+		elementName.clear();
+		if( qName != NULL ) {
+			transcoder.append( elementName, qName, xercesc::XMLString::stringLen( qName ) );
+			transcoder.reset( elementName );
+		}
+	}
+
+	std::vector<std::string>::size_type CFLibXmlRecord::getAttributeCount() const {
+		return( attrCount );
+	}
+
+	const std::string& CFLibXmlRecord::getAttributeName( std::vector<std::string>::size_type idx ) const {
+		if( idx >= attrCount ) {
+			throw CFLibArgumentRangeException( CLASS_NAME,
+				S_ProcGetAttributeName,
+				1,
+				S_ArgIdx,
+				(int64_t)idx,
+				(int64_t)0,
+				(int64_t)attrCount - 1 );
+		}
+		return( attrNames[idx] );
+	}
+
+	const std::string& CFLibXmlRecord::getAttributeValue( std::vector<std::string>::size_type idx ) const {
+		if( idx >= attrCount ) {
+			throw CFLibArgumentRangeException( CLASS_NAME,
+				S_ProcGetAttributeValue,
+				1,
+				S_ArgIdx,
+				(int64_t)idx,
+				(int64_t)0,
+				(int64_t)attrCount - 1 );
+		}
+		return( attrValues[idx] );
+	}
+
+	const std::string* CFLibXmlRecord::findAttributeValue( const std::string& name ) const {
+		for( std::vector<std::string>::size_type idx = 0; idx < attrCount; idx++ ) {
+			if( attrNames[idx] == name ) {
+				return( &attrValues[idx] );
+			}
+		}
+		return( NULL );
+	}
+
+	/**
+	 *	Report an absent attribute as STATUS_NULL for the tryGetAttribute* methods.
+	 */
+	static CFLibStatus attributeNotFound( const std::string& procName, const std::string& name ) {
+		return( CFLibStatus( CFLibStatus::STATUS_NULL,
+			CFLibXmlRecord::CLASS_NAME,
+			procName,
+			1,
+			name,
+			S_Empty,
+			S_AttributeNotFound ) );
+	}
+
+	TCFLibResult<std::int16_t> CFLibXmlRecord::tryGetAttributeInt16( const std::string& name ) const {
+		const std::string* value = findAttributeValue( name );
+		if( value == NULL ) {
+			return( TCFLibResult<std::int16_t>( attributeNotFound( S_ProcTryGetAttributeInt16, name ) ) );
+		}
+		return( CFLibXmlUtil::tryParseInt16( name, *value ) );
+	}
+
+	TCFLibResult<std::int32_t> CFLibXmlRecord::tryGetAttributeInt32( const std::string& name ) const {
+		const std::string* value = findAttributeValue( name );
+		if( value == NULL ) {
+			return( TCFLibResult<std::int32_t>( attributeNotFound( S_ProcTryGetAttributeInt32, name ) ) );
+		}
+		return( CFLibXmlUtil::tryParseInt32( name, *value ) );
+	}
+
+	TCFLibResult<std::int64_t> CFLibXmlRecord::tryGetAttributeInt64( const std::string& name ) const {
+		const std::string* value = findAttributeValue( name );
+		if( value == NULL ) {
+			return( TCFLibResult<std::int64_t>( attributeNotFound( S_ProcTryGetAttributeInt64, name ) ) );
+		}
+		return( CFLibXmlUtil::tryParseInt64( name, *value ) );
+	}
+
+	TCFLibResult<std::uint16_t> CFLibXmlRecord::tryGetAttributeUInt16( const std::string& name ) const {
+		const std::string* value = findAttributeValue( name );
+		if( value == NULL ) {
+			return( TCFLibResult<std::uint16_t>( attributeNotFound( S_ProcTryGetAttributeUInt16, name ) ) );
+		}
+		return( CFLibXmlUtil::tryParseUInt16( name, *value ) );
+	}
+
+	TCFLibResult<std::uint32_t> CFLibXmlRecord::tryGetAttributeUInt32( const std::string& name ) const {
+		const std::string* value = findAttributeValue( name );
+		if( value == NULL ) {
+			return( TCFLibResult<std::uint32_t>( attributeNotFound( S_ProcTryGetAttributeUInt32, name ) ) );
+		}
+		return( CFLibXmlUtil::tryParseUInt32( name, *value ) );
+	}
+
+	TCFLibResult<std::uint64_t> CFLibXmlRecord::tryGetAttributeUInt64( const std::string& name ) const {
+		const std::string* value = findAttributeValue( name );
+		if( value == NULL ) {
+			return( TCFLibResult<std::uint64_t>( attributeNotFound( S_ProcTryGetAttributeUInt64, name ) ) );
+		}
+		return( CFLibXmlUtil::tryParseUInt64( name, *value ) );
+	}
+
+	TCFLibResult<float> CFLibXmlRecord::tryGetAttributeFloat( const std::string& name ) const {
+		const std::string* value = findAttributeValue( name );
+		if( value == NULL ) {
+			return( TCFLibResult<float>( attributeNotFound( S_ProcTryGetAttributeFloat, name ) ) );
+		}
+		return( CFLibXmlUtil::tryParseFloat( name, *value ) );
+	}
+
+	TCFLibResult<double> CFLibXmlRecord::tryGetAttributeDouble( const std::string& name ) const {
+		const std::string* value = findAttributeValue( name );
+		if( value == NULL ) {
+			return( TCFLibResult<double>( attributeNotFound( S_ProcTryGetAttributeDouble, name ) ) );
+		}
+		return( CFLibXmlUtil::tryParseDouble( name, *value ) );
+	}
+
+	TCFLibResult<std::chrono::system_clock::time_point> CFLibXmlRecord::tryGetAttributeTimestamp( const std::string& name ) const {
+		const std::string* value = findAttributeValue( name );
+		if( value == NULL ) {
+			return( TCFLibResult<std::chrono::system_clock::time_point>( attributeNotFound( S_ProcTryGetAttributeTimestamp, name ) ) );
+		}
+		return( CFLibXmlUtil::tryParseTimestamp( name, *value ) );
+	}
+
+	TCFLibResult<CFLibUuid> CFLibXmlRecord::tryGetAttributeUuid( const std::string& name ) const {
+		const std::string* value = findAttributeValue( name );
+		if( value == NULL ) {
+			return( TCFLibResult<CFLibUuid>( attributeNotFound( S_ProcTryGetAttributeUuid, name ) ) );
+		}
+		return( CFLibXmlUtil::tryParseUuid( name, *value ) );
+	}
+
+	void CFLibXmlRecord::addAttribute( const XMLCh* qName, const XMLCh* value, CFLibXmlCoreUtf8Transcoder& transcoder ) {
+		if( attrCount >= attrNames.size() ) {
+			attrNames.resize( attrCount + 1 );
+			attrValues.resize( attrCount + 1 );
+		}
+		std::string& name = attrNames[attrCount];
+		std::string& text = attrValues[attrCount];
+		name.clear();
+		text.clear();
+		if( qName != NULL ) {
+			transcoder.append( name, qName, xercesc::XMLString::stringLen( qName ) );
+			transcoder.reset( name );
+		}
+		if( value != NULL ) {
+			transcoder.append( text, value, xercesc::XMLString::stringLen( value ) );
+			transcoder.reset( text );
+		}
+		attrCount ++;
+	}
+}
@@ -0,0 +1,231 @@
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cflib/ICFLibPublic.hpp>
+#include <cflib/CFLibXmlRecordReader.hpp>
+
+namespace cflib {
+
+	const std::string CFLibXmlRecordReader::CLASS_NAME( "CFLibXmlRecordReader" );
+	const int CFLibXmlRecordReader::DEFAULT_RECORD_DEPTH = 2;
+
+	CFLibXmlRecordReader::CFLibXmlRecordReader()
+	: CFLibXmlCoreSaxParser()
+	{
+		ownedInputSource = NULL;
+		isOpen = false;
+		atEnd = true;
+		recordReady = false;
+		curDepth = 0;
+		recordDepth = DEFAULT_RECORD_DEPTH;
+	}
+
+	CFLibXmlRecordReader::CFLibXmlRecordReader( ICFLibMessageLog* jLogger )
+	: CFLibXmlCoreSaxParser( jLogger )
+	{
+		ownedInputSource = NULL;
+		isOpen = false;
+		atEnd = true;
+		recordReady = false;
+		curDepth = 0;
+		recordDepth = DEFAULT_RECORD_DEPTH;
+	}
+
+	CFLibXmlRecordReader::~CFLibXmlRecordReader() {
+		try {
+			close();
+		}
+		catch( ... ) {
+		}
+	}
+
+	int CFLibXmlRecordReader::getRecordDepth() const {
+		return( recordDepth );
+	}
+
+	void CFLibXmlRecordReader::setRecordDepth( int value ) {
+		static const std::string S_ProcName( "setRecordDepth" );
+		static const std::string S_ArgValue( "value" );
+		if( value < 1 ) {
+			throw CFLibArgumentRangeException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgValue,
+				(int32_t)value,
+				(int32_t)1,
+				(int32_t)INT32_MAX );
+		}
+		recordDepth = value;
+	}
+
+	void CFLibXmlRecordReader::open( const std::string& fileName ) {
+		static const std::string S_ProcName( "open" );
+		static const std::string S_ArgFileName( "fileName" );
+		if( fileName.empty() ) {
+			throw CFLibEmptyArgumentException( CLASS_NAME,
+				S_ProcName,
+				1,
+				S_ArgFileName );
+		}
+		close();
+		XMLCh* xFileName = xercesc::XMLString::transcode( fileName.c_str() );
+		try {
+			ownedInputSource = new xercesc::LocalFileInputSource( xFileName );
+		}
+		catch( ... ) {
+			xercesc::XMLString::release( &xFileName );
+			throw;
+		}
+		xercesc::XMLString::release( &xFileName );
+		beginParse( *ownedInputSource );
+	}
+
+	void CFLibXmlRecordReader::open( const xercesc::InputSource& src ) {
+		close();
+		beginParse( src );
+	}
+
+	void CFLibXmlRecordReader::beginParse( const xercesc::InputSource& src ) {
+		static const std::string S_ProcName( "beginParse" );
+		static const std::string S_MsgParseFirstFailed( "Could not start progressive parse of input" );
+		CFLIB_EXCEPTION_DECLINFO
+		initParser();
+		curDepth = 0;
+		recordReady = false;
+		atEnd = false;
+		record.clear();
+		bool started = false;
+		try {
+			applyValidationMode();
+			started = saxXmlReader->parseFirst( src, scanToken );
+		}
+		CFLIB_EXCEPTION_CATCH_FALLTHROUGH
+
+		if( ( ! CFLIB_EXCEPTION_EMPTY ) || ( ! started ) ) {
+			atEnd = true;
+			if( ownedInputSource != NULL ) {
+				delete ownedInputSource;
+				ownedInputSource = NULL;
+			}
+		}
+
+		CFLIB_EXCEPTION_RETHROW_CFLIBEXCEPTION
+
+		if( ! started ) {
+			throw CFLibInvalidArgumentException( CLASS_NAME,
+				S_ProcName,
+				S_MsgParseFirstFailed );
+		}
+		isOpen = true;
+	}
+
+	bool CFLibXmlRecordReader::next() {
+		static const std::string S_ProcName( "next" );
+		static const std::string S_MsgNotOpen( "open() must be called first" );
+		CFLIB_EXCEPTION_DECLINFO
+		if( ! isOpen ) {
+			throw CFLibUsageException( CLASS_NAME,
+				S_ProcName,
+				S_MsgNotOpen );
+		}
+		recordReady = false;
+		if( atEnd ) {
+			return( false );
+		}
+		try {
+			while( ! recordReady ) {
+				if( ! saxXmlReader->parseNext( scanToken ) ) {
+					atEnd = true;
+					countValidatedDocument();
+					break;
+				}
+			}
+		}
+		CFLIB_EXCEPTION_CATCH_FALLTHROUGH
+
+		if( ! CFLIB_EXCEPTION_EMPTY ) {
+			atEnd = true;
+			recordReady = false;
+		}
+
+		CFLIB_EXCEPTION_RETHROW_CFLIBEXCEPTION
+
+		return( recordReady );
+	}
+
+	const CFLibXmlRecord& CFLibXmlRecordReader::getRecord() const {
+		return( record );
+	}
+
+	void CFLibXmlRecordReader::close() {
+		if( isOpen && ( ! atEnd ) && ( saxXmlReader != NULL ) ) {
+			try {
+				saxXmlReader->parseReset( scanToken );
+			}
+			catch( ... ) {
+			}
+		}
+		isOpen = false;
+		atEnd = true;
+		recordReady = false;
+		curDepth = 0;
+		record.clear();
+		if( ownedInputSource != NULL ) {
+			delete ownedInputSource;
+			ownedInputSource = NULL;
+		}
+	}
+
+	void CFLibXmlRecordReader::startElement(
+		const XMLCh* const /* uri */,
+		const XMLCh* const /* localname */,
+		const XMLCh* const qname,
+		const xercesc::Attributes& attrs )
+	{
+		curDepth ++;
+		if( curDepth != recordDepth ) {
+			return;
+		}
+		CFLibXmlCoreUtf8Transcoder& transcoder = getUtf8Transcoder();
+		record.clear();
+		record.setElementName( qname, transcoder );
+		XMLSize_t numAttrs = attrs.getLength();
+		for( XMLSize_t idx = 0; idx < numAttrs; idx++ ) {
+			record.addAttribute( attrs.getQName( idx ), attrs.getValue( idx ), transcoder );
+		}
+		recordReady = true;
+	}
+
+	void CFLibXmlRecordReader::endElement(
+		const XMLCh* const /* uri */,
+		const XMLCh* const /* localname */,
+		const XMLCh* const /* qname */ )
+	{
+		if( curDepth > 0 ) {
+			curDepth --;
+		}
+	}
+}
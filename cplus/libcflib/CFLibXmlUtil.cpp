@@ -31,6 +31,12 @@
 #include <cflib/CFLibGenericBigDecimal.hpp>
 #include <xercesc/util/XMLString.hpp>
 
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
+#include <string_view>
+
 namespace cflib {
 
 	const std::string CFLibXmlUtil::CLASS_NAME( "CFLibXmlUtil" );
@@ -40,9 +46,95 @@ namespace cflib {
 	const std::string CFLibXmlUtil::S_EXPECTED_SIGNED_DIGITS( "Expected signed digits" );
 	const std::string CFLibXmlUtil::S_EXPECTED_DIGITS( "Expected unsigned digits" );
 	const std::string CFLibXmlUtil::S_EXPECTED_DECIMAL_NUMBER( "Expected decimal number" );
+	const std::string CFLibXmlUtil::S_EXPECTED_TIMESTAMP( "Invalid value format, must be YYYY-MM-DDTHH:MI:SS" );
+	const std::string CFLibXmlUtil::S_EXPECTED_UUID( "Invalid value format, must be xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" );
 
 	const char CFLibXmlUtil::S_UTC[4] = "UTC";
 
+	/*
+	 *	Procedure names live at namespace scope instead of in function-local
+	 *	statics, so the parse, eval and format functions do not test an
+	 *	initialization guard on every call.  They stay std::strings because
+	 *	the exceptions and CFLibStatus take them by reference.
+	 */
+	static const std::string S_ProcEvalBlob( "evalBlob" );
+	static const std::string S_ProcEvalDate( "evalDate" );
+	static const std::string S_ProcEvalDouble( "evalDouble" );
+	static const std::string S_ProcEvalFloat( "evalFloat" );
+	static const std::string S_ProcEvalInt16( "evalInt16" );
+	static const std::string S_ProcEvalInt32( "evalInt32" );
+	static const std::string S_ProcEvalInt64( "evalInt64" );
+	static const std::string S_ProcEvalTZDate( "evalTZDate" );
+	static const std::string S_ProcEvalTZTime( "evalTZTime" );
+	static const std::string S_ProcEvalTZTimestamp( "evalTZTimestamp" );
+	static const std::string S_ProcEvalTime( "evalTime" );
+	static const std::string S_ProcEvalTimestamp( "evalTimestamp" );
+	static const std::string S_ProcEvalUInt16( "evalUInt16" );
+	static const std::string S_ProcEvalUInt32( "evalUInt32" );
+	static const std::string S_ProcEvalUInt64( "evalUInt64" );
+	static const std::string S_ProcEvalXmlString( "evalXmlString" );
+	static const std::string S_ProcEvalXmlStringWhitespacePreserve( "evalXmlStringWhitespacePreserve" );
+	static const std::string S_ProcFormatXmlString( "formatXmlString" );
+	static const std::string S_ProcFormatXmlStringWhitespacePreserve( "formatXmlStringWhitespacePreserve" );
+	static const std::string S_ProcParseBlob( "parseBlob" );
+	static const std::string S_ProcParseDate( "parseDate" );
+	static const std::string S_ProcParseDouble( "parseDouble" );
+	static const std::string S_ProcParseFloat( "parseFloat" );
+	static const std::string S_ProcParseInt16( "parseInt16" );
+	static const std::string S_ProcParseInt32( "parseInt32" );
+	static const std::string S_ProcParseInt64( "parseInt64" );
+	static const std::string S_ProcParseTZDate( "parseTZDate" );
+	static const std::string S_ProcParseTZTime( "parseTZTime" );
+	static const std::string S_ProcParseTZTimestamp( "parseTZTimestamp" );
+	static const std::string S_ProcParseTime( "parseTime" );
+	static const std::string S_ProcParseTimestamp( "parseTimestamp" );
+	static const std::string S_ProcParseUInt16( "parseUInt16" );
+	static const std::string S_ProcParseUInt32( "parseUInt32" );
+	static const std::string S_ProcParseUInt64( "parseUInt64" );
+	static const std::string S_ProcParseUuid( "parseUuid" );
+	static const std::string S_ProcParseXmlString( "parseXmlString" );
+	static const std::string S_ProcParseXmlStringWhitespacePreserve( "parseXmlStringWhitespacePreserve" );
+	static const std::string S_ProcTryParseDouble( "tryParseDouble" );
+	static const std::string S_ProcTryParseFloat( "tryParseFloat" );
+	static const std::string S_ProcTryParseInt16( "tryParseInt16" );
+	static const std::string S_ProcTryParseInt32( "tryParseInt32" );
+	static const std::string S_ProcTryParseInt64( "tryParseInt64" );
+	static const std::string S_ProcTryParseTimestamp( "tryParseTimestamp" );
+	static const std::string S_ProcTryParseUuid( "tryParseUuid" );
+	static const std::string S_ProcTryParseUInt16( "tryParseUInt16" );
+	static const std::string S_ProcTryParseUInt32( "tryParseUInt32" );
+	static const std::string S_ProcTryParseUInt64( "tryParseUInt64" );
+	static const std::string S_Base64Decode( "base64_decode()" );
+
+	/*
+	 *	Literal text used to build values and messages needs neither dynamic
+	 *	initialization nor a guard.
+	 */
+	static constexpr std::string_view S_Amp( "&" );
+	static constexpr std::string_view S_BuffFormat( "%RNf" );
+	static constexpr std::string_view S_EqualQuote( "=\"" );
+	static constexpr std::string_view S_EscAPos( "&apos;" );
+	static constexpr std::string_view S_EscGt( "&gt;" );
+	static constexpr std::string_view S_EscLt( "&lt;" );
+	static constexpr std::string_view S_EscQuot( "&quot;" );
+	static constexpr std::string_view S_False( "false" );
+	static constexpr std::string_view S_Gt( ">" );
+	static constexpr std::string_view S_InvalidDateFormat( "Invalid value format, must be YYYY-MM-DD, \"" );
+	static constexpr std::string_view S_InvalidTZDateFormat( "Invalid value format, must be YYYY-MM-DDZ or YYYY-MM-DD+HO:MO, \"" );
+	static constexpr std::string_view S_InvalidTZTimeFormat( "Invalid value format, must be HH:MI:SSZ or HH:MI:SS+HO:MO, \"" );
+	static constexpr std::string_view S_InvalidTZTimestampFormat( "Invalid value format, must be YYYY-MM-DDTHH:MI:SSZ or YYYY-MM-DDTHH:MI:SS+HO:MO, \"" );
+	static constexpr std::string_view S_InvalidTimeFormat( "Invalid value format, must be HH:MI:SS, \"" );
+	static constexpr std::string_view S_InvalidTimestampFormat( "Invalid value format, must be YYYY-MM-DDTHH:MI:SS, \"" );
+	static constexpr std::string_view S_InvalidUuidFormat( "Invalid value format, must be xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx, \"" );
+	static constexpr std::string_view S_Lt( "<" );
+	static constexpr std::string_view S_Quot( "\"" );
+	static constexpr std::string_view S_Quote( "\"" );
+	static constexpr std::string_view S_SQuot( "'" );
+	static constexpr std::string_view S_Semi( ";" );
+	static constexpr std::string_view S_True( "true" );
+	static constexpr std::string_view S_Unicode10( "&#10;" );
+	static constexpr std::string_view S_Unicode13( "&#13;" );
+
 	/**
 	 *	Parsing for XML attribute content strings.
 	**/
@@ -70,15 +162,13 @@ namespace cflib {
 	}
 
 	std::vector<BYTE>* CFLibXmlUtil::parseBlob( const std::string& value ) {
-		static const std::string S_ProcName( "parseBlob" );
-		static const std::string S_Base64Decode( "base64_decode()" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		std::vector<BYTE>* vec = CFLib::base64_decode( value );
 		if( vec == NULL ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseBlob,
 				0,
 				S_Base64Decode );
 		}
@@ -86,13 +176,12 @@ namespace cflib {
 	}
 
 	std::int16_t* CFLibXmlUtil::parseInt16( const std::string& value ) {
-		static const std::string S_ProcName( "parseInt16" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseInt16,
 				1,
 				S_VALUE,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -106,13 +195,12 @@ namespace cflib {
 	}
 
 	std::int16_t* CFLibXmlUtil::parseInt16( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseInt16" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseInt16,
 				1,
 				fieldName,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -126,13 +214,12 @@ namespace cflib {
 	}
 
 	std::int32_t* CFLibXmlUtil::parseInt32( const std::string& value ) {
-		static const std::string S_ProcName( "parseInt32" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseInt32,
 				1,
 				S_VALUE,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -146,13 +233,12 @@ namespace cflib {
 	}
 
 	std::int32_t* CFLibXmlUtil::parseInt32( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseInt32" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseInt32,
 				1,
 				fieldName,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -166,13 +252,12 @@ namespace cflib {
 	}
 
 	std::int64_t* CFLibXmlUtil::parseInt64( const std::string& value ) {
-		static const std::string S_ProcName( "parseInt64" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseInt64,
 				1,
 				S_VALUE,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -186,13 +271,12 @@ namespace cflib {
 	}
 
 	std::int64_t* CFLibXmlUtil::parseInt64( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseInt64" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseInt64,
 				1,
 				fieldName,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -206,13 +290,12 @@ namespace cflib {
 	}
 
 	std::uint16_t* CFLibXmlUtil::parseUInt16( const std::string& value ) {
-		static const std::string S_ProcName( "parseUInt16" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseUInt16,
 				1,
 				S_VALUE,
 				S_EXPECTED_DIGITS );
@@ -226,13 +309,12 @@ namespace cflib {
 	}
 
 	std::uint16_t* CFLibXmlUtil::parseUInt16( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseUInt16" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseUInt16,
 				1,
 				fieldName,
 				S_EXPECTED_DIGITS );
@@ -246,13 +328,12 @@ namespace cflib {
 	}
 
 	std::uint32_t* CFLibXmlUtil::parseUInt32( const std::string& value ) {
-		static const std::string S_ProcName( "parseUInt32" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseUInt32,
 				1,
 				S_VALUE,
 				S_EXPECTED_DIGITS );
@@ -266,13 +347,12 @@ namespace cflib {
 	}
 
 	std::uint32_t* CFLibXmlUtil::parseUInt32( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseUInt32" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseUInt32,
 				1,
 				fieldName,
 				S_EXPECTED_DIGITS );
@@ -286,13 +366,12 @@ namespace cflib {
 	}
 
 	std::uint64_t* CFLibXmlUtil::parseUInt64( const std::string& value ) {
-		static const std::string S_ProcName( "parseUInt64" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseUInt64,
 				1,
 				S_VALUE,
 				S_EXPECTED_DIGITS );
@@ -306,13 +385,12 @@ namespace cflib {
 	}
 
 	std::uint64_t* CFLibXmlUtil::parseUInt64( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseUInt64" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseUInt64,
 				1,
 				fieldName,
 				S_EXPECTED_DIGITS );
@@ -326,13 +404,12 @@ namespace cflib {
 	}
 
 	float* CFLibXmlUtil::parseFloat( const std::string& value ) {
-		static const std::string S_ProcName( "parseFloat" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, true, true ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseFloat,
 				1,
 				S_VALUE,
 				S_EXPECTED_DECIMAL_NUMBER );
@@ -345,13 +422,12 @@ namespace cflib {
 	}
 
 	float* CFLibXmlUtil::parseFloat( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseFloat" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, true, true ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseFloat,
 				1,
 				fieldName,
 				S_EXPECTED_DECIMAL_NUMBER );
@@ -364,13 +440,12 @@ namespace cflib {
 	}
 
 	double* CFLibXmlUtil::parseDouble( const std::string& value ) {
-		static const std::string S_ProcName( "parseDouble" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, true, true ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseDouble,
 				1,
 				S_VALUE,
 				S_EXPECTED_DECIMAL_NUMBER );
@@ -383,13 +458,12 @@ namespace cflib {
 	}
 
 	double* CFLibXmlUtil::parseDouble( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseDouble" );
 		if( value.length() <= 0 ) {
 			return( NULL );
 		}
 		if( ! isDigits( value, true, true ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseDouble,
 				1,
 				fieldName,
 				S_EXPECTED_DECIMAL_NUMBER );
@@ -402,13 +476,6 @@ namespace cflib {
 	}
 
 	std::string* CFLibXmlUtil::parseXmlString( const std::string& value ) {
-		static const std::string S_ProcName( "parseXmlString" );
-		static const std::string S_Amp( "&" );
-		static const std::string S_Lt( "<" );
-		static const std::string S_Gt( ">" );
-		static const std::string S_Quot( "\"" );
-		static const std::string S_SQuot( "'" );
-		static const std::string S_Semi( ";" );
 
 		std::string* retval = new std::string();
 		std::string::size_type len = value.length();
@@ -488,7 +555,7 @@ namespace cflib {
 				else {
 					std::string Msg( "Unrecognized escape tag '" + tag + "'" );
 					throw CFLibUsageException( CLASS_NAME,
-						S_ProcName,
+						S_ProcParseXmlString,
 						Msg );
 				}
 			}
@@ -501,13 +568,6 @@ namespace cflib {
 	}
 
 	std::string* CFLibXmlUtil::parseXmlString( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseXmlString" );
-		static const std::string S_Amp( "&" );
-		static const std::string S_Lt( "<" );
-		static const std::string S_Gt( ">" );
-		static const std::string S_Quot( "\"" );
-		static const std::string S_SQuot( "'" );
-		static const std::string S_Semi( ";" );
 
 		std::string* retval = new std::string();
 		std::string::size_type len = value.length();
@@ -574,13 +634,6 @@ namespace cflib {
 	}
 
 	std::string* CFLibXmlUtil::parseXmlStringWhitespacePreserve( const std::string& value ) {
-		static const std::string S_ProcName( "parseXmlStringWhitespacePreserve" );
-		static const std::string S_Amp( "&" );
-		static const std::string S_Lt( "<" );
-		static const std::string S_Gt( ">" );
-		static const std::string S_Quot( "\"" );
-		static const std::string S_SQuot( "'" );
-		static const std::string S_Semi( ";" );
 
 		std::string* retval = new std::string();
 		std::string::size_type len = value.length();
@@ -647,13 +700,6 @@ namespace cflib {
 	}
 
 	std::string* CFLibXmlUtil::parseXmlStringWhitespacePreserve( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseXmlStringWhitespacePreserve" );
-		static const std::string S_Amp( "&" );
-		static const std::string S_Lt( "<" );
-		static const std::string S_Gt( ">" );
-		static const std::string S_Quot( "\"" );
-		static const std::string S_SQuot( "'" );
-		static const std::string S_Semi( ";" );
 
 		std::string* retval = new std::string();
 		std::string::size_type len = value.length();
@@ -720,8 +766,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseDate( const std::string& value ) {
-		static const std::string S_ProcName( "parseDate" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DD, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -729,11 +773,11 @@ namespace cflib {
 		}
 
 		if( value.length() != 10 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseDate,
 				1,
 				S_VALUE,
 				buff );
@@ -750,11 +794,11 @@ namespace cflib {
 				&& isdigit( value.at(8) )
 				&& isdigit( value.at(9) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseDate,
 				1,
 				S_VALUE,
 				buff );
@@ -797,8 +841,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseDate( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseDate" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DD, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -806,11 +848,11 @@ namespace cflib {
 		}
 
 		if( value.length() != 10 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseDate,
 				1,
 				fieldName,
 				buff );
@@ -827,11 +869,11 @@ namespace cflib {
 				&& isdigit( value.at(8) )
 				&& isdigit( value.at(9) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseDate,
 				1,
 				fieldName,
 				buff );
@@ -874,8 +916,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseTime( const std::string& value ) {
-		static const std::string S_ProcName( "parseTime" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be HH:MI:SS, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -883,11 +923,11 @@ namespace cflib {
 		}
 
 		if( value.length() != 8 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTime,
 				1,
 				S_VALUE,
 				buff );
@@ -902,11 +942,11 @@ namespace cflib {
 				&& isdigit( value.at(6) )
 				&& isdigit( value.at(7) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTime,
 				1,
 				S_VALUE,
 				buff );
@@ -949,8 +989,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseTime( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseTime" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be HH:MI:SS, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -958,11 +996,11 @@ namespace cflib {
 		}
 
 		if( value.length() != 8 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTime,
 				1,
 				fieldName,
 				buff );
@@ -977,11 +1015,11 @@ namespace cflib {
 				&& isdigit( value.at(6) )
 				&& isdigit( value.at(7) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTime,
 				1,
 				fieldName,
 				buff );
@@ -1024,8 +1062,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseTimestamp( const std::string& value ) {
-		static const std::string S_ProcName( "parseTimestamp" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDTHH:MI:SS, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -1033,11 +1069,11 @@ namespace cflib {
 		}
 
 		if( value.length() != 19 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTimestamp,
 				1,
 				S_VALUE,
 				buff );
@@ -1063,11 +1099,11 @@ namespace cflib {
 				&& isdigit( value.at(17) )
 				&& isdigit( value.at(18) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTimestamp,
 				1,
 				S_VALUE,
 				buff );
@@ -1127,8 +1163,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseTimestamp( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseTimestamp" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDTHH:MI:SS, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -1136,11 +1170,11 @@ namespace cflib {
 		}
 
 		if( value.length() != 19 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTimestamp,
 				1,
 				fieldName,
 				buff );
@@ -1166,11 +1200,11 @@ namespace cflib {
 				&& isdigit( value.at(17) )
 				&& isdigit( value.at(18) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTimestamp,
 				1,
 				fieldName,
 				buff );
@@ -1230,8 +1264,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseTZDate( const std::string& value ) {
-		static const std::string S_ProcName( "parseTZDate" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDZ or YYYY-MM-DD+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -1240,11 +1272,11 @@ namespace cflib {
 
 		if( ( value.length() != 11 ) && ( value.length() != 16 ) ) {
 			if( value.length() != 19 ) {
-				std::string buff = * new std::string( S_InvalidFormat );
+				std::string buff = * new std::string( S_InvalidTZDateFormat );
 				buff.append( value );
 				buff.append( S_IS_INVALID );
 				throw CFLibInvalidArgumentException( CLASS_NAME,
-					S_ProcName,
+					S_ProcParseTZDate,
 					1,
 					S_VALUE,
 					buff );
@@ -1262,11 +1294,11 @@ namespace cflib {
 				&& isdigit( value.at(8) )
 				&& isdigit( value.at(9) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZDate,
 				1,
 				S_VALUE,
 				buff );
@@ -1403,11 +1435,11 @@ namespace cflib {
 			retval = new std::chrono::system_clock::time_point( converted );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZDate,
 				1,
 				S_VALUE,
 				buff );
@@ -1417,8 +1449,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseTZDate( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseTZDate" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDZ or YYYY-MM-DD+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -1427,11 +1457,11 @@ namespace cflib {
 
 		if( ( value.length() != 11 ) && ( value.length() != 16 ) ) {
 			if( value.length() != 19 ) {
-				std::string buff = * new std::string( S_InvalidFormat );
+				std::string buff = * new std::string( S_InvalidTZDateFormat );
 				buff.append( value );
 				buff.append( S_IS_INVALID );
 				throw CFLibInvalidArgumentException( CLASS_NAME,
-					S_ProcName,
+					S_ProcParseTZDate,
 					1,
 					S_VALUE,
 					buff );
@@ -1440,11 +1470,11 @@ namespace cflib {
 
 		if( ( value.length() != 11 ) && ( value.length() != 16 ) ) {
 			if( value.length() != 19 ) {
-				std::string buff = * new std::string( S_InvalidFormat );
+				std::string buff = * new std::string( S_InvalidTZDateFormat );
 				buff.append( value );
 				buff.append( S_IS_INVALID );
 				throw CFLibInvalidArgumentException( CLASS_NAME,
-					S_ProcName,
+					S_ProcParseTZDate,
 					1,
 					fieldName,
 					buff );
@@ -1462,11 +1492,11 @@ namespace cflib {
 				&& isdigit( value.at(8) )
 				&& isdigit( value.at(9) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZDate,
 				1,
 				fieldName,
 				buff );
@@ -1603,11 +1633,11 @@ namespace cflib {
 			retval = new std::chrono::system_clock::time_point( converted );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZDate,
 				1,
 				fieldName,
 				buff );
@@ -1617,8 +1647,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseTZTime( const std::string& value ) {
-		static const std::string S_ProcName( "parseTZTime" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be HH:MI:SSZ or HH:MI:SS+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -1626,11 +1654,11 @@ namespace cflib {
 		}
 
 		if( ( value.length() != 9 ) && ( value.length() != 14 ) ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTime,
 				1,
 				S_VALUE,
 				buff );
@@ -1645,11 +1673,11 @@ namespace cflib {
 				&& isdigit( value.at(6) )
 				&& isdigit( value.at(7) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTime,
 				1,
 				S_VALUE,
 				buff );
@@ -1777,11 +1805,11 @@ namespace cflib {
 			retval = new std::chrono::system_clock::time_point( converted );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTime,
 				1,
 				S_VALUE,
 				buff );
@@ -1791,8 +1819,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseTZTime( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseTZTime" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be HH:MI:SSZ or HH:MI:SS+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -1800,11 +1826,11 @@ namespace cflib {
 		}
 
 		if( ( value.length() != 9 ) && ( value.length() != 14 ) ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTime,
 				1,
 				fieldName,
 				buff );
@@ -1819,11 +1845,11 @@ namespace cflib {
 				&& isdigit( value.at(6) )
 				&& isdigit( value.at(7) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTime,
 				1,
 				fieldName,
 				buff );
@@ -1951,11 +1977,11 @@ namespace cflib {
 			retval = new std::chrono::system_clock::time_point( converted );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTime,
 				1,
 				fieldName,
 				buff );
@@ -1965,8 +1991,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseTZTimestamp( const std::string& value ) {
-		static const std::string S_ProcName( "parseTZTimestamp" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDTHH:MI:SSZ or YYYY-MM-DDTHH:MI:SS+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -1974,11 +1998,11 @@ namespace cflib {
 		}
 
 		if( ( value.length() != 20 ) && ( value.length() != 25 ) ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTimestamp,
 				1,
 				S_VALUE,
 				buff );
@@ -2004,11 +2028,11 @@ namespace cflib {
 				&& isdigit( value.at(17) )
 				&& isdigit( value.at(18) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTimestamp,
 				1,
 				S_VALUE,
 				buff );
@@ -2196,11 +2220,11 @@ namespace cflib {
 			retval = new std::chrono::system_clock::time_point( converted );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTimestamp,
 				1,
 				S_VALUE,
 				buff );
@@ -2210,8 +2234,6 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point* CFLibXmlUtil::parseTZTimestamp( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseTZTimestamp" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDTHH:MI:SSZ or YYYY-MM-DDTHH:MI:SS+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
@@ -2219,11 +2241,11 @@ namespace cflib {
 		}
 
 		if( ( value.length() != 20 ) && ( value.length() != 25 ) ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTimestamp,
 				1,
 				fieldName,
 				buff );
@@ -2249,11 +2271,11 @@ namespace cflib {
 				&& isdigit( value.at(17) )
 				&& isdigit( value.at(18) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTimestamp,
 				1,
 				fieldName,
 				buff );
@@ -2441,11 +2463,11 @@ namespace cflib {
 			retval = new std::chrono::system_clock::time_point( converted );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseTZTimestamp,
 				1,
 				fieldName,
 				buff );
@@ -2455,8 +2477,6 @@ namespace cflib {
 	}
 
 	void CFLibXmlUtil::parseUuid( uuid_ptr_t target, const std::string& value ) {
-		static const std::string S_ProcName( "parseUuid" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx, \"" );
 
 		if( value.length() == 0 ) {
 			for( int i = 0; i < 16; i++ ) {
@@ -2469,11 +2489,11 @@ namespace cflib {
 			for( int i = 0; i < 16; i++ ) {
 				target[ i ] = 0;
 			}
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidUuidFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseUuid,
 				1,
 				S_VALUE,
 				buff );
@@ -2483,8 +2503,6 @@ namespace cflib {
 	}
 
 	void CFLibXmlUtil::parseUuid( uuid_ptr_t target, const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "parseUuid" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx, \"" );
 
 		if( value.length() == 0 ) {
 			for( int i = 0; i < 16; i++ ) {
@@ -2497,11 +2515,11 @@ namespace cflib {
 			for( int i = 0; i < 16; i++ ) {
 				target[ i ] = 0;
 			}
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidUuidFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseUuid,
 				1,
 				fieldName,
 				buff );
@@ -2547,11 +2565,11 @@ namespace cflib {
 			for( int i = 0; i < 16; i ++ ) {
 				target[i] = 0;
 			}
-			std::string buff( S_InvalidFormat );
+			std::string buff( S_InvalidUuidFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcParseUuid,
 				1,
 				fieldName,
 				buff );
@@ -2560,19 +2578,262 @@ namespace cflib {
 		uuid_parse( value.data(), target );
 	}
 
+	void CFLibXmlUtil::parseUuid( CFLibUuid& target, const std::string& value ) {
+		parseUuid( target, S_VALUE, value );
+	}
+
+	void CFLibXmlUtil::parseUuid( CFLibUuid& target, const std::string& fieldName, const std::string& value ) {
+		if( value.length() == 0 ) {
+			target = CFLibUuid();
+			return;
+		}
+		if( ! CFLibUuid::tryParse( value, target ) ) {
+			target = CFLibUuid();
+			std::string buff( S_InvalidUuidFormat );
+			buff.append( value );
+			buff.append( S_IS_INVALID );
+			throw CFLibInvalidArgumentException( CLASS_NAME,
+				S_ProcParseUuid,
+				1,
+				fieldName,
+				buff );
+		}
+	}
+
+	/**
+	 *	Non-throwing parsing for XML attribute content strings.
+	 */
+
+	template< typename T > static TCFLibResult<T> tryParseSignedDigits( const std::string& procName,
+		const std::string& fieldName,
+		const std::string& value )
+	{
+		if( value.length() <= 0 ) {
+			return( TCFLibResult<T>( CFLibStatus( CFLibStatus::STATUS_NULL, CFLibXmlUtil::CLASS_NAME, procName, 1, fieldName, value, CFLibXmlUtil::S_EXPECTED_SIGNED_DIGITS ) ) );
+		}
+		const char* first = value.data();
+		const char* last = first + value.length();
+		if( ( *first == '+' ) && ( ( first + 1 ) < last ) && ( first[1] != '-' ) ) {
+			first ++;
+		}
+		int64_t parsed = 0;
+		std::from_chars_result converted = std::from_chars( first, last, parsed );
+		if( ( converted.ptr != last ) || ( converted.ec == std::errc::invalid_argument ) ) {
+			return( TCFLibResult<T>( CFLibStatus( CFLibStatus::STATUS_INVALID_ARGUMENT, CFLibXmlUtil::CLASS_NAME, procName, 1, fieldName, value, CFLibXmlUtil::S_EXPECTED_SIGNED_DIGITS ) ) );
+		}
+		if( ( converted.ec == std::errc::result_out_of_range ) || ( parsed > (int64_t)std::numeric_limits<T>::max() ) || ( parsed < (int64_t)std::numeric_limits<T>::min() ) ) {
+			bool negative = ( *first == '-' );
+			CFLibStatus status( negative ? CFLibStatus::STATUS_UNDERFLOW : CFLibStatus::STATUS_OVERFLOW, CFLibXmlUtil::CLASS_NAME, procName, 1, fieldName, value, CFLibXmlUtil::S_EXPECTED_SIGNED_DIGITS );
+			status.setBound( negative ? (int64_t)std::numeric_limits<T>::min() : (int64_t)std::numeric_limits<T>::max() );
+			return( TCFLibResult<T>( status ) );
+		}
+		return( TCFLibResult<T>( (T)parsed ) );
+	}
+
+	template< typename T > static TCFLibResult<T> tryParseUnsignedDigits( const std::string& procName,
+		const std::string& fieldName,
+		const std::string& value )
+	{
+		if( value.length() <= 0 ) {
+			return( TCFLibResult<T>( CFLibStatus( CFLibStatus::STATUS_NULL, CFLibXmlUtil::CLASS_NAME, procName, 1, fieldName, value, CFLibXmlUtil::S_EXPECTED_DIGITS ) ) );
+		}
+		const char* first = value.data();
+		const char* last = first + value.length();
+		uint64_t parsed = 0;
+		std::from_chars_result converted = std::from_chars( first, last, parsed );
+		if( ( converted.ptr != last ) || ( converted.ec == std::errc::invalid_argument ) ) {
+			return( TCFLibResult<T>( CFLibStatus( CFLibStatus::STATUS_INVALID_ARGUMENT, CFLibXmlUtil::CLASS_NAME, procName, 1, fieldName, value, CFLibXmlUtil::S_EXPECTED_DIGITS ) ) );
+		}
+		if( ( converted.ec == std::errc::result_out_of_range ) || ( parsed > (uint64_t)std::numeric_limits<T>::max() ) ) {
+			CFLibStatus status( CFLibStatus::STATUS_OVERFLOW, CFLibXmlUtil::CLASS_NAME, procName, 1, fieldName, value, CFLibXmlUtil::S_EXPECTED_DIGITS );
+			status.setBound( (uint64_t)std::numeric_limits<T>::max() );
+			return( TCFLibResult<T>( status ) );
+		}
+		return( TCFLibResult<T>( (T)parsed ) );
+	}
+
+	/**
+	 *	Parse a decimal number accepted by isDigits( value, true, true ) with strtod().
+	 *	Values too large for a double are reported as overflows, and values
+	 *	too large for the narrower target type T likewise.
+	 */
+	template< typename T > static TCFLibResult<T> tryParseDecimal( const std::string& procName,
+		const std::string& fieldName,
+		const std::string& value )
+	{
+		if( value.length() <= 0 ) {
+			return( TCFLibResult<T>( CFLibStatus( CFLibStatus::STATUS_NULL, CFLibXmlUtil::CLASS_NAME, procName, 1, fieldName, value, CFLibXmlUtil::S_EXPECTED_DECIMAL_NUMBER ) ) );
+		}
+		if( ! CFLibXmlUtil::isDigits( value, true, true ) ) {
+			return( TCFLibResult<T>( CFLibStatus( CFLibStatus::STATUS_INVALID_ARGUMENT, CFLibXmlUtil::CLASS_NAME, procName, 1, fieldName, value, CFLibXmlUtil::S_EXPECTED_DECIMAL_NUMBER ) ) );
+		}
+		const char* first = value.c_str();
+		char* end = NULL;
+		errno = 0;
+		double parsed = std::strtod( first, &end );
+		if( end == first ) {
+			return( TCFLibResult<T>( CFLibStatus( CFLibStatus::STATUS_INVALID_ARGUMENT, CFLibXmlUtil::CLASS_NAME, procName, 1, fieldName, value, CFLibXmlUtil::S_EXPECTED_DECIMAL_NUMBER ) ) );
+		}
+		if( ( ( errno == ERANGE ) && ( parsed != 0.0 ) ) || ( parsed > (double)std::numeric_limits<T>::max() ) || ( parsed < -(double)std::numeric_limits<T>::max() ) ) {
+			bool negative = ( parsed < 0.0 );
+			CFLibStatus status( negative ? CFLibStatus::STATUS_UNDERFLOW : CFLibStatus::STATUS_OVERFLOW, CFLibXmlUtil::CLASS_NAME, procName, 1, fieldName, value, CFLibXmlUtil::S_EXPECTED_DECIMAL_NUMBER );
+			status.setBound( negative ? -(double)std::numeric_limits<T>::max() : (double)std::numeric_limits<T>::max() );
+			return( TCFLibResult<T>( status ) );
+		}
+		return( TCFLibResult<T>( (T)parsed ) );
+	}
+
+	TCFLibResult<std::int16_t> CFLibXmlUtil::tryParseInt16( const std::string& value ) {
+		return( tryParseInt16( S_VALUE, value ) );
+	}
+
+	TCFLibResult<std::int16_t> CFLibXmlUtil::tryParseInt16( const std::string& fieldName, const std::string& value ) {
+		return( tryParseSignedDigits<std::int16_t>( S_ProcTryParseInt16, fieldName, value ) );
+	}
+
+	TCFLibResult<std::int32_t> CFLibXmlUtil::tryParseInt32( const std::string& value ) {
+		return( tryParseInt32( S_VALUE, value ) );
+	}
+
+	TCFLibResult<std::int32_t> CFLibXmlUtil::tryParseInt32( const std::string& fieldName, const std::string& value ) {
+		return( tryParseSignedDigits<std::int32_t>( S_ProcTryParseInt32, fieldName, value ) );
+	}
+
+	TCFLibResult<std::int64_t> CFLibXmlUtil::tryParseInt64( const std::string& value ) {
+		return( tryParseInt64( S_VALUE, value ) );
+	}
+
+	TCFLibResult<std::int64_t> CFLibXmlUtil::tryParseInt64( const std::string& fieldName, const std::string& value ) {
+		return( tryParseSignedDigits<std::int64_t>( S_ProcTryParseInt64, fieldName, value ) );
+	}
+
+	TCFLibResult<std::uint16_t> CFLibXmlUtil::tryParseUInt16( const std::string& value ) {
+		return( tryParseUInt16( S_VALUE, value ) );
+	}
+
+	TCFLibResult<std::uint16_t> CFLibXmlUtil::tryParseUInt16( const std::string& fieldName, const std::string& value ) {
+		return( tryParseUnsignedDigits<std::uint16_t>( S_ProcTryParseUInt16, fieldName, value ) );
+	}
+
+	TCFLibResult<std::uint32_t> CFLibXmlUtil::tryParseUInt32( const std::string& value ) {
+		return( tryParseUInt32( S_VALUE, value ) );
+	}
+
+	TCFLibResult<std::uint32_t> CFLibXmlUtil::tryParseUInt32( const std::string& fieldName, const std::string& value ) {
+		return( tryParseUnsignedDigits<std::uint32_t>( S_ProcTryParseUInt32, fieldName, value ) );
+	}
+
+	TCFLibResult<std::uint64_t> CFLibXmlUtil::tryParseUInt64( const std::string& value ) {
+		return( tryParseUInt64( S_VALUE, value ) );
+	}
+
+	TCFLibResult<std::uint64_t> CFLibXmlUtil::tryParseUInt64( const std::string& fieldName, const std::string& value ) {
+		return( tryParseUnsignedDigits<std::uint64_t>( S_ProcTryParseUInt64, fieldName, value ) );
+	}
+
+	TCFLibResult<float> CFLibXmlUtil::tryParseFloat( const std::string& value ) {
+		return( tryParseFloat( S_VALUE, value ) );
+	}
+
+	TCFLibResult<float> CFLibXmlUtil::tryParseFloat( const std::string& fieldName, const std::string& value ) {
+		return( tryParseDecimal<float>( S_ProcTryParseFloat, fieldName, value ) );
+	}
+
+	TCFLibResult<double> CFLibXmlUtil::tryParseDouble( const std::string& value ) {
+		return( tryParseDouble( S_VALUE, value ) );
+	}
+
+	TCFLibResult<double> CFLibXmlUtil::tryParseDouble( const std::string& fieldName, const std::string& value ) {
+		return( tryParseDecimal<double>( S_ProcTryParseDouble, fieldName, value ) );
+	}
+
+	TCFLibResult<std::chrono::system_clock::time_point> CFLibXmlUtil::tryParseTimestamp( const std::string& value ) {
+		return( tryParseTimestamp( S_VALUE, value ) );
+	}
+
+	TCFLibResult<std::chrono::system_clock::time_point> CFLibXmlUtil::tryParseTimestamp( const std::string& fieldName, const std::string& value ) {
+		// Offsets of the digit fields in YYYY-MM-DDTHH:MI:SS
+		static const int digitOffsets[14] = { 0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, 17, 18 };
+
+		if( value.length() == 0 ) {
+			return( TCFLibResult<std::chrono::system_clock::time_point>( CFLibStatus( CFLibStatus::STATUS_NULL, CLASS_NAME, S_ProcTryParseTimestamp, 1, fieldName, value, S_EXPECTED_TIMESTAMP ) ) );
+		}
+
+		const char* chars = value.data();
+		bool valid = ( value.length() == 19 )
+			&& ( chars[4] == '-' )
+			&& ( chars[7] == '-' )
+			&& ( chars[10] == 'T' )
+			&& ( chars[13] == ':' )
+			&& ( chars[16] == ':' );
+		for( int i = 0; valid && ( i < 14 ); i ++ ) {
+			valid = isdigit( chars[ digitOffsets[i] ] );
+		}
+		if( ! valid ) {
+			return( TCFLibResult<std::chrono::system_clock::time_point>( CFLibStatus( CFLibStatus::STATUS_INVALID_ARGUMENT, CLASS_NAME, S_ProcTryParseTimestamp, 1, fieldName, value, S_EXPECTED_TIMESTAMP ) ) );
+		}
+
+		int iYear = ( chars[0] - '0' ) * 1000 + ( chars[1] - '0' ) * 100 + ( chars[2] - '0' ) * 10 + ( chars[3] - '0' );
+		int iMonth = ( chars[5] - '0' ) * 10 + ( chars[6] - '0' );
+		int iDay = ( chars[8] - '0' ) * 10 + ( chars[9] - '0' );
+		int iHour = ( chars[11] - '0' ) * 10 + ( chars[12] - '0' );
+		int iMin = ( chars[14] - '0' ) * 10 + ( chars[15] - '0' );
+		int iSec = ( chars[17] - '0' ) * 10 + ( chars[18] - '0' );
+
+		// Convert exactly as parseTimestamp() does, mktime() and all, so both
+		// read the same text as the same time point
+		iYear -= 1900;
+		iMonth -= 1;
+		if( iMonth == 12 ) {
+			iYear++;
+			iMonth = 0;
+		}
+
+		struct tm tmRead = { 0 };
+
+		tmRead.tm_year = iYear;
+		tmRead.tm_mon = iMonth;
+		tmRead.tm_mday = iDay;
+		tmRead.tm_hour = iHour;
+		tmRead.tm_min = iMin;
+		tmRead.tm_sec = iSec;
+
+#if !defined(_WINDOWS)
+		tmRead.tm_gmtoff = 0L;
+		tmRead.tm_zone = S_UTC;
+#endif
+
+		time_t timeRead = mktime( &tmRead );
+
+		return( TCFLibResult<std::chrono::system_clock::time_point>( std::chrono::system_clock::from_time_t( timeRead ) ) );
+	}
+
+	TCFLibResult<CFLibUuid> CFLibXmlUtil::tryParseUuid( const std::string& value ) {
+		return( tryParseUuid( S_VALUE, value ) );
+	}
+
+	TCFLibResult<CFLibUuid> CFLibXmlUtil::tryParseUuid( const std::string& fieldName, const std::string& value ) {
+		if( value.length() == 0 ) {
+			return( TCFLibResult<CFLibUuid>( CFLibStatus( CFLibStatus::STATUS_NULL, CLASS_NAME, S_ProcTryParseUuid, 1, fieldName, value, S_EXPECTED_UUID ) ) );
+		}
+		CFLibUuid retval;
+		if( ! CFLibUuid::tryParse( value, retval ) ) {
+			return( TCFLibResult<CFLibUuid>( CFLibStatus( CFLibStatus::STATUS_INVALID_ARGUMENT, CLASS_NAME, S_ProcTryParseUuid, 1, fieldName, value, S_EXPECTED_UUID ) ) );
+		}
+		return( TCFLibResult<CFLibUuid>( retval ) );
+	}
+
 	std::vector<BYTE> CFLibXmlUtil::evalBlob( const std::string& value ) {
-		static const std::string S_ProcName( "evalBlob" );
-		static const std::string S_Base64Decode( "base64_decode()" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalBlob,
 				1,
 				"value" );
 		}
 		std::vector<BYTE>* vec = CFLib::base64_decode( value );
 		if( vec == NULL ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalBlob,
 				0,
 				S_Base64Decode );
 		}
@@ -2583,16 +2844,15 @@ namespace cflib {
 	}
 
 	std::int16_t CFLibXmlUtil::evalInt16( const std::string& value ) {
-		static const std::string S_ProcName( "evalInt16" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt16,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt16,
 				1,
 				S_VALUE,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -2604,16 +2864,15 @@ namespace cflib {
 	}
 
 	std::int16_t CFLibXmlUtil::evalInt16( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalInt16" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt16,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt16,
 				1,
 				fieldName,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -2625,16 +2884,15 @@ namespace cflib {
 	}
 
 	std::int32_t CFLibXmlUtil::evalInt32( const std::string& value ) {
-		static const std::string S_ProcName( "evalInt32" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt32,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt32,
 				1,
 				S_VALUE,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -2646,16 +2904,15 @@ namespace cflib {
 	}
 
 	std::int32_t CFLibXmlUtil::evalInt32( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalInt32" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt32,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt32,
 				1,
 				fieldName,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -2667,16 +2924,15 @@ namespace cflib {
 	}
 
 	std::int64_t CFLibXmlUtil::evalInt64( const std::string& value ) {
-		static const std::string S_ProcName( "evalInt64" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt64,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt64,
 				1,
 				S_VALUE,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -2688,16 +2944,15 @@ namespace cflib {
 	}
 
 	std::int64_t CFLibXmlUtil::evalInt64( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalInt64" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt64,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, true, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalInt64,
 				1,
 				fieldName,
 				S_EXPECTED_SIGNED_DIGITS );
@@ -2709,16 +2964,15 @@ namespace cflib {
 	}
 
 	std::uint16_t CFLibXmlUtil::evalUInt16( const std::string& value ) {
-		static const std::string S_ProcName( "evalUInt16" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt16,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt16,
 				1,
 				S_VALUE,
 				S_EXPECTED_DIGITS );
@@ -2730,16 +2984,15 @@ namespace cflib {
 	}
 
 	std::uint16_t CFLibXmlUtil::evalUInt16( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalUInt16" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt16,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt16,
 				1,
 				fieldName,
 				S_EXPECTED_DIGITS );
@@ -2751,16 +3004,15 @@ namespace cflib {
 	}
 
 	std::uint32_t CFLibXmlUtil::evalUInt32( const std::string& value ) {
-		static const std::string S_ProcName( "evalUInt32" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt32,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt32,
 				1,
 				S_VALUE,
 				S_EXPECTED_DIGITS );
@@ -2772,16 +3024,15 @@ namespace cflib {
 	}
 
 	std::uint32_t CFLibXmlUtil::evalUInt32( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalUInt32" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt32,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt32,
 				1,
 				fieldName,
 				S_EXPECTED_DIGITS );
@@ -2793,16 +3044,15 @@ namespace cflib {
 	}
 
 	std::uint64_t CFLibXmlUtil::evalUInt64( const std::string& value ) {
-		static const std::string S_ProcName( "evalUInt64" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt64,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt64,
 				1,
 				S_VALUE,
 				S_EXPECTED_DIGITS );
@@ -2814,16 +3064,15 @@ namespace cflib {
 	}
 
 	std::uint64_t CFLibXmlUtil::evalUInt64( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalUInt64" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt64,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, false, false ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalUInt64,
 				1,
 				fieldName,
 				S_EXPECTED_DIGITS );
@@ -2835,16 +3084,15 @@ namespace cflib {
 	}
 
 	float CFLibXmlUtil::evalFloat( const std::string& value ) {
-		static const std::string S_ProcName( "evalFloat" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalFloat,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, true, true ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalFloat,
 				1,
 				S_VALUE,
 				S_EXPECTED_DECIMAL_NUMBER );
@@ -2855,16 +3103,15 @@ namespace cflib {
 	}
 
 	float CFLibXmlUtil::evalFloat( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalFloat" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalFloat,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, true, true ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalFloat,
 				1,
 				fieldName,
 				S_EXPECTED_DECIMAL_NUMBER );
@@ -2875,16 +3122,15 @@ namespace cflib {
 	}
 
 	double CFLibXmlUtil::evalDouble( const std::string& value ) {
-		static const std::string S_ProcName( "evalDouble" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalDouble,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, true, true ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalDouble,
 				1,
 				S_VALUE,
 				S_EXPECTED_DECIMAL_NUMBER );
@@ -2895,16 +3141,15 @@ namespace cflib {
 	}
 
 	double CFLibXmlUtil::evalDouble( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalDouble" );
 		if( value.length() <= 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalDouble,
 				1,
 				S_VALUE );
 		}
 		if( ! isDigits( value, true, true ) ) {
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalDouble,
 				1,
 				fieldName,
 				S_EXPECTED_DECIMAL_NUMBER );
@@ -2915,13 +3160,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::evalXmlString( const std::string& value ) {
-		static const std::string S_ProcName( "evalXmlString" );
-		static const std::string S_Amp( "&" );
-		static const std::string S_Lt( "<" );
-		static const std::string S_Gt( ">" );
-		static const std::string S_Quot( "\"" );
-		static const std::string S_SQuot( "'" );
-		static const std::string S_Semi( ";" );
 
 		std::string retval;
 		std::string::size_type len = value.length();
@@ -3001,7 +3239,7 @@ namespace cflib {
 				else {
 					std::string Msg( "Unrecognized escape tag '" + tag + "'" );
 					throw CFLibUsageException( CLASS_NAME,
-						S_ProcName,
+						S_ProcEvalXmlString,
 						Msg );
 				}
 			}
@@ -3014,13 +3252,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::evalXmlString( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalXmlString" );
-		static const std::string S_Amp( "&" );
-		static const std::string S_Lt( "<" );
-		static const std::string S_Gt( ">" );
-		static const std::string S_Quot( "\"" );
-		static const std::string S_SQuot( "'" );
-		static const std::string S_Semi( ";" );
 
 		std::string retval;
 		std::string::size_type len = value.length();
@@ -3087,13 +3318,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::evalXmlStringWhitespacePreserve( const std::string& value ) {
-		static const std::string S_ProcName( "evalXmlStringWhitespacePreserve" );
-		static const std::string S_Amp( "&" );
-		static const std::string S_Lt( "<" );
-		static const std::string S_Gt( ">" );
-		static const std::string S_Quot( "\"" );
-		static const std::string S_SQuot( "'" );
-		static const std::string S_Semi( ";" );
 
 		std::string retval;
 		std::string::size_type len = value.length();
@@ -3160,13 +3384,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::evalXmlStringWhitespacePreserve( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalXmlStringWhitespacePreserve" );
-		static const std::string S_Amp( "&" );
-		static const std::string S_Lt( "<" );
-		static const std::string S_Gt( ">" );
-		static const std::string S_Quot( "\"" );
-		static const std::string S_SQuot( "'" );
-		static const std::string S_Semi( ";" );
 
 		std::string retval;
 		std::string::size_type len = value.length();
@@ -3233,23 +3450,21 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalDate( const std::string& value ) {
-		static const std::string S_ProcName( "evalDate" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DD, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalDate,
 				1,
 				S_VALUE );
 		}
 
 		if( value.length() != 10 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalDate,
 				1,
 				S_VALUE,
 				buff );
@@ -3266,11 +3481,11 @@ namespace cflib {
 				&& isdigit( value.at(8) )
 				&& isdigit( value.at(9) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalDate,
 				1,
 				S_VALUE,
 				buff );
@@ -3309,23 +3524,21 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalDate( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalDate" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DD, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalDate,
 				1,
 				S_VALUE );
 		}
 
 		if( value.length() != 10 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalDate,
 				1,
 				fieldName,
 				buff );
@@ -3342,11 +3555,11 @@ namespace cflib {
 				&& isdigit( value.at(8) )
 				&& isdigit( value.at(9) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalDate,
 				1,
 				fieldName,
 				buff );
@@ -3385,23 +3598,21 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalTime( const std::string& value ) {
-		static const std::string S_ProcName( "evalTime" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be HH:MI:SS, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTime,
 				1,
 				S_VALUE );
 		}
 
 		if( value.length() != 8 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTime,
 				1,
 				S_VALUE,
 				buff );
@@ -3416,11 +3627,11 @@ namespace cflib {
 				&& isdigit( value.at(6) )
 				&& isdigit( value.at(7) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTime,
 				1,
 				S_VALUE,
 				buff );
@@ -3459,23 +3670,21 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalTime( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalTime" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be HH:MI:SS, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTime,
 				1,
 				S_VALUE );
 		}
 
 		if( value.length() != 8 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTime,
 				1,
 				fieldName,
 				buff );
@@ -3490,11 +3699,11 @@ namespace cflib {
 				&& isdigit( value.at(6) )
 				&& isdigit( value.at(7) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTime,
 				1,
 				fieldName,
 				buff );
@@ -3533,23 +3742,21 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalTimestamp( const std::string& value ) {
-		static const std::string S_ProcName( "evalTimestamp" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDTHH:MI:SS, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTimestamp,
 				1,
 				S_VALUE );
 		}
 
 		if( value.length() != 19 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTimestamp,
 				1,
 				S_VALUE,
 				buff );
@@ -3575,11 +3782,11 @@ namespace cflib {
 				&& isdigit( value.at(17) )
 				&& isdigit( value.at(18) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTimestamp,
 				1,
 				S_VALUE,
 				buff );
@@ -3635,23 +3842,21 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalTimestamp( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalTimestamp" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDTHH:MI:SS, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTimestamp,
 				1,
 				S_VALUE );
 		}
 
 		if( value.length() != 19 ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTimestamp,
 				1,
 				fieldName,
 				buff );
@@ -3677,11 +3882,11 @@ namespace cflib {
 				&& isdigit( value.at(17) )
 				&& isdigit( value.at(18) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTimestamp,
 				1,
 				fieldName,
 				buff );
@@ -3737,24 +3942,22 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalTZDate( const std::string& value ) {
-		static const std::string S_ProcName( "evalTZDate" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDZ or YYYY-MM-DD+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZDate,
 				1,
 				S_VALUE );
 		}
 
 		if( ( value.length() != 11 ) && ( value.length() != 16 ) ) {
 			if( value.length() != 19 ) {
-				std::string buff = * new std::string( S_InvalidFormat );
+				std::string buff = * new std::string( S_InvalidTZDateFormat );
 				buff.append( value );
 				buff.append( S_IS_INVALID );
 				throw CFLibInvalidArgumentException( CLASS_NAME,
-					S_ProcName,
+					S_ProcEvalTZDate,
 					1,
 					S_VALUE,
 					buff );
@@ -3772,11 +3975,11 @@ namespace cflib {
 				&& isdigit( value.at(8) )
 				&& isdigit( value.at(9) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZDate,
 				1,
 				S_VALUE,
 				buff );
@@ -3907,11 +4110,11 @@ namespace cflib {
 			converted = std::chrono::system_clock::from_time_t( timeRead );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZDate,
 				1,
 				S_VALUE,
 				buff );
@@ -3921,24 +4124,22 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalTZDate( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalTZDate" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDZ or YYYY-MM-DD+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZDate,
 				1,
 				S_VALUE );
 		}
 
 		if( ( value.length() != 11 ) && ( value.length() != 16 ) ) {
 			if( value.length() != 19 ) {
-				std::string buff = * new std::string( S_InvalidFormat );
+				std::string buff = * new std::string( S_InvalidTZDateFormat );
 				buff.append( value );
 				buff.append( S_IS_INVALID );
 				throw CFLibInvalidArgumentException( CLASS_NAME,
-					S_ProcName,
+					S_ProcEvalTZDate,
 					1,
 					S_VALUE,
 					buff );
@@ -3947,11 +4148,11 @@ namespace cflib {
 
 		if( ( value.length() != 11 ) && ( value.length() != 16 ) ) {
 			if( value.length() != 19 ) {
-				std::string buff = * new std::string( S_InvalidFormat );
+				std::string buff = * new std::string( S_InvalidTZDateFormat );
 				buff.append( value );
 				buff.append( S_IS_INVALID );
 				throw CFLibInvalidArgumentException( CLASS_NAME,
-					S_ProcName,
+					S_ProcEvalTZDate,
 					1,
 					fieldName,
 					buff );
@@ -3969,11 +4170,11 @@ namespace cflib {
 				&& isdigit( value.at(8) )
 				&& isdigit( value.at(9) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZDate,
 				1,
 				fieldName,
 				buff );
@@ -4104,11 +4305,11 @@ namespace cflib {
 			converted = std::chrono::system_clock::from_time_t( timeRead );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZDateFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZDate,
 				1,
 				fieldName,
 				buff );
@@ -4118,23 +4319,21 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalTZTime( const std::string& value ) {
-		static const std::string S_ProcName( "evalTZTime" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be HH:MI:SSZ or HH:MI:SS+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTime,
 				1,
 				S_VALUE );
 		}
 
 		if( ( value.length() != 9 ) && ( value.length() != 14 ) ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTime,
 				1,
 				S_VALUE,
 				buff );
@@ -4149,11 +4348,11 @@ namespace cflib {
 				&& isdigit( value.at(6) )
 				&& isdigit( value.at(7) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTime,
 				1,
 				S_VALUE,
 				buff );
@@ -4275,11 +4474,11 @@ namespace cflib {
 			converted = std::chrono::system_clock::from_time_t( timeRead );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTime,
 				1,
 				S_VALUE,
 				buff );
@@ -4289,23 +4488,21 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalTZTime( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalTZTime" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be HH:MI:SSZ or HH:MI:SS+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTime,
 				1,
 				S_VALUE );
 		}
 
 		if( ( value.length() != 9 ) && ( value.length() != 14 ) ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTime,
 				1,
 				fieldName,
 				buff );
@@ -4320,11 +4517,11 @@ namespace cflib {
 				&& isdigit( value.at(6) )
 				&& isdigit( value.at(7) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTime,
 				1,
 				fieldName,
 				buff );
@@ -4446,11 +4643,11 @@ namespace cflib {
 			converted = std::chrono::system_clock::from_time_t( timeRead );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimeFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTime,
 				1,
 				fieldName,
 				buff );
@@ -4460,23 +4657,21 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalTZTimestamp( const std::string& value ) {
-		static const std::string S_ProcName( "evalTZTimestamp" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDTHH:MI:SSZ or YYYY-MM-DDTHH:MI:SS+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTimestamp,
 				1,
 				S_VALUE );
 		}
 
 		if( ( value.length() != 20 ) && ( value.length() != 25 ) ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTimestamp,
 				1,
 				S_VALUE,
 				buff );
@@ -4502,11 +4697,11 @@ namespace cflib {
 				&& isdigit( value.at(17) )
 				&& isdigit( value.at(18) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTimestamp,
 				1,
 				S_VALUE,
 				buff );
@@ -4688,11 +4883,11 @@ namespace cflib {
 			converted = std::chrono::system_clock::from_time_t( timeRead );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTimestamp,
 				1,
 				S_VALUE,
 				buff );
@@ -4702,23 +4897,21 @@ namespace cflib {
 	}
 
 	std::chrono::system_clock::time_point CFLibXmlUtil::evalTZTimestamp( const std::string& fieldName, const std::string& value ) {
-		static const std::string S_ProcName( "evalTZTimestamp" );
-		static const std::string S_InvalidFormat( "Invalid value format, must be YYYY-MM-DDTHH:MI:SSZ or YYYY-MM-DDTHH:MI:SS+HO:MO, \"" );
 		static const char S_PERCENT_D[3] = "%d";
 
 		if( value.length() == 0 ) {
 			throw CFLibNullArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTimestamp,
 				1,
 				S_VALUE );
 		}
 
 		if( ( value.length() != 20 ) && ( value.length() != 25 ) ) {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTimestamp,
 				1,
 				fieldName,
 				buff );
@@ -4744,11 +4937,11 @@ namespace cflib {
 				&& isdigit( value.at(17) )
 				&& isdigit( value.at(18) ) ) )
 		{
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTimestamp,
 				1,
 				fieldName,
 				buff );
@@ -4930,11 +5123,11 @@ namespace cflib {
 			converted = std::chrono::system_clock::from_time_t( timeRead );
 		}
 		else {
-			std::string buff = * new std::string( S_InvalidFormat );
+			std::string buff = * new std::string( S_InvalidTZTimestampFormat );
 			buff.append( value );
 			buff.append( S_IS_INVALID );
 			throw CFLibInvalidArgumentException( CLASS_NAME,
-				S_ProcName,
+				S_ProcEvalTZTimestamp,
 				1,
 				fieldName,
 				buff );
@@ -4944,8 +5137,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatBoolean( const bool val ) {
-		static const std::string S_False( "false" );
-		static const std::string S_True( "true" );
 
 		std::string retval;
 		if( val ) {
@@ -5023,30 +5214,20 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatMPFR( const mpfr_t& val ) {
-		static const std::string S_BuffFormat( "%RNf" );
 		char buffValue[CFLibGenericBigDecimal::MAX_DIGITS+CFLibGenericBigDecimal::MAX_DIGITS+4];
-		mpfr_snprintf( buffValue, CFLibGenericBigDecimal::MAX_DIGITS+CFLibGenericBigDecimal::MAX_DIGITS, S_BuffFormat.c_str(), val );
+		mpfr_snprintf( buffValue, CFLibGenericBigDecimal::MAX_DIGITS+CFLibGenericBigDecimal::MAX_DIGITS, S_BuffFormat.data(), val );
 		std::string mpfrValue( buffValue );
 		return( mpfrValue );
 	}
 
 	std::string CFLibXmlUtil::formatMPFR( mpfr_srcptr val ) {
-		static const std::string S_BuffFormat( "%RNf" );
 		char buffValue[CFLibGenericBigDecimal::MAX_DIGITS+CFLibGenericBigDecimal::MAX_DIGITS+4];
-		mpfr_snprintf( buffValue, CFLibGenericBigDecimal::MAX_DIGITS+CFLibGenericBigDecimal::MAX_DIGITS, S_BuffFormat.c_str(), val );
+		mpfr_snprintf( buffValue, CFLibGenericBigDecimal::MAX_DIGITS+CFLibGenericBigDecimal::MAX_DIGITS, S_BuffFormat.data(), val );
 		std::string mpfrValue( buffValue );
 		return( mpfrValue );
 	}
 
 	std::string CFLibXmlUtil::formatXmlString( const std::string& str ) {
-		static const std::string S_ProcName( "formatXmlString" );
-		static const std::string S_Unicode10( "&#10;" );
-		static const std::string S_Unicode13( "&#13;" );
-		static const std::string S_APos( "&apos;" );
-		static const std::string S_Quot( "&quot;" );
-		static const std::string S_Amp( "&" );
-		static const std::string S_Lt( "&lt;" );
-		static const std::string S_Gt( "&gt;" );
 
 		std::string buff;
 		char ch;
@@ -5157,19 +5338,19 @@ namespace cflib {
 					buff.append( &cstr[0] );
 					break;
 				case '\'':
-					buff.append( S_APos );
+					buff.append( S_EscAPos );
 					break;
 				case '"':
-					buff.append( S_Quot );
+					buff.append( S_EscQuot );
 					break;
 				case '&':
 					buff.append( S_Amp );
 					break;
 				case '<':
-					buff.append( S_Lt );
+					buff.append( S_EscLt );
 					break;
 				case '>':
-					buff.append( S_Gt );
+					buff.append( S_EscGt );
 					break;
 				default:
 					int charCode = (int)ch;
@@ -5190,12 +5371,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatXmlStringWhitespacePreserve( const std::string& str ) {
-		static const std::string S_ProcName( "formatXmlStringWhitespacePreserve" );
-		static const std::string S_APos( "&apos;" );
-		static const std::string S_Quot( "&quot;" );
-		static const std::string S_Amp( "&" );
-		static const std::string S_Lt( "&lt;" );
-		static const std::string S_Gt( "&gt;" );
 
 		std::string buff;
 		char ch;
@@ -5303,19 +5478,19 @@ namespace cflib {
 					buff.append( &cstr[0] );
 					break;
 				case '\'':
-					buff.append( S_APos );
+					buff.append( S_EscAPos );
 					break;
 				case '"':
-					buff.append( S_Quot );
+					buff.append( S_EscQuot );
 					break;
 				case '&':
 					buff.append( S_Amp );
 					break;
 				case '<':
-					buff.append( S_Lt );
+					buff.append( S_EscLt );
 					break;
 				case '>':
-					buff.append( S_Gt );
+					buff.append( S_EscGt );
 					break;
 				default:
 					int charCode = (int)ch;
@@ -5396,13 +5571,15 @@ namespace cflib {
 		return( retval );
 	}
 
+	std::string CFLibXmlUtil::formatUuid( const CFLibUuid& val ) {
+		return( val.toString() );
+	}
+
 	/**
 	 *	Formatting for Required XML attributes.
 	**/
 
 	std::string CFLibXmlUtil::formatRequiredBoolean( const std::string* separator, const std::string& attrName, const bool val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5416,8 +5593,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredBlob( const std::string* separator, const std::string& attrName, const std::vector<BYTE>& val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5431,8 +5606,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredInt16( const std::string* separator, const std::string& attrName, const std::int16_t val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5446,8 +5619,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredInt32( const std::string* separator, const std::string& attrName, const std::int32_t val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5461,8 +5632,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredInt64( const std::string* separator, const std::string& attrName, const std::int64_t val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5476,8 +5645,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredUInt16( const std::string* separator, const std::string& attrName, const std::uint16_t val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5491,8 +5658,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredUInt32( const std::string* separator, const std::string& attrName, const std::uint32_t val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5506,8 +5671,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredUInt64( const std::string* separator, const std::string& attrName, const std::uint64_t val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5521,8 +5684,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredFloat( const std::string* separator, const std::string& attrName, const float val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5536,8 +5697,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredDouble( const std::string* separator, const std::string& attrName, const double val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5551,8 +5710,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredNumber(const std::string* separator, const std::string& attrName, const CFLibGenericBigDecimal& val) {
-		static const std::string S_EqualQuote("=\"");
-		static const std::string S_Quote("\"");
 		std::string retval;
 		if (separator != NULL) {
 			retval.append(*separator);
@@ -5566,8 +5723,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredXmlString( const std::string* separator, const std::string& attrName, const std::string& str ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5581,8 +5736,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredDate( const std::string* separator, const std::string& attrName, const std::chrono::system_clock::time_point& cal ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5596,8 +5749,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredTime( const std::string* separator, const std::string& attrName, const std::chrono::system_clock::time_point& cal ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5611,8 +5762,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredTimestamp( const std::string* separator, const std::string& attrName, const std::chrono::system_clock::time_point& cal ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5626,8 +5775,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredTZDate( const std::string* separator, const std::string& attrName, const std::chrono::system_clock::time_point& cal ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5641,8 +5788,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredTZTime( const std::string* separator, const std::string& attrName, const std::chrono::system_clock::time_point& cal ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5656,8 +5801,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredTZTimestamp( const std::string* separator, const std::string& attrName, const std::chrono::system_clock::time_point& cal ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5671,8 +5814,6 @@ namespace cflib {
 	}
 
 	std::string CFLibXmlUtil::formatRequiredUuid( const std::string* separator, const std::string& attrName, const uuid_ptr_t val ) {
-		static const std::string S_EqualQuote( "=\"" );
-		static const std::string S_Quote( "\"" );
 		std::string retval;
 		if( separator != NULL ) {
 			retval.append( *separator );
@@ -5685,6 +5826,20 @@ namespace cflib {
 		return( retval );
 	}
 
+	std::string CFLibXmlUtil::formatRequiredUuid( const std::string* separator, const std::string& attrName, const CFLibUuid& val ) {
+		char formattedVal[CFLibUuid::FORMATTED_LENGTH];
+		val.format( formattedVal );
+		std::string retval;
+		if( separator != NULL ) {
+			retval.append( *separator );
+		}
+		retval.append( attrName );
+		retval.append( S_EqualQuote );
+		retval.append( formattedVal, sizeof( formattedVal ) );
+		retval.append( S_Quote );
+		return( retval );
+	}
+
 	/**
 	 *	Formatting for Optional XML attributes.
 	**/
@@ -31,10 +31,58 @@
 
 namespace cflib {
 
+	const int ICFLibMessageLog::LEVEL_TRACE = 0;
+	const int ICFLibMessageLog::LEVEL_DEBUG = 1;
+	const int ICFLibMessageLog::LEVEL_INFO = 2;
+	const int ICFLibMessageLog::LEVEL_WARN = 3;
+	const int ICFLibMessageLog::LEVEL_ERROR = 4;
+	const int ICFLibMessageLog::LEVEL_FATAL = 5;
+
+	const uint32_t ICFLibMessageLog::CATEGORY_GENERAL = 0x00000001;
+	const uint32_t ICFLibMessageLog::CATEGORY_XML = 0x00000002;
+	const uint32_t ICFLibMessageLog::CATEGORY_EXCEPTION = 0x00000004;
+	const uint32_t ICFLibMessageLog::CATEGORY_DB = 0x00000008;
+	const uint32_t ICFLibMessageLog::CATEGORY_ALL = 0xffffffff;
+
 	ICFLibMessageLog::ICFLibMessageLog() {
+		minimumLevel.store( LEVEL_INFO );
+		enabledCategories.store( CATEGORY_ALL );
+	}
+
+	ICFLibMessageLog::ICFLibMessageLog( const ICFLibMessageLog& src ) {
+		minimumLevel.store( src.getMinimumLevel() );
+		enabledCategories.store( src.getEnabledCategories() );
 	}
 
 	ICFLibMessageLog::~ICFLibMessageLog() {
 	}
-	
+
+	ICFLibMessageLog& ICFLibMessageLog::operator=( const ICFLibMessageLog& src ) {
+		minimumLevel.store( src.getMinimumLevel() );
+		enabledCategories.store( src.getEnabledCategories() );
+		return( *this );
+	}
+
+	int ICFLibMessageLog::getMinimumLevel() const {
+		return( minimumLevel.load( std::memory_order_relaxed ) );
+	}
+
+	void ICFLibMessageLog::setMinimumLevel( int level ) {
+		minimumLevel.store( level, std::memory_order_relaxed );
+	}
+
+	uint32_t ICFLibMessageLog::getEnabledCategories() const {
+		return( enabledCategories.load( std::memory_order_relaxed ) );
+	}
+
+	void ICFLibMessageLog::setEnabledCategories( uint32_t categories ) {
+		enabledCategories.store( categories, std::memory_order_relaxed );
+	}
+
+	void ICFLibMessageLog::message( int level, uint32_t category, const std::string& msg ) {
+		if( isEnabled( level, category ) ) {
+			message( msg );
+		}
+	}
+
 }
@@ -24,52 +24,5 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cflib/CFLib.hpp>
-#include <cflib/CFLibNullableFloat.hpp>
-#include <cflib/CFLibNullArgumentException.hpp>
+#include <cflib/ICFLibXmlCoreSaxParserFactory.hpp>
 
-namespace cflib {
-
-const std::string CFLibNullableFloat::CLASS_NAME( "CFLibNullableFloat" );;
-
-CFLibNullableFloat::CFLibNullableFloat() {
-	value = 0;
-}
-
-CFLibNullableFloat::CFLibNullableFloat( const float arg ) {
-	setNullFlag( false );
-	value = arg;
-}
-
-CFLibNullableFloat::~CFLibNullableFloat() {
-}
-
-const float CFLibNullableFloat::getValue() const {
-	if( nullFlag ) {
-		throw CFLibNullArgumentException( CLASS_NAME,
-			S_GET_VALUE,
-			0,
-			S_VALUE );
-	}
-	return( value );
-}
-
-const float* CFLibNullableFloat::getReference() const {
-	if( nullFlag ) {
-		return( NULL );
-	}
-	else {
-		return( &value );
-	}
-}
-
-void CFLibNullableFloat::setValue( const float arg ) {
-	setNullFlag( false );
-	value = arg;
-}
-
-void CFLibNullableFloat::setNull() {
-	setNullFlag( true );
-}
-
-}
@@ -98,6 +98,17 @@ namespace cflib {
 		static const std::string LinkVersion;
 		static const std::string S_MsgInitMustBeCalledFirst;
 
+		/**
+		 *	Clock sources for getUTCTimestampInstance().  CLOCK_PRECISE reads
+		 *	std::chrono::system_clock.  CLOCK_COARSE reads the time of the
+		 *	kernel's last tick (CLOCK_REALTIME_COARSE), which costs a few
+		 *	nanoseconds but only advances every getUTCTimestampResolution(),
+		 *	typically 1 to 4 ms; good enough for audit columns stamped per row.
+		 *	Where there is no coarse clock, CLOCK_COARSE reads the precise one.
+		 */
+		static const int CLOCK_PRECISE;
+		static const int CLOCK_COARSE;
+
 	protected:
 
 		static bool initialized;
@@ -123,9 +134,40 @@ namespace cflib {
 		 * is enclosed in quotes, remove them. */
 		static char* getValue( const char* filename, const char* tag, char* value, std::string::size_type valueSize );
 
+		/**
+		 *	Look up tag within filename as getValue() above does, returning
+		 *	false when the file or the tag is missing.  Files are parsed once
+		 *	and cached; a cached file is checked with stat() at most once a
+		 *	second and parsed again when it has been replaced or modified,
+		 *	so an edit can take up to a second to be seen.
+		 */
+		static bool getValue( const std::string& filename, const std::string& tag, std::string& value );
+
 		static std::chrono::system_clock::time_point* getUTCTimestamp();
 		static std::chrono::system_clock::time_point getUTCTimestampInstance();
-
+		static std::chrono::system_clock::time_point getUTCTimestampInstance( int clockSource );
+		static std::chrono::nanoseconds getUTCTimestampResolution( int clockSource );
+
+		/**
+		 *	The number of days from 1970-01-01 to a date in the proleptic
+		 *	Gregorian calendar, by arithmetic alone so the result does not
+		 *	depend on the time zone.  Days outside the month carry into
+		 *	the neighbouring months.
+		 *
+		 *	@param	year	The year, e.g. 2021.
+		 *	@param	month	The month, 1 to 12.
+		 *	@param	day	The day of the month, normally 1 to 31.
+		 */
+		static int64_t daysFromCivil( int64_t year, int month, int64_t day );
+
+		/**
+		 *	getUTCGregorianCalendar() and getUTCGregorianCalendarInstance()
+		 *	convert a UTC date and time with daysFromCivil().  Months outside
+		 *	1 to 12 carry into the year, and the other fields carry into the
+		 *	next larger one, as with mktime().  The result must fit in a
+		 *	system_clock::time_point; with the nanosecond clock of libstdc++
+		 *	that is roughly the years 1678 through 2261.
+		 */
 		static std::chrono::system_clock::time_point* getUTCGregorianCalendar(
 			int year,
 			int month,
@@ -147,6 +189,24 @@ namespace cflib {
 	
 		const std::string* getLinkVersion();
 
+		/**
+		 *	Hash every byte of a buffer with a 64-bit wyhash.
+		 *
+		 *	@param	value	The bytes to hash.
+		 *	@param	len	The number of bytes to hash.
+		 *	@param	seed	Varies the hash, e.g. to defend a table against chosen keys.
+		 *	@returns	A 64-bit hash of the buffer.
+		 */
+		static uint64_t hashBytes( const void* value, size_t len, uint64_t seed = 0 );
+
+		/**
+		 *	The hash() overloads for UUIDs, strings and blobs hash the whole
+		 *	value, so they are suitable for unordered containers.  Strings and
+		 *	blobs are hashed with hashBytes(); a UUID's 16 bytes are folded
+		 *	with the same wyhash multiply in a single round, so its hash is
+		 *	not hashBytes() of the UUID.  A time point hashes to its tick
+		 *	count.  A NULL pointer hashes to 0.
+		 */
 		static size_t hash( const uuid_ptr_t value );
 
 		static size_t hash( const std::string* value );
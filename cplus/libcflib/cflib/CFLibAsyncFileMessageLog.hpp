@@ -0,0 +1,170 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <cflib/ICFLibMessageLog.hpp>
+
+namespace cflib {
+
+	/**
+	 *	A message log that writes to a file from a background thread.
+	 *	<p>
+	 *	message() formats the line on the calling thread and enqueues it in a
+	 *	bounded lock-free multi-producer ring.  The writer thread takes the
+	 *	queued lines in batches and writes each batch with a single writev(),
+	 *	so logging threads never wait on disk I/O.
+	 *	<p>
+	 *	When the ring is full the overflow policy decides what message() does:
+	 *	OVERFLOW_BLOCK waits for space, OVERFLOW_DROP discards the message, and
+	 *	OVERFLOW_COUNT discards it but writes a line reporting how many messages
+	 *	were lost once there is room again.  getDroppedCount() is maintained for
+	 *	both dropping policies.
+	 *	<p>
+	 *	closeLogFile() and the destructor write everything queued before
+	 *	returning, including messages from threads that were still in
+	 *	message() when the close began.  Messages logged while no file is
+	 *	open go to std::cout, as with CFLibConsoleMessageLog.  message() and
+	 *	flush() may be called from any thread, but openLogFile() and
+	 *	closeLogFile() must not race each other.
+	 */
+	class CFLibAsyncFileMessageLog : public virtual ICFLibMessageLog {
+
+	public:
+		static const std::string CLASS_NAME;
+
+		static const int OVERFLOW_BLOCK;
+		static const int OVERFLOW_DROP;
+		static const int OVERFLOW_COUNT;
+
+		static const uint32_t DEFAULT_CAPACITY;
+
+	protected:
+		class Slot {
+		public:
+			std::atomic<uint64_t> sequence;
+			std::string text;
+		};
+
+		Slot* slots;
+		uint64_t slotMask;
+		int overflowPolicy;
+		std::atomic<uint64_t> enqueuePos;
+		uint64_t dequeuePos;
+		std::atomic<uint64_t> writtenCount;
+		std::atomic<uint64_t> droppedCount;
+		std::atomic<uint64_t> unreportedDropCount;
+		std::atomic<int> ndnt;
+
+		std::string logFileName;
+		int logFd;
+		std::thread* writerThread;
+		std::atomic<bool> running;
+		std::atomic<int> activeProducers;
+		std::atomic<bool> stopping;
+		std::atomic<bool> writerSleeping;
+		std::mutex writerLock;
+		std::condition_variable writerWakeup;
+		std::atomic<int> flushWaiters;
+		std::mutex flushLock;
+		std::condition_variable flushDone;
+
+	public:
+
+		/**
+		 *	Construct a log with no file open.
+		 *
+		 *	@param	capacity	The number of queued messages, rounded up to a power of two.
+		 *	@param	policy	OVERFLOW_BLOCK, OVERFLOW_DROP or OVERFLOW_COUNT.
+		 */
+		CFLibAsyncFileMessageLog( uint32_t capacity = DEFAULT_CAPACITY, int policy = OVERFLOW_BLOCK );
+
+		/**
+		 *	Destructor.  Closes the log file, writing any queued messages.
+		 */
+		virtual ~CFLibAsyncFileMessageLog();
+
+		virtual int getMessageLogIndent() const;
+
+		/**
+		 *	Decrease the indent of the logged messages another level.
+		 */
+		virtual void dedent();
+
+		/**
+		 *	Indent the logging messages another level.
+		 */
+		virtual void indent();
+
+		/**
+		 *	Timestamp, indent and queue a message.
+		 */
+		virtual void message( const std::string& msg );
+
+		using ICFLibMessageLog::message;
+
+		/**
+		 *	Open the file for appending and start the writer thread.
+		 *	Any file already open is closed first.
+		 *
+		 *	@param	fileName	The name of the file to open as a log.
+		 */
+		virtual void openLogFile( const std::string& fileName );
+
+		/**
+		 *	Write the queued messages, stop the writer thread and close the file.
+		 */
+		virtual void closeLogFile();
+
+		/**
+		 *	Wait until every message queued before the call has been written.
+		 */
+		void flush();
+
+		int getOverflowPolicy() const;
+
+		/**
+		 *	The number of messages discarded because the queue was full.
+		 */
+		uint64_t getDroppedCount() const;
+
+	protected:
+		bool enqueue( std::string& line );
+		void runWriter();
+		size_t writeBatch();
+		void notifyFlushed();
+		void writeFully( const char* bytes, size_t length );
+	};
+}
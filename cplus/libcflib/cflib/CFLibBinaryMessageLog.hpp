@@ -0,0 +1,285 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cflib/ICFLibMessageLog.hpp>
+
+namespace cflib {
+
+	/**
+	 *	A message log that writes compact binary records instead of text.
+	 *	<p>
+	 *	Hot paths register a format once, such as
+	 *	<code>static const uint32_t fmtId = CFLibBinaryMessageLog::registerFormat( "Parsed {} records from {}" );</code>,
+	 *	and then call logf( level, category, fmtId, count, fileId ).  Only the
+	 *	format id and the raw argument bytes are written; the format text and
+	 *	each interned string are written to a file once, the first time it is
+	 *	used there, so the file is self-describing.
+	 *	<p>
+	 *	Arguments may be any integer or floating point type, strings, interned string ids from
+	 *	internString(), and std::chrono::system_clock time points.  Each "{}"
+	 *	in the format is replaced by the next argument when the log is decoded.
+	 *	Plain message() calls are stored as text records.
+	 *	<p>
+	 *	decodeFile() renders a log in the same form CFLibConsoleMessageLog
+	 *	writes, with each record's level and category after the timestamp.
+	 *	Values are stored in host byte order, so logs must be decoded on a
+	 *	machine of the same endianness.
+	 *	<p>
+	 *	Until a log file is opened, messages are rendered as text and written
+	 *	to std::cout, as CFLibConsoleMessageLog does.
+	 *	<p>
+	 *	Each thread appends to its own buffer, so logging threads never wait
+	 *	on each other.  A buffer is written to the file when it fills and by
+	 *	flush() and closeLogFile(), so the file holds each thread's records
+	 *	in order, in batches; sort the decoded lines by timestamp to merge
+	 *	threads exactly.
+	 */
+	class CFLibBinaryMessageLog : public virtual ICFLibMessageLog {
+
+	public:
+		static const std::string CLASS_NAME;
+		static const char FILE_MAGIC[8];
+
+		/**
+		 *	An interned string argument.
+		 */
+		class Interned {
+		public:
+			uint32_t id;
+			explicit Interned( uint32_t internedId ) : id( internedId ) {}
+		};
+
+	protected:
+		static const uint8_t RECORD_FORMAT;
+		static const uint8_t RECORD_STRING;
+		static const uint8_t RECORD_MESSAGE;
+		static const uint8_t RECORD_TEXT;
+
+		static const uint8_t ARG_INT64;
+		static const uint8_t ARG_UINT64;
+		static const uint8_t ARG_DOUBLE;
+		static const uint8_t ARG_STRING;
+		static const uint8_t ARG_INTERNED;
+		static const uint8_t ARG_TIMESTAMP;
+
+		static const size_t FLUSH_THRESHOLD;
+
+		/**
+		 *	The records one thread has logged and not yet written.  Only the
+		 *	owning thread appends, so its lock is uncontended except while the
+		 *	buffer is being written out.  Each buffer defines the formats and
+		 *	strings it uses, so every batch written is self-describing.
+		 */
+		class ThreadBuffer {
+		public:
+			std::mutex lock;
+			std::string pending;
+			std::vector<bool> formatsWritten;
+			std::vector<bool> stringsWritten;
+		};
+
+		static std::atomic<uint64_t> nextLogId;
+
+		uint64_t logId;
+		// Lock order is buffersLock, then ThreadBuffer::lock, then fileLock
+		std::mutex buffersLock;
+		std::vector< std::shared_ptr<ThreadBuffer> > buffers;
+		std::mutex fileLock;
+		std::atomic<int> logFd;
+		std::atomic<int> ndnt;
+
+	public:
+		CFLibBinaryMessageLog();
+
+		CFLibBinaryMessageLog( const CFLibBinaryMessageLog& src ) = delete;
+		CFLibBinaryMessageLog& operator =( const CFLibBinaryMessageLog& src ) = delete;
+
+		/**
+		 *	Destructor.  Closes the log file, writing any buffered records.
+		 */
+		virtual ~CFLibBinaryMessageLog();
+
+		/**
+		 *	Register a format string, returning its id.  Registering the same
+		 *	text again returns the same id.  Thread safe.
+		 */
+		static uint32_t registerFormat( const std::string& format );
+
+		/**
+		 *	Intern a string argument, returning its id.  Thread safe.
+		 */
+		static uint32_t internString( const std::string& str );
+
+		/**
+		 *	Render a binary log file as text.
+		 *
+		 *	@param	fileName	The binary log to read.
+		 *	@param	out	Where to write the rendered lines.
+		 */
+		static void decodeFile( const std::string& fileName, std::ostream& out );
+
+	protected:
+		static void decodeRecords( std::istream& input, std::ostream& out );
+
+	public:
+
+		virtual int getMessageLogIndent() const;
+
+		/**
+		 *	Decrease the indent of the logged messages another level.
+		 */
+		virtual void dedent();
+
+		/**
+		 *	Indent the logging messages another level.
+		 */
+		virtual void indent();
+
+		/**
+		 *	Log a text message.
+		 */
+		virtual void message( const std::string& msg );
+
+		/**
+		 *	Log a text message with a level and category.
+		 */
+		virtual void message( int level, uint32_t category, const std::string& msg );
+
+		/**
+		 *	Log a registered format and its arguments, if the level and
+		 *	category are enabled.
+		 */
+		template<typename... Args>
+		void logf( int level, uint32_t category, uint32_t formatId, const Args&... args ) {
+			if( ! isEnabled( level, category ) ) {
+				return;
+			}
+			ThreadBuffer& buffer = getThreadBuffer();
+			std::lock_guard<std::mutex> guard( buffer.lock );
+			defineFormat( buffer, formatId );
+			( defineArg( buffer, args ), ... );
+			beginRecord( buffer, RECORD_MESSAGE, level, category );
+			appendRaw( buffer, formatId );
+			appendRaw( buffer, (uint8_t)sizeof...( args ) );
+			( appendArg( buffer, args ), ... );
+			endRecord( buffer );
+		}
+
+		/**
+		 *	Open the specified file for logging, truncating it.
+		 *	Any file already open is closed first.
+		 */
+		virtual void openLogFile( const std::string& fileName );
+
+		/**
+		 *	Write the buffered records and close the log file.
+		 */
+		virtual void closeLogFile();
+
+		/**
+		 *	Write the buffered records.
+		 */
+		void flush();
+
+	protected:
+		/**
+		 *	The calling thread's buffer for this log, created on first use.
+		 */
+		ThreadBuffer& getThreadBuffer();
+
+		template<typename T>
+		inline void appendRaw( ThreadBuffer& buffer, T value ) {
+			buffer.pending.append( (const char*)&value, sizeof( T ) );
+		}
+
+		void appendBytes( ThreadBuffer& buffer, const std::string& str );
+		void beginRecord( ThreadBuffer& buffer, uint8_t recordType, int level, uint32_t category );
+		void defineFormat( ThreadBuffer& buffer, uint32_t formatId );
+		void defineString( ThreadBuffer& buffer, uint32_t stringId );
+		void endRecord( ThreadBuffer& buffer );
+
+		/**
+		 *	Write a buffer's records to the log file.  Called with the
+		 *	buffer's lock held.
+		 */
+		void writeBuffer( ThreadBuffer& buffer );
+
+		/**
+		 *	Write every buffer to the current file, then switch to newFd,
+		 *	or to std::cout when newFd is negative.
+		 */
+		void switchLogFile( int newFd );
+
+		template<typename T>
+		inline void defineArg( ThreadBuffer& buffer, const T& arg ) {
+		}
+
+		inline void defineArg( ThreadBuffer& buffer, const Interned& arg ) {
+			defineString( buffer, arg.id );
+		}
+
+		template<typename T>
+		inline typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type appendArg( ThreadBuffer& buffer, T arg ) {
+			appendRaw( buffer, ARG_INT64 );
+			appendRaw( buffer, (int64_t)arg );
+		}
+
+		template<typename T>
+		inline typename std::enable_if<std::is_integral<T>::value && ! std::is_signed<T>::value>::type appendArg( ThreadBuffer& buffer, T arg ) {
+			appendRaw( buffer, ARG_UINT64 );
+			appendRaw( buffer, (uint64_t)arg );
+		}
+
+		template<typename T>
+		inline typename std::enable_if<std::is_floating_point<T>::value>::type appendArg( ThreadBuffer& buffer, T arg ) {
+			appendRaw( buffer, ARG_DOUBLE );
+			appendRaw( buffer, (double)arg );
+		}
+
+		inline void appendArg( ThreadBuffer& buffer, const Interned& arg ) { appendRaw( buffer, ARG_INTERNED ); appendRaw( buffer, arg.id ); }
+		inline void appendArg( ThreadBuffer& buffer, const std::string& arg ) { appendRaw( buffer, ARG_STRING ); appendBytes( buffer, arg ); }
+		inline void appendArg( ThreadBuffer& buffer, const char* arg ) { appendArg( buffer, std::string( ( arg != NULL ) ? arg : "" ) ); }
+		inline void appendArg( ThreadBuffer& buffer, const std::chrono::system_clock::time_point& arg ) {
+			appendRaw( buffer, ARG_TIMESTAMP );
+			appendRaw( buffer, (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>( arg.time_since_epoch() ).count() );
+		}
+	};
+}
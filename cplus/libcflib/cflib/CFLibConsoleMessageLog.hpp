@@ -83,6 +83,8 @@ namespace cflib {
 		 */
 		virtual void message( const std::string& msg );
 
+		using ICFLibMessageLog::message;
+
 		/**
 		 *	Open the specified file for logging.
 		 *	<p>
@@ -51,8 +51,17 @@ namespace cflib {
 
 		static void setDbServerTZOffsetSeconds( time_t value );
 
+		/**
+		 *	The DB server keeps local times dbServerTZOffsetSeconds east of
+		 *	UTC.  The conversions are plain offset arithmetic, so they do not
+		 *	depend on the process time zone, are exact inverses of each
+		 *	other, and keep sub-second precision.  The Instance versions
+		 *	return by value and allocate nothing.
+		 */
 		static std::chrono::system_clock::time_point* getDbServerTimeFromUTCTime( const std::chrono::system_clock::time_point* value );
+		static std::chrono::system_clock::time_point getDbServerTimeFromUTCTimeInstance( const std::chrono::system_clock::time_point& value );
 
 		static std::chrono::system_clock::time_point* getUTCTimeFromDBServerTime( const std::chrono::system_clock::time_point* value );
+		static std::chrono::system_clock::time_point getUTCTimeFromDBServerTimeInstance( const std::chrono::system_clock::time_point& value );
 	};
 }
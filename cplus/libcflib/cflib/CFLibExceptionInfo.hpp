@@ -29,11 +29,14 @@
 #include <uuid/uuid.h>
 
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <chrono>
 #include <ctime>
 #include <list>
+#include <mutex>
 #include <string>
 
 namespace cflib {
@@ -53,6 +56,17 @@ namespace cflib {
 
 	typedef int32_t cflibexcflags_t;
 
+	/**
+	 *	The raw argument value of a range exception, held until the text
+	 *	is actually asked for.  Timestamps are held as the tick count of
+	 *	their std::chrono::system_clock duration since the epoch.
+	 */
+	typedef union {
+		int64_t int64Value;
+		uint64_t uint64Value;
+		double doubleValue;
+	} cflibexcargvalue_t;
+
 	class CFLibExceptionInfo {
 
 	public:
@@ -91,18 +105,98 @@ namespace cflib {
 		static const std::string S_bad_variant_access;
 		static const std::string S_std_exception;
 
+		static const int ARG_VALUE_TEXT;
+		static const int ARG_VALUE_INT64;
+		static const int ARG_VALUE_UINT64;
+		static const int ARG_VALUE_DOUBLE;
+		static const int ARG_VALUE_TIMESTAMP;
+
+		static const int ARG_BOUND_MIN;
+		static const int ARG_BOUND_MAX;
+
 	protected:
 		cflibexcflags_t excFlags;
+
 		std::string excCause;
 		std::string excExceptionName;
 		std::string excClassFieldName;
 		std::string excMethodName;
 		size_t excArgOffset;
 		std::string excArgName;
-		std::string excArgValueString;
-		std::string excArgMinValueString;
-		std::string excArgMaxValueString;
-		std::string excMessageText;
+
+		/**
+		 *	When excArgValueKind is not ARG_VALUE_TEXT, the argument, minimum
+		 *	and maximum values are still held raw in excArgRawValues and the
+		 *	value strings are formatted by formatPendingArgValues() the first
+		 *	time any of them is asked for.  Likewise while excArgBoundText is
+		 *	not NULL the message text has yet to be composed from it.
+		 *	<p>
+		 *	excTextPending is set while anything is left to format.  The
+		 *	formatting, and copying of the pending state, happen under
+		 *	excTextLock, so the const accessors may be called from several
+		 *	threads at once, as when one rethrown exception is examined by each.
+		 */
+		mutable std::mutex excTextLock;
+		mutable std::atomic<bool> excTextPending;
+		mutable int excArgValueKind;
+		int excArgBounds;
+		cflibexcargvalue_t excArgRawValues[3];
+		mutable const std::string* excArgBoundText;
+		mutable std::string excArgValueString;
+		mutable std::string excArgMinValueString;
+		mutable std::string excArgMaxValueString;
+		mutable std::string excMessageText;
+
+		/**
+		 *	The UTF-16 message of a captured Xerces exception, which is only
+		 *	transcoded into excMessageText when the message is asked for.
+		 */
+		mutable bool excXercesMessagePending;
+		mutable std::u16string excXercesMessage;
+
+		/**
+		 *	Format any pending raw argument values and bound message text.
+		 */
+		void formatPendingArgValues() const;
+		void formatPendingArgValuesLocked() const;
+
+		/**
+		 *	Record the raw argument value and the minimum and/or maximum
+		 *	bound it violated, as selected by argBounds (ARG_BOUND_MIN,
+		 *	ARG_BOUND_MAX or both).  Nothing is formatted until the value
+		 *	strings or message text are requested; the message is then
+		 *	"<argName> value <argValue><boundText><min>..<max>".
+		 *	<p>
+		 *	The boundText is borrowed, so it must have static storage duration.
+		 */
+		void setArgBoundValues( const std::string& boundText, int argBounds, int64_t argValue, int64_t minValue, int64_t maxValue );
+		void setArgBoundValues( const std::string& boundText, int argBounds, uint64_t argValue, uint64_t minValue, uint64_t maxValue );
+		void setArgBoundValues( const std::string& boundText, int argBounds, double argValue, double minValue, double maxValue );
+		void setArgBoundValues( const std::string& boundText, int argBounds,
+			const std::chrono::system_clock::time_point& argValue,
+			const std::chrono::system_clock::time_point& minValue,
+			const std::chrono::system_clock::time_point& maxValue );
+		void setArgBoundValues( const std::string& boundText, int argBounds,
+			const std::string& argValue,
+			const std::string& minValue,
+			const std::string& maxValue );
+
+		/**
+		 *	Record a caught Xerces or std exception.
+		 */
+		void captureXercesException( const std::string& exceptionName,
+			const std::string& className,
+			const std::string& methodName,
+			const char16_t* message );
+		void captureSystemException( const std::string& exceptionName,
+			const std::string& className,
+			const std::string& methodName,
+			const char* message );
+
+		/**
+		 *	Copy src while the caller holds src.excTextLock.
+		 */
+		CFLibExceptionInfo( const CFLibExceptionInfo& src, const std::lock_guard<std::mutex>& srcLocked );
 
 	public:
 		virtual ~CFLibExceptionInfo();
@@ -202,6 +296,21 @@ namespace cflib {
 		// Reset the exception info to its new/empty state
 		virtual void reset();
 
+		/**
+		 *	Translate the exception currently being handled into this
+		 *	exception info, replacing whatever it held.  CFLib exceptions are
+		 *	copied as they are; Xerces SAX and std exceptions are recorded by
+		 *	name with className and methodName as the catching location.
+		 *	Everything is caught by reference through std::current_exception(),
+		 *	so one catch( ... ) handler can replace a catch clause per type.
+		 *
+		 *	@param	className	The class catching the exception.
+		 *	@param	methodName	The method catching the exception.
+		 *	@returns	false, leaving the info unchanged, if there is no current
+		 *		exception or it is not a CFLib, Xerces SAX or std exception.
+		 */
+		bool captureCurrentException( const std::string& className, const std::string& methodName );
+
 		virtual const std::string& getCause() const;
 		virtual void setCause( const std::string& value );
 
@@ -237,13 +346,13 @@ namespace cflib {
 			const std::string& argExceptionName,
 			const std::string& argClassFieldName,
 			const std::string& argMethodName,
-			const std::string& argMessageText );
+			const std::string& argMessageText ) const;
 	
 		virtual std::string getFormattedXercesText( 
 			const std::string& argExceptionName,
 			const std::string& argClassFieldName,
 			const std::string& argMethodName,
-			const std::string& argMessageText );
+			const std::string& argMessageText ) const;
 
 		virtual std::string getFormattedText( 
 			const std::string& argCause,
@@ -255,7 +364,7 @@ namespace cflib {
 			const std::string& argArgValueString,
 			const std::string& argArgMinValueString,
 			const std::string& argArgMaxValueString,
-			const std::string& argMessageText );
+			const std::string& argMessageText ) const;
 
 		virtual std::string getEffectiveMessage();
 		virtual std::string getEffectiveMessageFirstLine();
@@ -50,889 +50,24 @@
 #define CFLIB_EXCEPTION_EMPTY \
 	exceptionInfo.empty()
 
+/*
+ *	The catch macros expand to a single catch( ... ) handler that hands the
+ *	current exception to CFLibExceptionInfo::captureCurrentException(), which
+ *	dispatches on its type by reference.  Exceptions it does not recognize
+ *	are rethrown unchanged.
+ */
 #define CFLIB_EXCEPTION_CATCH_FALLTHROUGH \
-	catch( xercesc::SAXNotRecognizedException e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsXercesException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtXercesException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_SAXNotRecognizedException ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		const XMLCh* message = e.getMessage(); \
-		if( message != NULL ) { \
-			char* cUseMessage = xercesc::XMLString::transcode( message ); \
-			if( cUseMessage != NULL ) { \
-				std::string cppMessage( cUseMessage ); \
-				exceptionInfo.setMessageText( cppMessage ); \
-				xercesc::XMLString::release( &cUseMessage ); \
-				cUseMessage = NULL; \
-			} \
-		} \
-	} \
-	catch( xercesc::SAXNotSupportedException e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsXercesException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtXercesException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_SAXNotSupportedException ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		const XMLCh* message = e.getMessage(); \
-		if( message != NULL ) { \
-			char* cUseMessage = xercesc::XMLString::transcode( message ); \
-			if( cUseMessage != NULL ) { \
-				std::string cppMessage( cUseMessage ); \
-				exceptionInfo.setMessageText( cppMessage ); \
-				xercesc::XMLString::release( &cUseMessage ); \
-				cUseMessage = NULL; \
-			} \
-		} \
-	} \
-	catch( xercesc::SAXParseException e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsXercesException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtXercesException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_SAXParseException ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		const XMLCh* message = e.getMessage(); \
-		if( message != NULL ) { \
-			char* cUseMessage = xercesc::XMLString::transcode( message ); \
-			if( cUseMessage != NULL ) { \
-				std::string cppMessage( cUseMessage ); \
-				exceptionInfo.setMessageText( cppMessage ); \
-				xercesc::XMLString::release( &cUseMessage ); \
-				cUseMessage = NULL; \
-			} \
-		} \
-	} \
-	catch( xercesc::SAXException e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsXercesException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtXercesException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_SAXException ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		const XMLCh* message = e.getMessage(); \
-		if( message != NULL ) { \
-			char* cUseMessage = xercesc::XMLString::transcode( message ); \
-			if( cUseMessage != NULL ) { \
-				std::string cppMessage( cUseMessage ); \
-				exceptionInfo.setMessageText( cppMessage ); \
-				xercesc::XMLString::release( &cUseMessage ); \
-				cUseMessage = NULL; \
-			} \
-		} \
-	} \
-	catch( cflib::CFLibArgumentOverflowException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibArgumentRangeException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibArgumentUnderflowException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibEmptyArgumentException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibInvalidArgumentException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibNullArgumentException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibArgumentException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibMustOverrideException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibNotImplementedYetException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibNotSupportedException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibUsageException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibCodeStateException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibDependentsDetectedException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibPrimaryKeyNotNewException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibUniqueIndexViolationException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibUnrecognizedAttributeException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibUnresolvedRelationException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibUnsupportedClassException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibIntegrityException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibCollisionDetectedException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibDbException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibMathException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibStaleCacheDetectedException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibSubroutineException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibWrapSystemException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibWrapXercesException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( cflib::CFLibRuntimeException e ) { \
-		exceptionInfo = e; \
-	} \
-	catch( std::invalid_argument e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_invalid_argument ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::domain_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_domain_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::length_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_length_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::out_of_range e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_out_of_range ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::future_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_future_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::logic_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_logic_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::bad_optional_access e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_optional_access ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::range_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_range_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::overflow_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_overflow_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::regex_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_regex_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::ios_base::failure e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_ios_base_failure ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::filesystem::filesystem_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_filesystem_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::system_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_system_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::bad_typeid e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_typeid ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::bad_any_cast e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_any_cast ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::bad_cast e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_cast ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::bad_weak_ptr e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_weak_ptr ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::bad_function_call e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_function_call ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::bad_array_new_length e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
+	catch( ... ) { \
+		if( ! exceptionInfo.captureCurrentException( CLASS_NAME, S_ProcName ) ) { \
+			throw; \
 		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_array_new_length ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::bad_alloc e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_alloc ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::bad_exception e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_exception ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::bad_variant_access e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_variant_access ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-	} \
-	catch( std::exception e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_std_exception ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
 	}
 
 #define CFLIB_EXCEPTION_CATCH_GOTO(cleanup) \
-	catch( xercesc::SAXNotRecognizedException e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsXercesException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtXercesException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_SAXNotRecognizedException ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		const XMLCh* message = e.getMessage(); \
-		if( message != NULL ) { \
-			char* cUseMessage = xercesc::XMLString::transcode( message ); \
-			if( cUseMessage != NULL ) { \
-				std::string cppMessage( cUseMessage ); \
-				exceptionInfo.setMessageText( cppMessage ); \
-				xercesc::XMLString::release( &cUseMessage ); \
-				cUseMessage = NULL; \
-			} \
-		} \
-		goto cleanup; \
-	} \
-	catch( xercesc::SAXNotSupportedException e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsXercesException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtXercesException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_SAXNotSupportedException ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		const XMLCh* message = e.getMessage(); \
-		if( message != NULL ) { \
-			char* cUseMessage = xercesc::XMLString::transcode( message ); \
-			if( cUseMessage != NULL ) { \
-				std::string cppMessage( cUseMessage ); \
-				exceptionInfo.setMessageText( cppMessage ); \
-				xercesc::XMLString::release( &cUseMessage ); \
-				cUseMessage = NULL; \
-			} \
-		} \
-		goto cleanup; \
-	} \
-	catch( xercesc::SAXParseException e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsXercesException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtXercesException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_SAXParseException ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		const XMLCh* message = e.getMessage(); \
-		if( message != NULL ) { \
-			char* cUseMessage = xercesc::XMLString::transcode( message ); \
-			if( cUseMessage != NULL ) { \
-				std::string cppMessage( cUseMessage ); \
-				exceptionInfo.setMessageText( cppMessage ); \
-				xercesc::XMLString::release( &cUseMessage ); \
-				cUseMessage = NULL; \
-			} \
-		} \
-		goto cleanup; \
-	} \
-	catch( xercesc::SAXException e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsXercesException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtXercesException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_SAXException ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		const XMLCh* message = e.getMessage(); \
-		if( message != NULL ) { \
-			char* cUseMessage = xercesc::XMLString::transcode( message ); \
-			if( cUseMessage != NULL ) { \
-				std::string cppMessage( cUseMessage ); \
-				exceptionInfo.setMessageText( cppMessage ); \
-				xercesc::XMLString::release( &cUseMessage ); \
-				cUseMessage = NULL; \
-			} \
-		} \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibArgumentOverflowException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibArgumentRangeException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibArgumentUnderflowException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibEmptyArgumentException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibInvalidArgumentException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibNullArgumentException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibArgumentException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibMustOverrideException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibNotImplementedYetException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibNotSupportedException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibUsageException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibCodeStateException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibDependentsDetectedException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibPrimaryKeyNotNewException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibUniqueIndexViolationException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibUnrecognizedAttributeException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibUnresolvedRelationException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibUnsupportedClassException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibIntegrityException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibCollisionDetectedException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibDbException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibMathException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibStaleCacheDetectedException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibSubroutineException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibWrapSystemException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibWrapXercesException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( cflib::CFLibRuntimeException e ) { \
-		exceptionInfo = e; \
-		goto cleanup; \
-	} \
-	catch( std::invalid_argument e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_invalid_argument ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::domain_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_domain_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::length_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_length_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::out_of_range e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_out_of_range ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::future_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_future_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::logic_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_logic_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::bad_optional_access e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_optional_access ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::range_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_range_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::overflow_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
+	catch( ... ) { \
+		if( ! exceptionInfo.captureCurrentException( CLASS_NAME, S_ProcName ) ) { \
+			throw; \
 		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_overflow_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::regex_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_regex_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::ios_base::failure e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_ios_base_failure ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::filesystem::filesystem_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_filesystem_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::system_error e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_system_error ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::bad_typeid e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_typeid ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::bad_any_cast e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_any_cast ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::bad_cast e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_cast ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::bad_weak_ptr e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_weak_ptr ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::bad_function_call e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_function_call ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::bad_array_new_length e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_array_new_length ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::bad_alloc e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_alloc ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::bad_exception e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_exception ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::bad_variant_access e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_bad_variant_access ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
-		goto cleanup; \
-	} \
-	catch( std::exception e ) { \
-		if( ! exceptionInfo.empty() ) { \
-			exceptionInfo.reset(); \
-		} \
-		exceptionInfo.setIsSystemException(); \
-		exceptionInfo.setCause( cflib::CFLibExceptionInfo::S_CaughtSystemException ); \
-		exceptionInfo.setExceptionName( cflib::CFLibExceptionInfo::S_std_exception ); \
-		exceptionInfo.setClassFieldName( CLASS_NAME ); \
-		exceptionInfo.setMethodName( S_ProcName ); \
-		exceptionInfo.setMessageText( e.what() ); \
 		goto cleanup; \
 	}
 
@@ -994,6 +129,14 @@
 #define CFLIB_EXCEPTION_FORMATTEDMESSAGE \
 	exceptionInfo.getFormattedMessage()
 
+/*
+ *	Log the captured exception to log in CATEGORY_EXCEPTION.  The message is
+ *	only formatted if log is not NULL and the level is enabled.  Callers must
+ *	include cflib/ICFLibMessageLog.hpp.
+ */
+#define CFLIB_EXCEPTION_LOG( log, level ) \
+	CFLIB_LOG( ( log ), ( level ), cflib::ICFLibMessageLog::CATEGORY_EXCEPTION, exceptionInfo.getFormattedMessage() )
+
 #define CFLIB_EXCEPTION_FORMATTEDMESSAGEFIRSTLINE \
 	exceptionInfo.getFormattedMessageFirstLine()
 
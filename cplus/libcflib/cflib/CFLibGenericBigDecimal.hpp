@@ -71,6 +71,8 @@ namespace cflib {
 		static const std::string S_MpfrFunctionRoundedUp;
 		static const std::string S_MpfrSetStr;
 		static const std::string S_BaseArg3CannotBeOne;
+		static const std::string S_BelowAbsoluteMinValue;
+		static const std::string S_AboveAbsoluteMaxValue;
 		static const std::string S_MsgSetStrFailure;
 
 		/**
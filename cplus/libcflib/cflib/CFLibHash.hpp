@@ -0,0 +1,88 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <cflib/CFLib.hpp>
+
+namespace cflib {
+
+	/**
+	 *	Hash and equality functors for unordered containers keyed on CFLib
+	 *	values, all hashing the full value with the CFLib::hash() overloads.
+	 *	Strings and blobs are hashed with CFLib::hashBytes(); UUIDs use a
+	 *	shorter path for their fixed 16 bytes.
+	 *	<p>
+	 *	CFLibUuidHash and CFLibUuidEqualTo treat a uuid_ptr_t key as the 16
+	 *	bytes it points at, so the keys must stay valid while they are in
+	 *	the container, e.g. by pointing into the cached objects themselves:
+	 *	<pre>
+	 *	std::unordered_map<const unsigned char*, Obj*, CFLibUuidHash, CFLibUuidEqualTo> byId;
+	 *	</pre>
+	 */
+	class CFLibUuidHash {
+	public:
+		inline size_t operator()( const unsigned char* value ) const {
+			return( CFLib::hash( (const uuid_ptr_t)value ) );
+		}
+	};
+
+	class CFLibUuidEqualTo {
+	public:
+		inline bool operator()( const unsigned char* lhs, const unsigned char* rhs ) const {
+			if( ( lhs == NULL ) || ( rhs == NULL ) ) {
+				return( lhs == rhs );
+			}
+			return( 0 == memcmp( lhs, rhs, sizeof( uuid_t ) ) );
+		}
+	};
+
+	/**
+	 *	Hashes std::string keys, or std::string* keys by the text they point at.
+	 */
+	class CFLibStringHash {
+	public:
+		inline size_t operator()( const std::string& value ) const {
+			return( CFLib::hash( value ) );
+		}
+
+		inline size_t operator()( const std::string* value ) const {
+			return( CFLib::hash( value ) );
+		}
+	};
+
+	class CFLibBlobHash {
+	public:
+		inline size_t operator()( const std::vector<BYTE>& value ) const {
+			return( CFLib::hash( value ) );
+		}
+	};
+}
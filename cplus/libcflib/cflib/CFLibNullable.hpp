@@ -30,22 +30,21 @@
 
 namespace cflib {
 
+	/**
+	 *	The common base of the TCFLibNullable templates, holding the strings
+	 *	and the out-of-line throw used when getValue() finds a null.
+	 */
 	class CFLibNullable {
 
 	protected:
 		static const std::string S_GET_VALUE;
 		static const std::string S_VALUE;
 
-		bool nullFlag;
-
-	public:
-		CFLibNullable();
-		CFLibNullable( const bool arg );
-		~CFLibNullable();
-
-		const bool isNull() const;
-
-	protected:
-		void setNullFlag( const bool value );
+		/**
+		 *	Throw the CFLibNullArgumentException reported by getValue() for
+		 *	a null value.  Kept out of line so the inline accessors do not
+		 *	pull in the exception classes.
+		 */
+		[[noreturn]] static void throwNullValue( const std::string& className );
 	};
 }
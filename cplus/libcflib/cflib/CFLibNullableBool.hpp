@@ -26,29 +26,16 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cstdint>
-#include <string>
-#include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
 
 namespace cflib {
 
-	class CFLibNullableBool : public CFLibNullable {
-
-	public:
-		static const std::string CLASS_NAME;
-
-	protected:
-
-		bool	value;
-
+	/**
+	 *	A bool that may be null.  A class rather than a typedef of
+	 *	TCFLibNullable<bool>, so it can still be forward declared.
+	 */
+	class CFLibNullableBool : public TCFLibNullable<bool> {
 	public:
-		CFLibNullableBool();
-		CFLibNullableBool( const bool arg );
-		~CFLibNullableBool();
-
-		const bool getValue() const;
-		const bool* getReference() const;
-		void setValue( const bool arg );
-		void setNull();
+		using TCFLibNullable<bool>::TCFLibNullable;
 	};
 }
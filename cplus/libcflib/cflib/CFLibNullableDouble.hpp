@@ -26,29 +26,16 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cstdint>
-#include <string>
-#include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
 
 namespace cflib {
 
-	class CFLibNullableDouble : public CFLibNullable {
-
-	public:
-		static const std::string CLASS_NAME;
-
-	protected:
-
-		double	value;
-
+	/**
+	 *	A double that may be null.  A class rather than a typedef of
+	 *	TCFLibNullable<double>, so it can still be forward declared.
+	 */
+	class CFLibNullableDouble : public TCFLibNullable<double> {
 	public:
-		CFLibNullableDouble();
-		CFLibNullableDouble( const double arg );
-		~CFLibNullableDouble();
-
-		const double getValue() const;
-		const double* getReference() const;
-		void setValue( const double arg );
-		void setNull();
+		using TCFLibNullable<double>::TCFLibNullable;
 	};
 }
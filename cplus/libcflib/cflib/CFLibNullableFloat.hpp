@@ -26,29 +26,16 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cstdint>
-#include <string>
-#include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
 
 namespace cflib {
 
-	class CFLibNullableFloat : public CFLibNullable {
-
-	public:
-		static const std::string CLASS_NAME;
-
-	protected:
-
-		float	value;
-
+	/**
+	 *	A float that may be null.  A class rather than a typedef of
+	 *	TCFLibNullable<float>, so it can still be forward declared.
+	 */
+	class CFLibNullableFloat : public TCFLibNullable<float> {
 	public:
-		CFLibNullableFloat();
-		CFLibNullableFloat( const float arg );
-		~CFLibNullableFloat();
-
-		const float getValue() const;
-		const float* getReference() const;
-		void setValue( const float arg );
-		void setNull();
+		using TCFLibNullable<float>::TCFLibNullable;
 	};
 }
@@ -26,29 +26,16 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cstdint>
-#include <string>
-#include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
 
 namespace cflib {
 
-	class CFLibNullableInt16 : public CFLibNullable {
-
-	public:
-		static const std::string CLASS_NAME;
-
-	protected:
-
-		int16_t	value;
-
+	/**
+	 *	A int16_t that may be null.  A class rather than a typedef of
+	 *	TCFLibNullable<int16_t>, so it can still be forward declared.
+	 */
+	class CFLibNullableInt16 : public TCFLibNullable<int16_t> {
 	public:
-		CFLibNullableInt16();
-		CFLibNullableInt16( const int16_t arg );
-		~CFLibNullableInt16();
-
-		const int16_t getValue() const;
-		const int16_t* getReference() const;
-		void setValue( const int16_t arg );
-		void setNull();
+		using TCFLibNullable<int16_t>::TCFLibNullable;
 	};
 }
@@ -26,29 +26,16 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cstdint>
-#include <string>
-#include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
 
 namespace cflib {
 
-	class CFLibNullableInt32 : public CFLibNullable {
-
-	public:
-		static const std::string CLASS_NAME;
-
-	protected:
-
-		int32_t	value;
-
+	/**
+	 *	A int32_t that may be null.  A class rather than a typedef of
+	 *	TCFLibNullable<int32_t>, so it can still be forward declared.
+	 */
+	class CFLibNullableInt32 : public TCFLibNullable<int32_t> {
 	public:
-		CFLibNullableInt32();
-		CFLibNullableInt32( const int32_t arg );
-		~CFLibNullableInt32();
-
-		const int32_t getValue() const;
-		const int32_t* getReference() const;
-		void setValue( const int32_t arg );
-		void setNull();
+		using TCFLibNullable<int32_t>::TCFLibNullable;
 	};
 }
@@ -26,29 +26,16 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cstdint>
-#include <string>
-#include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
 
 namespace cflib {
 
-	class CFLibNullableInt64 : public CFLibNullable {
-
-	public:
-		static const std::string CLASS_NAME;
-
-	protected:
-
-		int64_t	value;
-
+	/**
+	 *	A int64_t that may be null.  A class rather than a typedef of
+	 *	TCFLibNullable<int64_t>, so it can still be forward declared.
+	 */
+	class CFLibNullableInt64 : public TCFLibNullable<int64_t> {
 	public:
-		CFLibNullableInt64();
-		CFLibNullableInt64( const int64_t arg );
-		~CFLibNullableInt64();
-
-		const int64_t getValue() const;
-		const int64_t* getReference() const;
-		void setValue( const int64_t arg );
-		void setNull();
+		using TCFLibNullable<int64_t>::TCFLibNullable;
 	};
 }
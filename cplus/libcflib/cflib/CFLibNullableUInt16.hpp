@@ -26,29 +26,16 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cstdint>
-#include <string>
-#include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
 
 namespace cflib {
 
-	class CFLibNullableUInt16 : public CFLibNullable {
-
-	public:
-		static const std::string CLASS_NAME;
-
-	protected:
-
-		uint16_t	value;
-
+	/**
+	 *	A uint16_t that may be null.  A class rather than a typedef of
+	 *	TCFLibNullable<uint16_t>, so it can still be forward declared.
+	 */
+	class CFLibNullableUInt16 : public TCFLibNullable<uint16_t> {
 	public:
-		CFLibNullableUInt16();
-		CFLibNullableUInt16( const uint16_t arg );
-		~CFLibNullableUInt16();
-
-		const uint16_t getValue() const;
-		const uint16_t* getReference() const;
-		void setValue( const uint16_t arg );
-		void setNull();
+		using TCFLibNullable<uint16_t>::TCFLibNullable;
 	};
 }
@@ -26,29 +26,16 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cstdint>
-#include <string>
-#include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
 
 namespace cflib {
 
-	class CFLibNullableUInt32 : public CFLibNullable {
-
-	public:
-		static const std::string CLASS_NAME;
-
-	protected:
-
-		uint32_t	value;
-
+	/**
+	 *	A uint32_t that may be null.  A class rather than a typedef of
+	 *	TCFLibNullable<uint32_t>, so it can still be forward declared.
+	 */
+	class CFLibNullableUInt32 : public TCFLibNullable<uint32_t> {
 	public:
-		CFLibNullableUInt32();
-		CFLibNullableUInt32( const uint32_t arg );
-		~CFLibNullableUInt32();
-
-		const uint32_t getValue() const;
-		const uint32_t* getReference() const;
-		void setValue( const uint32_t arg );
-		void setNull();
+		using TCFLibNullable<uint32_t>::TCFLibNullable;
 	};
 }
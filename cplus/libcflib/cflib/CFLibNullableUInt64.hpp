@@ -26,29 +26,16 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cstdint>
-#include <string>
-#include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
 
 namespace cflib {
 
-	class CFLibNullableUInt64 : public CFLibNullable {
-
-	public:
-		static const std::string CLASS_NAME;
-
-	protected:
-
-		uint64_t	value;
-
+	/**
+	 *	A uint64_t that may be null.  A class rather than a typedef of
+	 *	TCFLibNullable<uint64_t>, so it can still be forward declared.
+	 */
+	class CFLibNullableUInt64 : public TCFLibNullable<uint64_t> {
 	public:
-		CFLibNullableUInt64();
-		CFLibNullableUInt64( const uint64_t arg );
-		~CFLibNullableUInt64();
-
-		const uint64_t getValue() const;
-		const uint64_t* getReference() const;
-		void setValue( const uint64_t arg );
-		void setNull();
+		using TCFLibNullable<uint64_t>::TCFLibNullable;
 	};
 }
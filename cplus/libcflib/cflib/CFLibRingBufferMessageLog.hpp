@@ -0,0 +1,149 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <cflib/ICFLibMessageLog.hpp>
+#include <cflib/CFLibCachedMessageLog.hpp>
+
+namespace cflib {
+
+	/**
+	 *	A fixed-capacity in-memory message log that keeps the most recent
+	 *	messages, cheap enough to leave on in production for post-mortem capture.
+	 *	<p>
+	 *	Each message is stored as a record holding its timestamp, the logging
+	 *	thread, the indent level and the text.  Once the ring is full the oldest
+	 *	record is overwritten, and record strings keep their capacity, so a warm
+	 *	log does not allocate.  Any number of threads may log concurrently;
+	 *	each claims a slot with one atomic increment and only contends with a
+	 *	thread writing the same slot a full lap later.
+	 *	<p>
+	 *	Nothing is formatted until getCacheContents() is called.  A ring buffer
+	 *	log can be passed wherever a CFLibCachedMessageLog is expected; none
+	 *	of the base class's own storage is used.
+	 */
+	class CFLibRingBufferMessageLog : public CFLibCachedMessageLog {
+
+	public:
+		static const std::string CLASS_NAME;
+		static const uint32_t DEFAULT_CAPACITY;
+
+	protected:
+		class Record {
+		public:
+			std::atomic_flag busy;
+			uint64_t ticket;
+			int64_t timestampNanos;
+			uint32_t threadNumber;
+			int indentLevel;
+			std::string text;
+		};
+
+		Record* records;
+		uint64_t recordMask;
+		std::atomic<uint64_t> nextTicket;
+		std::atomic<uint64_t> clearedTicket;
+		std::atomic<int> ndnt;
+		mutable std::string rendered;
+
+	public:
+
+		/**
+		 *	Construct an empty log.
+		 *
+		 *	@param	capacity	The number of messages retained, rounded up to a power of two.
+		 */
+		CFLibRingBufferMessageLog( uint32_t capacity = DEFAULT_CAPACITY );
+
+		virtual ~CFLibRingBufferMessageLog();
+
+		/**
+		 *	Discard the retained messages.
+		 */
+		virtual void clearCache() override;
+
+		/**
+		 *	Render the retained messages, oldest first, one newline-terminated
+		 *	line per message prefixed with its UTC timestamp and thread number.
+		 *	<p>
+		 *	The returned string is rebuilt by each call and must not be used
+		 *	concurrently by more than one thread.
+		 */
+		virtual const std::string& getCacheContents() const override;
+
+		/**
+		 *	The number of messages retained, at most getCapacity().
+		 */
+		uint64_t getRecordCount() const;
+
+		uint64_t getCapacity() const;
+
+		/**
+		 *	The number of messages logged since construction or clearCache(),
+		 *	including those that have since been overwritten.
+		 */
+		uint64_t getMessageCount() const;
+
+		virtual int getMessageLogIndent() const override;
+
+		/**
+		 *	Decrease the indent of the logged messages another level.
+		 */
+		virtual void dedent() override;
+
+		/**
+		 *	Indent the logging messages another level.
+		 */
+		virtual void indent() override;
+
+		/**
+		 *	Record a message.
+		 */
+		virtual void message( const std::string& msg ) override;
+
+		using ICFLibMessageLog::message;
+
+		/**
+		 *	Does nothing; ring buffer logs don't write to files.
+		 */
+		virtual void openLogFile( const std::string& fileName ) override;
+
+		/**
+		 *	Does nothing; ring buffer logs don't write to files.
+		 */
+		virtual void closeLogFile() override;
+
+	protected:
+		static uint32_t getThreadNumber();
+	};
+}
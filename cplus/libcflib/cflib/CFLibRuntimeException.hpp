@@ -29,11 +29,14 @@
 #include <uuid/uuid.h>
 
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <chrono>
 #include <ctime>
 #include <list>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 
 #include <cflib/CFLibExceptionInfo.hpp>
@@ -79,6 +82,25 @@ namespace cflib {
 		static const std::string CLASS_NAME;
 		static const std::string CAUSE_NAME;
 
+	protected:
+		/**
+		 *	The formatted text returned by what(), built on first use so that
+		 *	throwing an exception that is caught and handled without ever
+		 *	being displayed does not pay for formatting it.  It is built under
+		 *	the inherited excTextLock and published by excWhatFormatted, so
+		 *	what() may be called from several threads at once.
+		 */
+		mutable std::atomic<bool> excWhatFormatted;
+		mutable std::string excWhatText;
+
+		/**
+		 *	The std::runtime_error every CFLib exception copies for its base.
+		 *	Copying it only shares its reference-counted text, where constructing
+		 *	a std::runtime_error from a string allocates.
+		 */
+		static const std::runtime_error& getDeferredWhat();
+
+	public:
 		virtual ~CFLibRuntimeException();
 
 		CFLibRuntimeException(
@@ -142,5 +164,9 @@ namespace cflib {
 
 		CFLibRuntimeException(
 			const std::string& msg );
+
+		CFLibRuntimeException& operator =( const CFLibRuntimeException& src );
+
+		virtual const char* what() const noexcept override;
 	};
 }
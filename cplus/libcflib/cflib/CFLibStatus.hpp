@@ -0,0 +1,186 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <cflib/CFLibExceptionInfo.hpp>
+#include <cflib/CFLibRuntimeException.hpp>
+
+namespace cflib {
+
+	/**
+	 *	The outcome of a non-throwing operation: either success, or a compact
+	 *	status code plus the pieces needed to describe the failure.
+	 *	<p>
+	 *	Nothing is formatted or allocated when a successful status is created.
+	 *	A failed status borrows the class and method names, which must be
+	 *	static constants, and copies the argument name, argument value and
+	 *	detail, which are normally the caller's input.
+	 *	<p>
+	 *	This lets bulk loaders reject bad input values cheaply, and only turn
+	 *	a failure into a CFLib exception at an API boundary.
+	 */
+	class CFLibStatus {
+
+	public:
+		static const std::string CLASS_NAME;
+
+		/**
+		 *	The operation succeeded.
+		 */
+		static const int STATUS_OK;
+
+		/**
+		 *	The input was empty, so there is no value.  Materializes as a
+		 *	CFLibNullArgumentException.
+		 */
+		static const int STATUS_NULL;
+
+		/**
+		 *	The input was malformed.  Materializes as a CFLibInvalidArgumentException.
+		 */
+		static const int STATUS_INVALID_ARGUMENT;
+
+		/**
+		 *	The input was larger than the target type can hold.  Materializes
+		 *	as a CFLibArgumentOverflowException.
+		 */
+		static const int STATUS_OVERFLOW;
+
+		/**
+		 *	The input was smaller than the target type can hold.  Materializes
+		 *	as a CFLibArgumentUnderflowException.
+		 */
+		static const int STATUS_UNDERFLOW;
+
+	protected:
+		int statusCode;
+		size_t argOffset;
+		const std::string* className;
+		const std::string* methodName;
+		std::string argName;
+		std::string argValue;
+		std::string detail;
+
+		/**
+		 *	The violated limit of an overflow or underflow, held raw.  The kind
+		 *	is one of the CFLibExceptionInfo::ARG_VALUE_* constants, with
+		 *	ARG_VALUE_TEXT meaning no limit was recorded.
+		 */
+		int boundKind;
+		cflibexcargvalue_t bound;
+
+		std::string getBoundString() const;
+		std::string getInvalidArgumentMessage() const;
+
+	public:
+		/**
+		 *	Construct a successful status.
+		 */
+		CFLibStatus();
+
+		/**
+		 *	Construct a failed status.
+		 *
+		 *	@param	argStatusCode	One of the STATUS_* constants.
+		 *	@param	argClassName	The class reporting the failure; borrowed.
+		 *	@param	argMethodName	The method reporting the failure; borrowed.
+		 *	@param	argArgOffset	The offset of the offending argument.
+		 *	@param	argArgName	The name of the offending argument or field.
+		 *	@param	argArgValue	The offending input text.
+		 *	@param	argDetail	What was expected of the input.
+		 */
+		CFLibStatus( int argStatusCode,
+			const std::string& argClassName,
+			const std::string& argMethodName,
+			size_t argArgOffset,
+			const std::string& argArgName,
+			const std::string& argArgValue,
+			const std::string& argDetail );
+
+		CFLibStatus( const CFLibStatus& src );
+		CFLibStatus& operator =( const CFLibStatus& src );
+
+		~CFLibStatus();
+
+		inline int getStatusCode() const {
+			return( statusCode );
+		}
+
+		inline bool isOk() const {
+			return( statusCode == STATUS_OK );
+		}
+
+		inline bool isNull() const {
+			return( statusCode == STATUS_NULL );
+		}
+
+		inline bool isError() const {
+			return( ( statusCode != STATUS_OK ) && ( statusCode != STATUS_NULL ) );
+		}
+
+		const std::string& getClassName() const;
+		const std::string& getMethodName() const;
+		size_t getArgOffset() const;
+		const std::string& getArgName() const;
+		const std::string& getArgValue() const;
+		const std::string& getDetail() const;
+
+		/**
+		 *	Record the limit an overflow or underflow status exceeded.
+		 */
+		void setBound( int64_t value );
+		void setBound( uint64_t value );
+		void setBound( double value );
+
+		/**
+		 *	Allocate the CFLib exception this status describes.
+		 *
+		 *	@returns	A new exception the caller must delete, or NULL if the status is STATUS_OK.
+		 *		An unrecognized status code yields a CFLibArgumentRangeException
+		 *		describing the code.
+		 */
+		CFLibRuntimeException* newException() const;
+
+		/**
+		 *	Throw the CFLib exception this status describes.  Does nothing
+		 *	if the status is STATUS_OK.
+		 */
+		void throwException() const;
+
+		/**
+		 *	Format the message of the exception this status describes.
+		 *
+		 *	@returns	The formatted message, or an empty string if the status is STATUS_OK.
+		 */
+		std::string getMessage() const;
+	};
+}
@@ -0,0 +1,256 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#	include <emmintrin.h>
+#endif
+
+#include <cflib/CFLib.hpp>
+
+namespace cflib {
+
+	/**
+	 *	A UUID held by value: 16 bytes, 16-byte aligned and trivially
+	 *	copyable, so it can be stored directly in containers and records
+	 *	instead of through a uuid_ptr_t to a separately allocated uuid_t.
+	 *	<p>
+	 *	The bytes are in the same order as a uuid_t, and data() can be
+	 *	passed anywhere a uuid_ptr_t is expected.  Ordering is by unsigned
+	 *	byte value, which matches uuid_compare().
+	 */
+	class alignas( 16 ) CFLibUuid {
+
+	public:
+		static const std::string CLASS_NAME;
+
+		/**
+		 *	The length of the xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx text form.
+		 */
+		static constexpr size_t FORMATTED_LENGTH = 36;
+
+	protected:
+		unsigned char bytes[16];
+
+		static constexpr int hexValue( char ch ) {
+			return( ( ( ch >= '0' ) && ( ch <= '9' ) ) ? ( ch - '0' )
+				: ( ( ch >= 'a' ) && ( ch <= 'f' ) ) ? ( ch - 'a' + 10 )
+				: ( ( ch >= 'A' ) && ( ch <= 'F' ) ) ? ( ch - 'A' + 10 )
+				: -1 );
+		}
+
+		static inline uint64_t readHalf( const unsigned char* src ) {
+			uint64_t half;
+			memcpy( &half, src, sizeof( half ) );
+#if defined(__GNUC__) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+			half = __builtin_bswap64( half );
+#endif
+			return( half );
+		}
+
+	public:
+
+		/**
+		 *	Construct the nil UUID.
+		 */
+		constexpr CFLibUuid()
+		: bytes{}
+		{
+		}
+
+		/**
+		 *	Copy the 16 bytes of a uuid_t, or construct the nil UUID if
+		 *	src is NULL.
+		 */
+		explicit CFLibUuid( const unsigned char* src )
+		: bytes{}
+		{
+			if( src != NULL ) {
+				memcpy( bytes, src, sizeof( bytes ) );
+			}
+		}
+
+		/**
+		 *	Parse the xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx text form without
+		 *	allocating or throwing, in either case of hex digits.  Usable in
+		 *	constant expressions.
+		 *
+		 *	@returns	true if text was well formed and target was set,
+		 *		false if target was left unchanged.
+		 */
+		static constexpr bool tryParse( std::string_view text, CFLibUuid& target ) {
+			if( text.length() != FORMATTED_LENGTH ) {
+				return( false );
+			}
+			CFLibUuid parsed;
+			size_t pos = 0;
+			for( size_t i = 0; i < sizeof( parsed.bytes ); i++ ) {
+				if( ( pos == 8 ) || ( pos == 13 ) || ( pos == 18 ) || ( pos == 23 ) ) {
+					if( text[pos] != '-' ) {
+						return( false );
+					}
+					pos ++;
+				}
+				int high = hexValue( text[pos] );
+				int low = hexValue( text[pos + 1] );
+				if( ( high < 0 ) || ( low < 0 ) ) {
+					return( false );
+				}
+				parsed.bytes[i] = (unsigned char)( ( high << 4 ) | low );
+				pos += 2;
+			}
+			target = parsed;
+			return( true );
+		}
+
+		/**
+		 *	Parse the text form, throwing a CFLibInvalidArgumentException if
+		 *	it is malformed.
+		 */
+		static CFLibUuid parse( const std::string& value );
+
+		/**
+		 *	@returns	A new random (version 4) UUID.
+		 */
+		static CFLibUuid generate();
+
+		/**
+		 *	@returns	A new time-based (version 1) UUID.
+		 */
+		static CFLibUuid generateTime();
+
+		inline const unsigned char* data() const {
+			return( bytes );
+		}
+
+		inline unsigned char* data() {
+			return( bytes );
+		}
+
+		inline void copyTo( uuid_ptr_t target ) const {
+			memcpy( target, bytes, sizeof( bytes ) );
+		}
+
+		inline bool isNil() const {
+			return( *this == CFLibUuid() );
+		}
+
+		/**
+		 *	@returns	A negative, zero or positive value as this UUID orders
+		 *		before, equal to or after rhs.
+		 */
+		inline int compare( const CFLibUuid& rhs ) const {
+			uint64_t lhsHigh = readHalf( bytes );
+			uint64_t rhsHigh = readHalf( rhs.bytes );
+			if( lhsHigh != rhsHigh ) {
+				return( ( lhsHigh < rhsHigh ) ? -1 : 1 );
+			}
+			uint64_t lhsLow = readHalf( bytes + 8 );
+			uint64_t rhsLow = readHalf( rhs.bytes + 8 );
+			if( lhsLow != rhsLow ) {
+				return( ( lhsLow < rhsLow ) ? -1 : 1 );
+			}
+			return( 0 );
+		}
+
+		/**
+		 *	Write the 36 character lower case text form to target, which is
+		 *	not NUL terminated.
+		 */
+		constexpr void format( char* target ) const {
+			const char* digits = "0123456789abcdef";
+			size_t pos = 0;
+			for( size_t i = 0; i < sizeof( bytes ); i++ ) {
+				if( ( i == 4 ) || ( i == 6 ) || ( i == 8 ) || ( i == 10 ) ) {
+					target[pos++] = '-';
+				}
+				target[pos++] = digits[ bytes[i] >> 4 ];
+				target[pos++] = digits[ bytes[i] & 0x0f ];
+			}
+		}
+
+		std::string toString() const;
+
+		inline size_t hash() const {
+			return( CFLib::hash( (const uuid_ptr_t)bytes ) );
+		}
+
+		inline bool operator ==( const CFLibUuid& rhs ) const {
+#if defined(__SSE2__)
+			__m128i lhsBytes = _mm_load_si128( (const __m128i*)bytes );
+			__m128i rhsBytes = _mm_load_si128( (const __m128i*)rhs.bytes );
+			return( _mm_movemask_epi8( _mm_cmpeq_epi8( lhsBytes, rhsBytes ) ) == 0xffff );
+#else
+			uint64_t lhsHalves[2];
+			uint64_t rhsHalves[2];
+			memcpy( lhsHalves, bytes, sizeof( bytes ) );
+			memcpy( rhsHalves, rhs.bytes, sizeof( bytes ) );
+			return( ( ( lhsHalves[0] ^ rhsHalves[0] ) | ( lhsHalves[1] ^ rhsHalves[1] ) ) == 0 );
+#endif
+		}
+
+		inline bool operator !=( const CFLibUuid& rhs ) const {
+			return( ! ( *this == rhs ) );
+		}
+
+		inline bool operator <( const CFLibUuid& rhs ) const {
+			return( compare( rhs ) < 0 );
+		}
+
+		inline bool operator <=( const CFLibUuid& rhs ) const {
+			return( compare( rhs ) <= 0 );
+		}
+
+		inline bool operator >( const CFLibUuid& rhs ) const {
+			return( compare( rhs ) > 0 );
+		}
+
+		inline bool operator >=( const CFLibUuid& rhs ) const {
+			return( compare( rhs ) >= 0 );
+		}
+	};
+
+	static_assert( sizeof( CFLibUuid ) == sizeof( uuid_t ), "CFLibUuid must be exactly the size of a uuid_t" );
+	static_assert( std::is_trivially_copyable<CFLibUuid>::value, "CFLibUuid must be trivially copyable" );
+}
+
+namespace std {
+
+	template<> struct hash<cflib::CFLibUuid> {
+		inline size_t operator()( const cflib::CFLibUuid& value ) const {
+			return( value.hash() );
+		}
+	};
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cflib {
+
+	/**
+	 *	A fixed set of worker threads for splitting one call's work into
+	 *	tasks, so bulk operations such as TCFLibOwningVector::parallelClone()
+	 *	do not start threads of their own on every call.
+	 *	<p>
+	 *	forEach() runs every task of a batch and returns once they are all
+	 *	done.  The calling thread runs tasks of its own batch as well, so a
+	 *	batch always completes even when every pool thread is busy with
+	 *	other callers' work, and forEach() may be called from any thread,
+	 *	including a pool thread.
+	 */
+	class CFLibWorkerPool {
+
+	public:
+		static const std::string CLASS_NAME;
+
+	protected:
+		/**
+		 *	One forEach() call's tasks, claimed by index.
+		 */
+		class Batch {
+		public:
+			const std::function<void( size_t )>* task;
+			size_t numTasks;
+			std::atomic<size_t> nextTask;
+			std::atomic<size_t> tasksDone;
+		};
+
+		std::mutex lock;
+		std::condition_variable wake;
+		std::condition_variable batchDone;
+		std::deque<std::shared_ptr<Batch>> batches;
+		std::vector<std::thread> threads;
+		bool stopping;
+
+		void runWorker();
+
+		/**
+		 *	Run tasks of batch until none are left to claim.
+		 */
+		void runTasks( Batch& batch );
+
+	public:
+		/**
+		 *	Start the pool's threads.
+		 *
+		 *	@param	numThreads	The number of worker threads, or 0 for one fewer
+		 *		than the number of hardware threads, since the caller of
+		 *		forEach() works too.
+		 */
+		CFLibWorkerPool( unsigned numThreads = 0 );
+
+		/**
+		 *	Stop and join the pool's threads.  No forEach() may be running.
+		 */
+		~CFLibWorkerPool();
+
+		CFLibWorkerPool( const CFLibWorkerPool& src ) = delete;
+		CFLibWorkerPool& operator =( const CFLibWorkerPool& src ) = delete;
+
+		/**
+		 *	The process-wide pool, started on first use.
+		 */
+		static CFLibWorkerPool& getSharedPool();
+
+		/**
+		 *	@returns	The number of worker threads, not counting forEach() callers.
+		 */
+		unsigned getNumThreads() const;
+
+		/**
+		 *	Call task( taskIdx ) once for each taskIdx from 0 to numTasks - 1,
+		 *	spread over the pool's threads and the calling thread, and return
+		 *	once every call has returned.  task must not throw; catch and
+		 *	record failures in the task instead.
+		 */
+		void forEach( size_t numTasks, const std::function<void( size_t )>& task );
+	};
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <cflib/CFLib.hpp>
+#include <cflib/CFLibXmlCoreParallelParser.hpp>
+
+namespace cflib {
+
+	/**
+	 *	The CFLibXmlCoreChunkedParser splits very large documents made of many
+	 *	sibling records under one root element into chunks that are parsed
+	 *	concurrently.
+	 *	<p>
+	 *	splitFile() maps the file and scans the raw bytes for the start tags of
+	 *	the root element's children.  The record boundaries closest to the
+	 *	requested chunk size become split points.  Each chunk is parsed as a
+	 *	document of its own: the original prolog and root start tag, so the
+	 *	XML declaration, DOCTYPE and namespace declarations still apply, then
+	 *	the chunk's records, then the root end tag.
+	 *	<p>
+	 *	Each worker reuses one parser from the factory for all the chunks it
+	 *	takes.  The chunk text is read straight from the mapped file.
+	 *	Subclasses collect what a parser built for a chunk by overriding
+	 *	chunkParsed(), which runs before the parser moves on to another chunk.
+	 *	Results are in chunk order.
+	 *	<p>
+	 *	Only ASCII compatible encodings such as UTF-8 and ISO-8859-* can be
+	 *	split; splitFile() rejects other encodings before any chunking.  Line numbers in messages and locations are mapped back to the
+	 *	original file; getChunkLineAdjustment() gives the offset applied.
+	 *	Schema constraints on the root element's content model, such as
+	 *	minOccurs or identity constraints spanning records, are checked per
+	 *	chunk rather than for the whole document.
+	 */
+	class CFLibXmlCoreChunkedParser : public CFLibXmlCoreParallelParser {
+
+	public:
+		static const std::string CLASS_NAME;
+
+	protected:
+		class MappedFile {
+		public:
+			std::string fileName;
+			const char* bytes;
+			size_t length;
+			std::string prefix;
+			std::string suffix;
+			size_t prefixNewLines;
+		};
+
+		std::vector<MappedFile*> mappedFiles;
+		// Indexed by job; chunkFile is NULL for jobs added by addFile() or addBuffer()
+		std::vector<MappedFile*> chunkFile;
+		std::vector<size_t> chunkBegin;
+		std::vector<size_t> chunkEnd;
+		std::vector<int64_t> chunkLineAdjustment;
+
+	public:
+
+		/**
+		 *	Construct a chunked parser.
+		 *
+		 *	@param	factory	The factory for chunk parsers.  Not owned.
+		 *	@param	numThreads	The number of worker threads, or 0 to use one per hardware thread.
+		 */
+		CFLibXmlCoreChunkedParser( ICFLibXmlCoreSaxParserFactory* factory, unsigned numThreads = 0 );
+		virtual ~CFLibXmlCoreChunkedParser();
+
+		/**
+		 *	Map a file and queue its records as chunks for the next run().
+		 *
+		 *	@param	fileName	The document to split.
+		 *	@param	numChunks	The number of chunks to aim for, or 0 for four per thread.
+		 *
+		 *	@returns	The number of chunks queued, which may be fewer than requested
+		 *		when the document has fewer records.
+		 */
+		std::vector<std::string>::size_type splitFile( const std::string& fileName, unsigned numChunks = 0 );
+
+		/**
+		 *	The number of lines to add to a locator line number reported while
+		 *	parsing a chunk to get the line number in the original file.
+		 */
+		int64_t getChunkLineAdjustment( std::vector<std::string>::size_type jobIdx ) const;
+
+		/**
+		 *	Discard the queued jobs and the results of the last run, and unmap
+		 *	the split files.
+		 */
+		virtual void clear();
+
+		/**
+		 *	Find the offsets at which a document can be split between top level records.
+		 *	<p>
+		 *	Comments, processing instructions, CDATA sections, the DOCTYPE and quoted
+		 *	attribute values are skipped so markup inside them is never mistaken for
+		 *	a record boundary.
+		 *
+		 *	@param	bytes	The raw document.
+		 *	@param	length	The number of bytes in the document.
+		 *	@param	targetChunkSize	The minimum distance between split points.
+		 *	@param	rootContentBegin	Set to the offset just past the root start tag.
+		 *	@param	rootContentEnd	Set to the offset of the root end tag.
+		 *	@param	rootQName	Set to the qualified name of the root element.
+		 *	@param	splitPoints	Filled with the offsets of the '<' of the records
+		 *		that start each chunk after the first.
+		 *
+		 *	@returns	false if the root element is an empty element tag.
+		 */
+		static bool findRecordBoundaries( const char* bytes,
+			size_t length,
+			size_t targetChunkSize,
+			size_t& rootContentBegin,
+			size_t& rootContentEnd,
+			std::string& rootQName,
+			std::vector<size_t>& splitPoints );
+
+		/**
+		 *	Check that a document can be split on its '<' bytes.
+		 *	<p>
+		 *	A UTF-16 or UTF-32 byte order mark, a document that starts with the
+		 *	UTF-16, UTF-32 or EBCDIC form of "&lt;?", and an XML declaration naming
+		 *	any encoding other than UTF-8, US-ASCII, ISO-8859-* or windows-125*
+		 *	are rejected.  A UTF-8 byte order mark is allowed.
+		 *
+		 *	@param	bytes	The raw document.
+		 *	@param	length	The number of bytes in the document.
+		 *
+		 *	@returns	true if the document is in an ASCII compatible encoding.
+		 */
+		static bool isSplittableEncoding( const char* bytes, size_t length );
+
+	protected:
+		virtual void parseJob( CFLibXmlCoreSaxParser* parser, std::vector<std::string>::size_type jobIdx );
+
+		/**
+		 *	Called on the worker thread once a job has been parsed without an
+		 *	exception, before its parser takes another job.  Jobs finish out of
+		 *	order, so anything collected should be stored by jobIdx.
+		 *	The default does nothing.
+		 */
+		virtual void chunkParsed( CFLibXmlCoreSaxParser* parser, std::vector<std::string>::size_type jobIdx );
+
+		void unmapFiles();
+	};
+}
@@ -109,6 +109,7 @@ namespace cflib {
 		void clearElementText();
 		std::string getElementText() const;
 		void appendElementText( const XMLCh* chars, std::string::size_type length );
+		void finishElementText();
 	
 		CFLibXmlCoreElementHandler* getElementHandler() const;
 
@@ -65,6 +65,7 @@ namespace cflib {
 	private:
 		CFLibXmlCoreParser* parser;
 		std::map<std::string,CFLibXmlCoreElementHandler*> elementHandler;
+		bool elementTextRequired;
 
 	public:
 		static const std::string CLASS_NAME;
@@ -78,7 +79,18 @@ namespace cflib {
 	protected:
 		void setParser( CFLibXmlCoreParser* coreParser );
 
+		/**
+		 *	Handlers that never call getElementText() can turn off text
+		 *	collection, making the parser's characters() callback a no-op
+		 *	for their elements.  Text is collected by default.
+		 */
+		void setElementTextRequired( bool value );
+
 	public:
+		inline bool isElementTextRequired() const {
+			return( elementTextRequired );
+		}
+
 		void addElementHandler( const std::string& qName, CFLibXmlCoreElementHandler* handler );
 		CFLibXmlCoreElementHandler* getElementHandler( const std::string& qName ) const;
 		CFLibXmlCoreElementHandler* getElementHandler( const XMLCh* qName ) const;
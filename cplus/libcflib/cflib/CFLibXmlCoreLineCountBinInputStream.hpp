@@ -46,12 +46,19 @@ namespace cflib {
 
 	class CFLibXmlCoreParser;
 
+	/**
+	 *	Wraps the input stream of a document parsed for a CFLibXmlCoreParser
+	 *	so the parser can report the byte offset reached.  The stream is the
+	 *	parser's locator only until the SAX2 reader starts the document and
+	 *	installs the scanner's locator, so it does not count lines: it
+	 *	reads ahead of the scanner in large blocks, and its position would
+	 *	be wrong anyway.  Until then line and column are reported as 0,
+	 *	meaning unknown.
+	 */
 	class CFLibXmlCoreLineCountBinInputStream : public virtual xercesc::BinInputStream, public virtual xercesc::Locator {
 		protected:
 			CFLibXmlCoreParser* coreParser;
 			xercesc::BinInputStream* chainedInput;
-			XMLFilePos myLineNumber;
-			XMLFilePos myColNumber;
 			XMLCh * publicId;
 			XMLCh * systemId;
 
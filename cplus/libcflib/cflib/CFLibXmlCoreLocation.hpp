@@ -0,0 +1,87 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace cflib {
+
+	/**
+	 *	A position in a parsed document, captured without building any strings.
+	 *	<p>
+	 *	The parser transcodes the document name once per document and every
+	 *	location captured in it shares that string by reference count, so a
+	 *	location can be copied around and kept after the parser has moved on
+	 *	to other documents, and the name is freed with the last location that
+	 *	refers to it.  Formatting is deferred until toString() or appendTo()
+	 *	is called, normally only when a message is rendered.
+	 */
+	class CFLibXmlCoreLocation {
+
+	public:
+		static const std::string CLASS_NAME;
+
+		/**
+		 *	The document name, or NULL for a location captured with no
+		 *	document being parsed.
+		 */
+		std::shared_ptr<const std::string> documentName;
+		uint64_t lineNumber;
+		uint64_t columnNumber;
+
+		/**
+		 *	The number of bytes the parser had read from the document, which
+		 *	runs ahead of the position by up to the size of the reader's buffer.
+		 *	0 when the document was not read through a line counting stream.
+		 */
+		uint64_t byteOffset;
+
+		CFLibXmlCoreLocation();
+
+		/**
+		 *	The document name, or an empty string if there is none.
+		 */
+		const std::string& getDocumentName() const;
+
+		/**
+		 *	Format the location as "documentName[line,column]".
+		 */
+		std::string toString() const;
+
+		/**
+		 *	Append the location to buff.
+		 *
+		 *	@param	buff	The buffer to append to.
+		 *	@param	withColumn	Whether to include the column number.
+		 */
+		void appendTo( std::string& buff, bool withColumn = true ) const;
+	};
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <xercesc/validators/common/Grammar.hpp>
+
+#include <cflib/CFLib.hpp>
+#include <cflib/TCFLibOwningVector.hpp>
+#include <cflib/ICFLibXmlCoreSaxParserFactory.hpp>
+#include <cflib/CFLibXmlCoreParseResult.hpp>
+
+namespace cflib {
+
+	/**
+	 *	The CFLibXmlCoreParallelParser parses a batch of independent documents
+	 *	using a fixed number of worker threads.
+	 *	<p>
+	 *	Each worker owns one parser created by the factory, so no parser state
+	 *	is ever shared between threads.  Queued documents are dealt out
+	 *	round-robin to per-worker queues; a worker that drains its own queue
+	 *	steals from the back of the other workers' queues, so a few very large
+	 *	documents do not leave the remaining threads idle.
+	 *	<p>
+	 *	Grammars loaded with loadSharedGrammar() are placed in the static
+	 *	CFLibXmlCoreParser grammar pool.  Worker parsers are created on top of
+	 *	that pool, which is locked read-only for the duration of run().
+	 *	<p>
+	 *	Every document is parsed with its own message log, and the logged
+	 *	messages and any exception are reported per document in submission order.
+	 */
+	class CFLibXmlCoreParallelParser {
+
+	public:
+		static const std::string CLASS_NAME;
+
+	protected:
+		ICFLibXmlCoreSaxParserFactory* parserFactory;
+		unsigned threadCount;
+		std::vector<std::string> jobNames;
+		std::vector<std::string*> jobContents;
+		std::TCFLibOwningVector<CFLibXmlCoreParseResult*> results;
+		std::vector<CFLibXmlCoreSaxParser*> parsers;
+		std::vector< std::deque<std::vector<std::string>::size_type> >* workQueues;
+		std::vector<std::mutex>* workQueueLocks;
+
+	public:
+
+		/**
+		 *	Construct a parallel parser.
+		 *
+		 *	@param	factory	The factory for worker parsers.  Not owned.
+		 *	@param	numThreads	The number of worker threads, or 0 to use one per hardware thread.
+		 */
+		CFLibXmlCoreParallelParser( ICFLibXmlCoreSaxParserFactory* factory, unsigned numThreads = 0 );
+		virtual ~CFLibXmlCoreParallelParser();
+
+		/**
+		 *	The queued buffers, parsers and work queues are owned through raw
+		 *	pointers, so a parallel parser cannot be copied.
+		 */
+		CFLibXmlCoreParallelParser( const CFLibXmlCoreParallelParser& src ) = delete;
+		CFLibXmlCoreParallelParser& operator =( const CFLibXmlCoreParallelParser& src ) = delete;
+
+		unsigned getThreadCount() const;
+
+		/**
+		 *	Load an XSD into the shared grammar pool.  Must be called before run().
+		 */
+		static xercesc::Grammar* loadSharedGrammar( const std::string& xsdFileName );
+
+		/**
+		 *	Queue a file to be parsed by the next run().
+		 */
+		void addFile( const std::string& fileName );
+
+		/**
+		 *	Queue an in-memory document to be parsed by the next run().
+		 */
+		void addBuffer( const std::string& bufName, const std::string& contents );
+
+		/**
+		 *	The number of documents queued.
+		 */
+		std::vector<std::string>::size_type getJobCount() const;
+
+		/**
+		 *	Parse every queued document and wait for all of them to complete.
+		 *
+		 *	@returns	One result per queued document, in the order queued.
+		 */
+		const std::TCFLibOwningVector<CFLibXmlCoreParseResult*>& run();
+
+		const std::TCFLibOwningVector<CFLibXmlCoreParseResult*>& getResults() const;
+
+		/**
+		 *	Discard the queued documents and the results of the last run.
+		 */
+		virtual void clear();
+
+	protected:
+
+		/**
+		 *	Create the parsers used by run().  Called on the thread invoking run().
+		 *	The default creates one parser per worker.
+		 */
+		virtual void createParsers( unsigned numWorkers );
+
+		/**
+		 *	Select the parser a worker uses for a job.
+		 *	The default returns the worker's own parser.
+		 */
+		virtual CFLibXmlCoreSaxParser* getJobParser( unsigned workerIdx, std::vector<std::string>::size_type jobIdx );
+
+		/**
+		 *	Parse one queued job.  Called on a worker thread.
+		 */
+		virtual void parseJob( CFLibXmlCoreSaxParser* parser, std::vector<std::string>::size_type jobIdx );
+
+		/**
+		 *	Release the parsers once run() has joined the workers.
+		 */
+		virtual void releaseParsers();
+
+		CFLibXmlCoreSaxParser* newSharedPoolParser();
+		void deleteParsers();
+		void endRun();
+		void runWorker( unsigned workerIdx );
+		bool takeJob( unsigned workerIdx, std::vector<std::string>::size_type& jobIdx );
+		void clearResults();
+	};
+}
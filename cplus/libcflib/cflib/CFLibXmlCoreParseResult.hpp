@@ -0,0 +1,81 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <cflib/CFLib.hpp>
+
+namespace cflib {
+
+	/**
+	 *	The outcome of parsing one document with a CFLibXmlCoreParallelParser.
+	 */
+	class CFLibXmlCoreParseResult {
+
+	protected:
+		std::string documentName;
+		bool succeeded;
+		std::string messages;
+		std::string exceptionMessage;
+
+	public:
+		static const std::string CLASS_NAME;
+
+		CFLibXmlCoreParseResult( const std::string& docName );
+		virtual ~CFLibXmlCoreParseResult();
+
+		/**
+		 *	The file name or buffer name the document was queued under.
+		 */
+		const std::string& getDocumentName() const;
+
+		/**
+		 *	Did the parse complete without throwing an exception?
+		 *	Warnings and recoverable errors reported through the message log
+		 *	do not cause a parse to fail.
+		 */
+		bool getSucceeded() const;
+		void setSucceeded( bool value );
+
+		/**
+		 *	The messages logged for this document, one per line.
+		 */
+		const std::string& getMessages() const;
+		void setMessages( const std::string& value );
+
+		/**
+		 *	The formatted message of the exception that ended the parse,
+		 *	or an empty string if the parse succeeded.
+		 */
+		const std::string& getExceptionMessage() const;
+		void setExceptionMessage( const std::string& value );
+	};
+}
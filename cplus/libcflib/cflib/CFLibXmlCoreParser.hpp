@@ -57,10 +57,14 @@
 #include <cflib/ICFLibMessageLog.hpp>
 #include <cflib/CFLibXmlUtil.hpp>
 #include <cflib/CFLibXmlCoreContext.hpp>
+#include <cflib/CFLibXmlCoreUtf8Transcoder.hpp>
+#include <cflib/CFLibXmlCoreLocation.hpp>
 #include <cflib/ICFLibXmlCoreContextFactory.hpp>
 
 namespace cflib {
 
+	class CFLibXmlCoreLineCountBinInputStream;
+
 	class CFLibXmlCoreParser
 	: public xercesc::DefaultHandler,
 	  public ICFLibXmlCoreContextFactory
@@ -77,6 +81,16 @@ namespace cflib {
 		ICFLibXmlCoreContextFactory* xmlCoreContextFactory;
 		static xercesc::XMLGrammarPoolImpl* grammarPool;
 		xercesc::Locator* docLocator;
+		CFLibXmlCoreLineCountBinInputStream* lineCountStream;
+		std::shared_ptr<const std::string> docLocatorDocumentName;
+		bool docLocatorDocumentNameKnown;
+		// The locator id docLocatorDocumentName was built from, to notice
+		// when the locator moves into or out of an external entity
+		const XMLCh* docLocatorDocumentIdPtr;
+		std::basic_string<XMLCh> docLocatorDocumentId;
+		CFLibXmlCoreUtf8Transcoder utf8Transcoder;
+		XMLFileLoc lineAdjustmentFrom;
+		int64_t lineAdjustment;
 
 	public:
 
@@ -94,18 +108,66 @@ namespace cflib {
 	
 		static xercesc::Grammar* addToGrammarPool( const std::string& name, xercesc::Grammar* grammar );
 
+		/**
+		 *	Restore the grammar pool from a cache file written by saveGrammarCache(),
+		 *	so compiled schemas need not be parsed from their XSDs again.
+		 *	<p>
+		 *	The pool must be empty.  A missing, unreadable or stale cache file,
+		 *	such as one written by a different Xerces release, is not an error;
+		 *	the pool is left empty and false is returned so the caller can load
+		 *	the XSDs and save a fresh cache.
+		 *
+		 *	@param	cacheFileName	The file system name of the cache file.
+		 *
+		 *	@returns	true if the grammars were restored from the cache.
+		 */
+		static bool loadGrammarCache( const std::string& cacheFileName );
+
+		/**
+		 *	Write the compiled grammars in the pool to a cache file.
+		 *
+		 *	@param	cacheFileName	The file system name of the cache file.
+		 */
+		static void saveGrammarCache( const std::string& cacheFileName );
+
 		virtual const xercesc::Locator* getDocumentLocator() const;
 		virtual void setDocumentLocator( xercesc::Locator* newLocator );
 
+		/**
+		 *	Called by a CFLibXmlCoreLineCountBinInputStream reading a document
+		 *	for this parser, so getLocation() can report its byte offset.  The
+		 *	stream can't be found from the document locator, which the SAX2
+		 *	reader replaces with the scanner's own.
+		 */
+		void setLineCountStream( CFLibXmlCoreLineCountBinInputStream* stream );
+
 		virtual ICFLibMessageLog* getLog() const;
 		virtual void setLog( ICFLibMessageLog* jlog );
 
+		/**
+		 *	Report line numbers at or after fromLine adjustment lines later,
+		 *	for documents assembled from a fragment of a larger file.  Lines
+		 *	before fromLine, such as a prolog copied from the original file,
+		 *	are reported as they are.  An adjustment of 0 turns this off.
+		 */
+		void setLineNumberAdjustment( XMLFileLoc fromLine, int64_t adjustment );
+
+		XMLFileLoc adjustLineNumber( XMLFileLoc lineNumber ) const;
+
 		CFLibXmlCoreElementHandler* getRootElementHandler();
 
 	protected:
 		void setRootElementHandler( CFLibXmlCoreElementHandler* handler );
 
 	public:
+
+		/**
+		 *	Capture the current document position.  The document name is
+		 *	transcoded and interned once per document or external entity;
+		 *	after that no strings are built until the location is formatted.
+		 */
+		CFLibXmlCoreLocation getLocation();
+
 		std::string getLocationInfo();
 
 		CFLibXmlCoreContext* getCurContext();
@@ -127,6 +189,12 @@ namespace cflib {
 		virtual void clearElementText();
 		virtual std::string getElementText();
 
+		/**
+		 *	The transcoder shared by every context of this parser for
+		 *	appending characters() chunks to the element text.
+		 */
+		CFLibXmlCoreUtf8Transcoder& getUtf8Transcoder();
+
 	protected:
 		std::string formatMessage( const xercesc::SAXParseException& ex );
 
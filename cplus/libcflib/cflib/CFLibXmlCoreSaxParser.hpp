@@ -83,27 +83,106 @@
 
 namespace cflib {
 
+	class CFLibXmlCoreParallelParser;
+
 	class CFLibXmlCoreSaxParser	: public CFLibXmlCoreParser	{
 
 	protected:
 		xercesc::SAX2XMLReader* saxXmlReader;
 		cflib::CFLibXmlCoreLineCountMemBufInputSource* memBufInputSource;
+		bool useSharedGrammarPool;
+		int validationMode;
+		uint32_t validateFirstCount;
+		uint64_t documentsValidated;
+		bool readerValidating;
+		uint32_t documentIssueCount;
 
 	public:
 		static const std::string CLASS_NAME;
 		static const std::string S_SaxXmlReaderMustBeInitialized;
 
+		/**
+		 *	Validate every document against its schema.  The default.
+		 */
+		static const int VALIDATION_FULL;
+
+		/**
+		 *	Validate the first getValidateFirstCount() documents parsed,
+		 *	then trust the rest of the traffic and stop validating.
+		 */
+		static const int VALIDATION_FIRST_N;
+
+		/**
+		 *	Do not validate or load schemas.  Only well-formedness is checked,
+		 *	and default attribute values declared by a schema are not supplied.
+		 */
+		static const int VALIDATION_OFF;
+
+		static const uint32_t DEFAULT_VALIDATE_FIRST_COUNT;
+
 		CFLibXmlCoreSaxParser();
 		CFLibXmlCoreSaxParser( ICFLibMessageLog* jLogger );
 		virtual ~CFLibXmlCoreSaxParser();
 
 	protected:
+		/**
+		 *	Create the Xerces reader if it has not been created yet.
+		 *	Subclasses extend this to register their element handlers.
+		 *	CFLibXmlCoreParallelParser calls it to prepare its worker parsers.
+		 */
 		virtual void initParser();
 
+		friend class CFLibXmlCoreParallelParser;
+
 	public:
+		/**
+		 *	Has initParser() created the Xerces reader yet?
+		 */
+		bool isXmlReaderInitialized() const;
+
+		bool isUsingSharedGrammarPool() const;
+
+		/**
+		 *	When set, the Xerces reader is created on top of the static grammar
+		 *	pool returned by CFLibXmlCoreParser::getGrammarPool(), so grammars
+		 *	loaded once are shared read-only by every parser using the pool.
+		 *	Must be set before initParser() creates the reader.
+		 */
+		void setUseSharedGrammarPool( bool value );
+
+		int getValidationMode() const;
+
+		/**
+		 *	Select VALIDATION_FULL, VALIDATION_FIRST_N or VALIDATION_OFF.
+		 *	Takes effect with the next document parsed.
+		 */
+		void setValidationMode( int value );
+
+		uint32_t getValidateFirstCount() const;
+
+		/**
+		 *	Set the number of documents VALIDATION_FIRST_N validates before it
+		 *	stops validating.  Only documents that validate without a warning
+		 *	or error count, so invalid traffic keeps validation on.  The count
+		 *	is per parser and restarts whenever loadGrammar() is called; a
+		 *	parser is expected to be dedicated to one family of documents
+		 *	sharing a grammar.
+		 */
+		void setValidateFirstCount( uint32_t value );
+
+		/**
+		 *	The number of documents that validated without a warning or error.
+		 */
+		uint64_t getDocumentsValidated() const;
+
+		/**
+		 *	Restart the VALIDATION_FIRST_N count, for example after a grammar is replaced.
+		 */
+		void resetDocumentsValidated();
+
 
 		/**
-		 *	Load the specified XSD file.
+		 *	Load the specified XSD file and restart the VALIDATION_FIRST_N count.
 		 *
 		 *	@param	xsdFileName - The file system name of the XSD file to be loaded
 		 *
@@ -141,5 +220,27 @@ namespace cflib {
 		 *	@param	src The InputSource contents to be parsed.
 		 */
 		virtual void parse( const xercesc::InputSource& src );
+
+		/**
+		 *	Count the warnings and errors reported for the current document,
+		 *	then log them as CFLibXmlCoreParser does.
+		 */
+		virtual void warning( const xercesc::SAXParseException& ex );
+		virtual void error( const xercesc::SAXParseException& ex );
+		virtual void fatalError( const xercesc::SAXParseException& ex );
+
+	protected:
+
+		/**
+		 *	Set the reader's validation features for the next document.
+		 */
+		void applyValidationMode();
+
+		/**
+		 *	Note that a document was parsed successfully under the features
+		 *	set by the last applyValidationMode().  It counts as validated only
+		 *	if validation was on and no warning or error was reported.
+		 */
+		void countValidatedDocument();
 	};
 }
@@ -0,0 +1,81 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <xercesc/util/XMLString.hpp>
+
+namespace cflib {
+
+	/**
+	 *	The XmlCoreUtf8Transcoder appends UTF-16 character chunks delivered
+	 *	by the SAX characters() callback directly to a UTF-8 std::string.
+	 *	<p>
+	 *	Each parser owns one transcoder and reuses it for every element, so
+	 *	no intermediate C string is allocated through the Xerces memory manager
+	 *	for each chunk.  Runs of ASCII characters are copied straight through.
+	 *	A high surrogate that ends a chunk is held until the next chunk arrives.
+	 */
+	class CFLibXmlCoreUtf8Transcoder {
+
+	protected:
+		XMLCh pendingHighSurrogate;
+
+	public:
+		static const std::string CLASS_NAME;
+
+		CFLibXmlCoreUtf8Transcoder();
+		virtual ~CFLibXmlCoreUtf8Transcoder();
+
+		/**
+		 *	End the current text.  A high surrogate held from the last chunk
+		 *	never got its low half, so U+FFFD is appended to target in its place.
+		 *
+		 *	@param	target	The string the held surrogate's text was appended to.
+		 */
+		void reset( std::string& target );
+
+		/**
+		 *	Transcode length UTF-16 characters and append the UTF-8 result to target.
+		 *	<p>
+		 *	The target string grows geometrically, so repeated appends of small
+		 *	chunks to the same string cost amortized constant time per character.
+		 *	Unpaired surrogates are replaced by U+FFFD.
+		 *
+		 *	@param	target	The string to append to.
+		 *	@param	chars	The UTF-16 characters to transcode; need not be NUL-terminated.
+		 *	@param	length	The number of characters in chars.
+		 */
+		void append( std::string& target, const XMLCh* chars, XMLSize_t length );
+
+	protected:
+		static void appendCodePoint( std::string& target, uint32_t codePoint );
+	};
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <xercesc/util/XMLString.hpp>
+
+#include <cflib/CFLib.hpp>
+#include <cflib/CFLibUuid.hpp>
+#include <cflib/CFLibXmlCoreUtf8Transcoder.hpp>
+#include <cflib/TCFLibResult.hpp>
+
+namespace cflib {
+
+	/**
+	 *	A CFLibXmlRecord is the flat view of one record element produced by
+	 *	a CFLibXmlRecordReader: the element's qualified name and its attributes,
+	 *	transcoded to UTF-8.
+	 *	<p>
+	 *	The record's string buffers are reused from one record to the next,
+	 *	so references returned by the accessors are only valid until the
+	 *	reader is advanced again.
+	 */
+	class CFLibXmlRecord {
+
+	protected:
+		std::string elementName;
+		std::vector<std::string> attrNames;
+		std::vector<std::string> attrValues;
+		std::vector<std::string>::size_type attrCount;
+
+	public:
+		static const std::string CLASS_NAME;
+
+		CFLibXmlRecord();
+		virtual ~CFLibXmlRecord();
+
+		/**
+		 *	Reset the record to an unnamed element with no attributes,
+		 *	retaining the allocated buffers for reuse.
+		 */
+		void clear();
+
+		const std::string& getElementName() const;
+		void setElementName( const XMLCh* qName, CFLibXmlCoreUtf8Transcoder& transcoder );
+
+		std::vector<std::string>::size_type getAttributeCount() const;
+		const std::string& getAttributeName( std::vector<std::string>::size_type idx ) const;
+		const std::string& getAttributeValue( std::vector<std::string>::size_type idx ) const;
+
+		/**
+		 *	Find the value of the named attribute.
+		 *
+		 *	@param	name	The qualified name of the attribute.
+		 *	@returns	The attribute value, or NULL if the record has no such attribute.
+		 */
+		const std::string* findAttributeValue( const std::string& name ) const;
+
+		/**
+		 *	Find and parse the named attribute without throwing, using the
+		 *	CFLibXmlUtil::tryParse* functions.  An absent attribute is
+		 *	reported as STATUS_NULL.
+		 *
+		 *	@param	name	The qualified name of the attribute.
+		 *	@returns	The parsed value or the status describing why it could not be parsed.
+		 */
+		TCFLibResult<std::int16_t> tryGetAttributeInt16( const std::string& name ) const;
+		TCFLibResult<std::int32_t> tryGetAttributeInt32( const std::string& name ) const;
+		TCFLibResult<std::int64_t> tryGetAttributeInt64( const std::string& name ) const;
+		TCFLibResult<std::uint16_t> tryGetAttributeUInt16( const std::string& name ) const;
+		TCFLibResult<std::uint32_t> tryGetAttributeUInt32( const std::string& name ) const;
+		TCFLibResult<std::uint64_t> tryGetAttributeUInt64( const std::string& name ) const;
+		TCFLibResult<float> tryGetAttributeFloat( const std::string& name ) const;
+		TCFLibResult<double> tryGetAttributeDouble( const std::string& name ) const;
+		TCFLibResult<std::chrono::system_clock::time_point> tryGetAttributeTimestamp( const std::string& name ) const;
+		TCFLibResult<CFLibUuid> tryGetAttributeUuid( const std::string& name ) const;
+
+		void addAttribute( const XMLCh* qName, const XMLCh* value, CFLibXmlCoreUtf8Transcoder& transcoder );
+	};
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <xercesc/framework/LocalFileInputSource.hpp>
+#include <xercesc/framework/XMLPScanToken.hpp>
+#include <xercesc/sax/InputSource.hpp>
+
+#include <cflib/CFLib.hpp>
+#include <cflib/ICFLibMessageLog.hpp>
+#include <cflib/CFLibXmlCoreSaxParser.hpp>
+#include <cflib/CFLibXmlRecord.hpp>
+
+namespace cflib {
+
+	/**
+	 *	The CFLibXmlRecordReader is a pull-style alternative to registering
+	 *	element handlers with a CFLibXmlCoreSaxParser.
+	 *	<p>
+	 *	It drives the Xerces progressive parse (parseFirst/parseNext) so the
+	 *	input is only scanned as far as needed to produce the next record, and
+	 *	each call to next() yields one flat CFLibXmlRecord for the next element
+	 *	found at the record depth.  Memory use is bounded by the largest single
+	 *	record, not by the size of the document, so bulk imports can pipeline
+	 *	parse, convert and write one record at a time.
+	 *	<p>
+	 *	Element text is not collected; records carry attributes only.  The
+	 *	reader pushes no contexts, so the inherited characters() ignores text.
+	 */
+	class CFLibXmlRecordReader : public CFLibXmlCoreSaxParser {
+
+	public:
+		static const std::string CLASS_NAME;
+
+		/**
+		 *	By default the children of the document root are the records.
+		 */
+		static const int DEFAULT_RECORD_DEPTH;
+
+	protected:
+		xercesc::XMLPScanToken scanToken;
+		xercesc::InputSource* ownedInputSource;
+		bool isOpen;
+		bool atEnd;
+		bool recordReady;
+		int curDepth;
+		int recordDepth;
+		CFLibXmlRecord record;
+
+	public:
+		CFLibXmlRecordReader();
+		CFLibXmlRecordReader( ICFLibMessageLog* jLogger );
+		virtual ~CFLibXmlRecordReader();
+
+		int getRecordDepth() const;
+
+		/**
+		 *	Set the element nesting depth whose elements are returned as records.
+		 *	The document root is at depth 1.
+		 */
+		void setRecordDepth( int value );
+
+		/**
+		 *	Start reading the named file.  The file is read incrementally as
+		 *	records are requested.
+		 */
+		void open( const std::string& fileName );
+
+		/**
+		 *	Start reading the specified InputSource, which must remain valid
+		 *	until the reader is closed.
+		 */
+		void open( const xercesc::InputSource& src );
+
+		/**
+		 *	Advance to the next record.
+		 *
+		 *	@returns	true if getRecord() now holds the next record,
+		 *				false when the end of the document has been reached.
+		 */
+		bool next();
+
+		/**
+		 *	The current record.  Valid until the next call to next() or close().
+		 */
+		const CFLibXmlRecord& getRecord() const;
+
+		/**
+		 *	Stop reading and release the input.  Called automatically by
+		 *	open() and by the destructor.
+		 */
+		void close();
+
+		virtual void startElement(
+			const XMLCh* const uri,
+			const XMLCh* const localname,
+			const XMLCh* const qname,
+			const xercesc::Attributes& attrs );
+
+		virtual void endElement(
+			const XMLCh* const uri,
+			const XMLCh* const localname,
+			const XMLCh* const qname );
+
+	protected:
+		void beginParse( const xercesc::InputSource& src );
+	};
+}
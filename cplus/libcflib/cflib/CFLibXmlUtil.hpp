@@ -28,6 +28,8 @@
 
 #include <cflib/CFLib.hpp>
 #include <cflib/TCFLibBigDecimal.hpp>
+#include <cflib/TCFLibResult.hpp>
+#include <cflib/CFLibUuid.hpp>
 #include <cflib/CFLibRuntimeException.hpp>
 #include <cflib/CFLibArgumentException.hpp>
 #include <cflib/CFLibUsageException.hpp>
@@ -46,6 +48,8 @@ namespace cflib {
 		static const std::string S_EXPECTED_SIGNED_DIGITS;
 		static const std::string S_EXPECTED_DIGITS;
 		static const std::string S_EXPECTED_DECIMAL_NUMBER;
+		static const std::string S_EXPECTED_TIMESTAMP;
+		static const std::string S_EXPECTED_UUID;
 
 		static const char S_UTC[4];
 
@@ -90,6 +94,38 @@ namespace cflib {
 		static std::chrono::system_clock::time_point* parseTZTimestamp( const std::string& fieldName, const std::string& value );
 		static void parseUuid( uuid_ptr_t target, const std::string& value );
 		static void parseUuid( uuid_ptr_t target, const std::string& fieldName, const std::string& value );
+		static void parseUuid( CFLibUuid& target, const std::string& value );
+		static void parseUuid( CFLibUuid& target, const std::string& fieldName, const std::string& value );
+
+		/**
+		 *	tryParse methods are like parse methods, except they report bad
+		 *	content through the returned result instead of throwing, and empty
+		 *	content as a STATUS_NULL result.  Integers that do not fit the
+		 *	target type are reported as overflows or underflows rather than
+		 *	being truncated.  Values that parse yield the same value as the
+		 *	parse method; in particular tryParseTimestamp() converts with
+		 *	mktime() just as parseTimestamp() does.
+		**/
+		static TCFLibResult<std::int16_t> tryParseInt16( const std::string& value );
+		static TCFLibResult<std::int16_t> tryParseInt16( const std::string& fieldName, const std::string& value );
+		static TCFLibResult<std::int32_t> tryParseInt32( const std::string& value );
+		static TCFLibResult<std::int32_t> tryParseInt32( const std::string& fieldName, const std::string& value );
+		static TCFLibResult<std::int64_t> tryParseInt64( const std::string& value );
+		static TCFLibResult<std::int64_t> tryParseInt64( const std::string& fieldName, const std::string& value );
+		static TCFLibResult<std::uint16_t> tryParseUInt16( const std::string& value );
+		static TCFLibResult<std::uint16_t> tryParseUInt16( const std::string& fieldName, const std::string& value );
+		static TCFLibResult<std::uint32_t> tryParseUInt32( const std::string& value );
+		static TCFLibResult<std::uint32_t> tryParseUInt32( const std::string& fieldName, const std::string& value );
+		static TCFLibResult<std::uint64_t> tryParseUInt64( const std::string& value );
+		static TCFLibResult<std::uint64_t> tryParseUInt64( const std::string& fieldName, const std::string& value );
+		static TCFLibResult<float> tryParseFloat( const std::string& value );
+		static TCFLibResult<float> tryParseFloat( const std::string& fieldName, const std::string& value );
+		static TCFLibResult<double> tryParseDouble( const std::string& value );
+		static TCFLibResult<double> tryParseDouble( const std::string& fieldName, const std::string& value );
+		static TCFLibResult<std::chrono::system_clock::time_point> tryParseTimestamp( const std::string& value );
+		static TCFLibResult<std::chrono::system_clock::time_point> tryParseTimestamp( const std::string& fieldName, const std::string& value );
+		static TCFLibResult<CFLibUuid> tryParseUuid( const std::string& value );
+		static TCFLibResult<CFLibUuid> tryParseUuid( const std::string& fieldName, const std::string& value );
 
 		// eval methods are like parse methods, except they throw exceptions if there is no content in value instead of returning NULL
 		static std::vector<BYTE> evalBlob( const std::string& value );
@@ -147,6 +183,7 @@ namespace cflib {
 		static std::string formatTZTime( const std::chrono::system_clock::time_point& cal );
 		static std::string formatTZTimestamp( const std::chrono::system_clock::time_point& cal );
 		static std::string formatUuid( const uuid_ptr_t val );
+		static std::string formatUuid( const CFLibUuid& val );
 
 		/**
 		 *	Formatting for Required XML attributes.
@@ -189,6 +226,7 @@ namespace cflib {
 		static std::string formatRequiredTZTimestamp( const std::string* separator, const std::string& attrName, const std::chrono::system_clock::time_point& cal );
 
 		static std::string formatRequiredUuid( const std::string* separator, const std::string& attrName, const uuid_ptr_t val );
+		static std::string formatRequiredUuid( const std::string* separator, const std::string& attrName, const CFLibUuid& val );
 
 		/**
 		 *	Formatting for Optional XML attributes.
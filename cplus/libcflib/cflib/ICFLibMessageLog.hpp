@@ -30,8 +30,10 @@
 #include <mpfr.h>
 
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <chrono>
 #include <ctime>
 #include <list>
@@ -49,14 +51,68 @@ namespace cflib {
 	 *	messages.
 	 *	<p>
 	 *	All methods of the interface are expected to be synchronized.
+	 *	<p>
+	 *	Messages may be tagged with a severity level and a category.  Callers
+	 *	producing diagnostics that are expensive to format should test
+	 *	isEnabled() first, or use the CFLIB_LOG macro, so that a disabled
+	 *	message costs one branch and is never formatted.
 	 */
 	class ICFLibMessageLog {
-	
+
+	public:
+		static const int LEVEL_TRACE;
+		static const int LEVEL_DEBUG;
+		static const int LEVEL_INFO;
+		static const int LEVEL_WARN;
+		static const int LEVEL_ERROR;
+		static const int LEVEL_FATAL;
+
+		static const uint32_t CATEGORY_GENERAL;
+		static const uint32_t CATEGORY_XML;
+		static const uint32_t CATEGORY_EXCEPTION;
+		static const uint32_t CATEGORY_DB;
+		static const uint32_t CATEGORY_ALL;
+
+	protected:
+		std::atomic<int> minimumLevel;
+		std::atomic<uint32_t> enabledCategories;
+
 	public:
 
 		ICFLibMessageLog();
+
+		/**
+		 *	Copy the level and category settings; std::atomic members would
+		 *	otherwise make every log implementation non-copyable.
+		 */
+		ICFLibMessageLog( const ICFLibMessageLog& src );
 		virtual ~ICFLibMessageLog();
 
+		ICFLibMessageLog& operator=( const ICFLibMessageLog& src );
+
+		/**
+		 *	Will a message of the given level and category be logged?
+		 *	By default messages at LEVEL_INFO and above in every category are.
+		 */
+		inline bool isEnabled( int level, uint32_t category ) const {
+			return( ( level >= minimumLevel.load( std::memory_order_relaxed ) )
+				&& ( ( category & enabledCategories.load( std::memory_order_relaxed ) ) != 0 ) );
+		}
+
+		int getMinimumLevel() const;
+
+		/**
+		 *	Set the lowest level of message that is logged.
+		 */
+		void setMinimumLevel( int level );
+
+		uint32_t getEnabledCategories() const;
+
+		/**
+		 *	Set the mask of categories that are logged.
+		 */
+		void setEnabledCategories( uint32_t categories );
+
 		/**
 		 *	Get the current log indent level.
 		 */
@@ -77,6 +133,30 @@ namespace cflib {
 		 */
 		virtual void message( const std::string& msg ) = 0;
 
+		/**
+		 *	Log a message with a severity level and category.
+		 *	<p>
+		 *	The default drops the message unless isEnabled(), and otherwise
+		 *	passes it to message( msg ).
+		 *	<p>
+		 *	An implementation that overrides message( msg ) hides this overload
+		 *	from callers holding a pointer to the derived class, so it must
+		 *	declare <code>using ICFLibMessageLog::message;</code> as the
+		 *	implementations in this library do.
+		 */
+		virtual void message( int level, uint32_t category, const std::string& msg );
+
+		/**
+		 *	Log a message formatted by a callable, which is only invoked if the
+		 *	level and category are enabled.
+		 */
+		template<typename Formatter>
+		inline void messageIf( int level, uint32_t category, Formatter formatter ) {
+			if( isEnabled( level, category ) ) {
+				message( level, category, formatter() );
+			}
+		}
+
 		/**
 		 *	Open the specified file for logging
 		 *
@@ -90,3 +170,15 @@ namespace cflib {
 		virtual void closeLogFile() = 0;
 	};
 }
+
+/**
+ *	Log a message if log is not NULL and the level and category are enabled.
+ *	The message expression is only evaluated when the message will be logged.
+ */
+#define CFLIB_LOG( log, level, category, msgExpr ) \
+	do { \
+		cflib::ICFLibMessageLog* cflibLogTarget = ( log ); \
+		if( ( cflibLogTarget != NULL ) && cflibLogTarget->isEnabled( ( level ), ( category ) ) ) { \
+			cflibLogTarget->message( ( level ), ( category ), ( msgExpr ) ); \
+		} \
+	} while( 0 )
@@ -49,18 +49,30 @@
 #include <cflib/ICFLibAnyObj.hpp>
 #include <cflib/ICFLibMessageLog.hpp>
 #include <cflib/ICFLibXmlCoreContextFactory.hpp>
+#include <cflib/ICFLibXmlCoreSaxParserFactory.hpp>
 
 #include <cflib/CFLib.hpp>
+#include <cflib/CFLibHash.hpp>
+#include <cflib/CFLibUuid.hpp>
+#include <cflib/TCFLibUuidHashMap.hpp>
 
 #include <cflib/CFLibDbUtil.hpp>
 #include <cflib/CFLibConsoleMessageLog.hpp>
 #include <cflib/CFLibCachedMessageLog.hpp>
+#include <cflib/CFLibAsyncFileMessageLog.hpp>
+#include <cflib/CFLibRingBufferMessageLog.hpp>
+#include <cflib/CFLibBinaryMessageLog.hpp>
+#include <cflib/CFLibStatus.hpp>
+#include <cflib/TCFLibResult.hpp>
 #include <cflib/CFLibGenericBigDecimal.hpp>
 #include <cflib/TCFLibBigDecimal.hpp>
+#include <cflib/CFLibWorkerPool.hpp>
 #include <cflib/TCFLibOwningVector.hpp>
 #include <cflib/TCFLibOwningList.hpp>
+#include <cflib/TCFLibArenaVector.hpp>
 
 #include <cflib/CFLibNullable.hpp>
+#include <cflib/TCFLibNullable.hpp>
 #include <cflib/CFLibNullableBool.hpp>
 #include <cflib/CFLibNullableInt16.hpp>
 #include <cflib/CFLibNullableInt32.hpp>
@@ -70,6 +82,7 @@
 #include <cflib/CFLibNullableUInt64.hpp>
 #include <cflib/CFLibNullableFloat.hpp>
 #include <cflib/CFLibNullableDouble.hpp>
+#include <cflib/TCFLibNullableColumn.hpp>
 
 #include <cflib/CFLibExceptionInfo.hpp>
 #include <cflib/CFLibRuntimeException.hpp>
@@ -108,7 +121,14 @@
 #include <cflib/CFLibXmlCoreElementHandler.hpp>
 #include <cflib/CFLibXmlCoreIso8859Encoder.hpp>
 #include <cflib/CFLibXmlCoreParser.hpp>
+#include <cflib/CFLibXmlCoreUtf8Transcoder.hpp>
+#include <cflib/CFLibXmlCoreLocation.hpp>
 #include <cflib/CFLibXmlCoreSaxParser.hpp>
+#include <cflib/CFLibXmlRecord.hpp>
+#include <cflib/CFLibXmlRecordReader.hpp>
+#include <cflib/CFLibXmlCoreParseResult.hpp>
+#include <cflib/CFLibXmlCoreParallelParser.hpp>
+#include <cflib/CFLibXmlCoreChunkedParser.hpp>
 #include <cflib/CFLibXmlUtil.hpp>
 
 #include <cflib/CFLibExceptionMacros.hpp>
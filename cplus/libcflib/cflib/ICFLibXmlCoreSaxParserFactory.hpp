@@ -1,3 +1,5 @@
+#pragma once
+
 /*
  *  MSS Code Factory CFLib 2.13
  *
@@ -24,52 +26,40 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
 #include <cflib/CFLib.hpp>
-#include <cflib/CFLibNullableDouble.hpp>
-#include <cflib/CFLibNullArgumentException.hpp>
+#include <cflib/ICFLibMessageLog.hpp>
 
 namespace cflib {
 
-const std::string CFLibNullableDouble::CLASS_NAME( "CFLibNullableDouble" );;
+	class CFLibXmlCoreSaxParser;
 
-CFLibNullableDouble::CFLibNullableDouble() {
-	value = 0;
-}
+	/**
+	 *	Factory used by CFLibXmlCoreParallelParser to create the parser each
+	 *	worker thread owns.  newXmlCoreSaxParser() is only ever invoked from the
+	 *	thread that calls CFLibXmlCoreParallelParser::run(), so implementations
+	 *	need not be thread safe.
+	 */
+	class ICFLibXmlCoreSaxParserFactory {
 
-CFLibNullableDouble::CFLibNullableDouble( const double arg ) {
-	setNullFlag( false );
-	value = arg;
-}
+	public:
+		ICFLibXmlCoreSaxParserFactory() {
+		}
 
-CFLibNullableDouble::~CFLibNullableDouble() {
-}
-
-const double CFLibNullableDouble::getValue() const {
-	if( nullFlag ) {
-		throw CFLibNullArgumentException( CLASS_NAME,
-			S_GET_VALUE,
-			0,
-			S_VALUE );
-	}
-	return( value );
-}
-
-const double* CFLibNullableDouble::getReference() const {
-	if( nullFlag ) {
-		return( NULL );
-	}
-	else {
-		return( &value );
-	}
-}
-
-void CFLibNullableDouble::setValue( const double arg ) {
-	setNullFlag( false );
-	value = arg;
-}
-
-void CFLibNullableDouble::setNull() {
-	setNullFlag( true );
-}
+		virtual ~ICFLibXmlCoreSaxParserFactory() {
+		}
 
+		/**
+		 *	Create a new parser.  The caller takes ownership of the instance.
+		 *	If the parser's Xerces reader has not been created yet, the caller
+		 *	will select the shared grammar pool and invoke initParser() itself.
+		 *
+		 *	@param	jLogger	The initial log for the parser.
+		 */
+		virtual CFLibXmlCoreSaxParser* newXmlCoreSaxParser( ICFLibMessageLog* jLogger ) const = 0;
+	};
 }
@@ -0,0 +1,263 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cflib/CFLib.hpp>
+
+namespace cflib {
+
+	/**
+	 *	An owning vector of EltClass objects that are constructed in place in
+	 *	large chunks of memory owned by the container, rather than each being
+	 *	allocated with new and deleted on its own as with TCFLibOwningVector.
+	 *	Building a result set of n elements makes about n * sizeof( element )
+	 *	/ chunkSize allocations, destroying it runs each element's destructor
+	 *	and then frees the chunks, and moving it is O(1).
+	 *	<p>
+	 *	EltClass is the element class itself, not a pointer to it.  Elements
+	 *	may be of any class derived from EltClass, which must then have a
+	 *	virtual destructor.  Entries may also be NULL.  Because the container
+	 *	does not know the size of each element's class, it cannot be copied;
+	 *	clone the elements into another container if a copy is needed.
+	 *	<p>
+	 *	Element pointers stay valid until the container is cleared or
+	 *	destroyed, and are carried over by a move.
+	 */
+	template< class EltClass > class TCFLibArenaVector {
+
+	public:
+		static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+		typedef typename std::vector<EltClass*>::const_iterator const_iterator;
+
+	protected:
+
+		/**
+		 *	The header at the start of each chunk of element storage.
+		 */
+		class Chunk {
+		public:
+			Chunk* next;
+			size_t size;
+			size_t used;
+		};
+
+		std::vector<EltClass*> elements;
+
+		/**
+		 *	The chunk currently being filled, which links to the older ones.
+		 */
+		Chunk* chunks;
+
+		size_t chunkSize;
+
+		static inline size_t alignUp( size_t offset, size_t alignment ) {
+			return( ( offset + alignment - 1 ) & ~( alignment - 1 ) );
+		}
+
+		/**
+		 *	Reserve size bytes aligned to alignment in the current chunk,
+		 *	starting a new chunk if it does not fit.  Elements larger than
+		 *	the chunk size get a chunk of their own.
+		 */
+		void* allocate( size_t size, size_t alignment ) {
+			if( chunks != NULL ) {
+				size_t offset = alignUp( chunks->used, alignment );
+				if( offset + size <= chunks->size ) {
+					chunks->used = offset + size;
+					return( reinterpret_cast<unsigned char*>( chunks ) + offset );
+				}
+			}
+			size_t offset = alignUp( sizeof( Chunk ), alignment );
+			size_t neededSize = offset + size;
+			size_t newSize = ( neededSize > chunkSize ) ? neededSize : chunkSize;
+			Chunk* chunk = static_cast<Chunk*>( ::operator new( newSize ) );
+			chunk->size = newSize;
+			chunk->used = offset + size;
+			if( ( chunks == NULL ) || ( newSize == chunkSize ) ) {
+				chunk->next = chunks;
+				chunks = chunk;
+			}
+			else {
+				// Keep filling the current chunk after an oversized element
+				chunk->next = chunks->next;
+				chunks->next = chunk;
+			}
+			return( reinterpret_cast<unsigned char*>( chunk ) + offset );
+		}
+
+		void releaseChunks() {
+			while( chunks != NULL ) {
+				Chunk* next = chunks->next;
+				::operator delete( chunks );
+				chunks = next;
+			}
+		}
+
+	public:
+
+		TCFLibArenaVector( size_t argChunkSize = DEFAULT_CHUNK_SIZE )
+		: elements(),
+		  chunks( NULL ),
+		  chunkSize( argChunkSize )
+		{
+		}
+
+		TCFLibArenaVector( const TCFLibArenaVector<EltClass>& src ) = delete;
+
+		TCFLibArenaVector( TCFLibArenaVector<EltClass>&& src ) noexcept
+		: elements( std::move( src.elements ) ),
+		  chunks( src.chunks ),
+		  chunkSize( src.chunkSize )
+		{
+			src.elements.clear();
+			src.chunks = NULL;
+		}
+
+		~TCFLibArenaVector() {
+			clear();
+		}
+
+		TCFLibArenaVector<EltClass>& operator =( const TCFLibArenaVector<EltClass>& src ) = delete;
+
+		TCFLibArenaVector<EltClass>& operator =( TCFLibArenaVector<EltClass>&& src ) noexcept {
+			if( this != &src ) {
+				clear();
+				elements = std::move( src.elements );
+				chunks = src.chunks;
+				chunkSize = src.chunkSize;
+				src.elements.clear();
+				src.chunks = NULL;
+			}
+			return( *this );
+		}
+
+		/**
+		 *	Construct a new DerivedClass element at the end of the vector.
+		 *	If the constructor throws, the vector is left as it was.
+		 *
+		 *	@returns	The new element.
+		 */
+		template< class DerivedClass = EltClass, class... Args > DerivedClass* emplace_back( Args&&... args ) {
+			static_assert( std::is_base_of<EltClass, DerivedClass>::value,
+				"TCFLibArenaVector elements must derive from the element class" );
+			static_assert( std::is_same<EltClass, DerivedClass>::value || std::has_virtual_destructor<EltClass>::value,
+				"TCFLibArenaVector elements of derived classes need a virtual destructor" );
+			static_assert( alignof( DerivedClass ) <= alignof( std::max_align_t ),
+				"TCFLibArenaVector chunks are only aligned for std::max_align_t" );
+			elements.push_back( NULL );
+			Chunk* oldChunks = chunks;
+			size_t oldUsed = ( chunks != NULL ) ? chunks->used : 0;
+			DerivedClass* elt;
+			try {
+				elt = new( allocate( sizeof( DerivedClass ), alignof( DerivedClass ) ) ) DerivedClass( std::forward<Args>( args )... );
+			}
+			catch( ... ) {
+				// Give the space back if the element went into the current chunk
+				if( ( oldChunks != NULL ) && ( chunks == oldChunks ) ) {
+					chunks->used = oldUsed;
+				}
+				elements.pop_back();
+				throw;
+			}
+			elements.back() = elt;
+			return( elt );
+		}
+
+		/**
+		 *	Append a NULL entry.
+		 */
+		inline void push_back_null() {
+			elements.push_back( NULL );
+		}
+
+		/**
+		 *	Destroy every element and free the element storage.
+		 */
+		void clear() noexcept {
+			if( ! std::is_trivially_destructible<EltClass>::value ) {
+				for( EltClass* elt : elements ) {
+					if( elt != NULL ) {
+						elt->~EltClass();
+					}
+				}
+			}
+			elements.clear();
+			releaseChunks();
+		}
+
+		/**
+		 *	Reserve room for count element pointers.  Element storage is
+		 *	still allocated a chunk at a time.
+		 */
+		inline void reserve( size_t count ) {
+			elements.reserve( count );
+		}
+
+		inline size_t size() const {
+			return( elements.size() );
+		}
+
+		inline bool empty() const {
+			return( elements.empty() );
+		}
+
+		inline EltClass* operator []( size_t idx ) const {
+			return( elements[idx] );
+		}
+
+		inline EltClass* at( size_t idx ) const {
+			return( elements.at( idx ) );
+		}
+
+		inline EltClass* back() const {
+			return( elements.back() );
+		}
+
+		inline const_iterator begin() const {
+			return( elements.begin() );
+		}
+
+		inline const_iterator end() const {
+			return( elements.end() );
+		}
+
+		/**
+		 *	@returns	The element pointers, which are contiguous.
+		 */
+		inline EltClass* const* data() const {
+			return( elements.data() );
+		}
+	};
+}
@@ -36,6 +36,7 @@
 #include <cflib/CFLibMathException.hpp>
 #include <cflib/CFLibNotImplementedYetException.hpp>
 #include <cflib/CFLibNullArgumentException.hpp>
+#include <cflib/CFLibStatus.hpp>
 #include <cflib/CFLibSubroutineException.hpp>
 
 namespace cflib {
@@ -743,6 +744,61 @@ public:
 			mpfr_clear( rawValue );
 		}
 
+		/**
+		 *	Non-throwing form of setValue( const std::string& ) for parsing
+		 *	loops that expect some bad input.  The value is left unchanged
+		 *	unless the returned status is STATUS_OK.
+		 *
+		 *	@param	src	The signed decimal fraction number string to parse.
+		 *	@returns	STATUS_NULL for an empty string, STATUS_INVALID_ARGUMENT if
+		 *		src is not a number, STATUS_OVERFLOW or STATUS_UNDERFLOW if
+		 *		src exceeds the digits and precision.
+		 */
+		CFLibStatus trySetValue( const std::string& src )
+		{
+			static const std::string S_ProcName("trySetValue");
+			if( src.length() <= 0 ) {
+				return( CFLibStatus( CFLibStatus::STATUS_NULL,
+					CLASSNAME_TCFLIBBIGDECIMAL,
+					S_ProcName,
+					1,
+					S_Src,
+					src,
+					S_MpfrSetStrFailure ) );
+			}
+			mpfr_t rawValue;
+			mpfr_init2( rawValue, ( src.length() + 1 ) * 4 );
+			int substatus = mpfr_set_str( rawValue, src.c_str(), 10, MPFR_RNDN );
+			int statusCode = CFLibStatus::STATUS_OK;
+			const std::string* detail = &S_MpfrSetStrFailure;
+			if( substatus != 0 ) {
+				statusCode = CFLibStatus::STATUS_INVALID_ARGUMENT;
+			}
+			else if( 0 > mpfr_cmp( rawValue, getAbsoluteMinValue() ) ) {
+				statusCode = CFLibStatus::STATUS_UNDERFLOW;
+				detail = &S_BelowAbsoluteMinValue;
+			}
+			else if( 0 < mpfr_cmp( rawValue, getAbsoluteMaxValue() ) ) {
+				statusCode = CFLibStatus::STATUS_OVERFLOW;
+				detail = &S_AboveAbsoluteMaxValue;
+			}
+			else {
+				mpfr_set( val, rawValue, MPFR_RNDN );
+				cflib::CFLibGenericBigDecimal::precisionRounding( val, precis );
+			}
+			mpfr_clear( rawValue );
+			if( statusCode == CFLibStatus::STATUS_OK ) {
+				return( CFLibStatus() );
+			}
+			return( CFLibStatus( statusCode,
+				CLASSNAME_TCFLIBBIGDECIMAL,
+				S_ProcName,
+				1,
+				S_Src,
+				src,
+				*detail ) );
+		}
+
 		/**
 		 *	Assignment operators for various mpfr_t, mpfr_srcptr,
 		 *	unsigned long int, long int, double,
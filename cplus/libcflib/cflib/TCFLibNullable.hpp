@@ -0,0 +1,194 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <cflib/CFLibNullable.hpp>
+
+namespace cflib {
+
+	/**
+	 *	The storage of a TCFLibNullable: the value and a separate null flag.
+	 */
+	template< class T, bool NaNIsNull > class TCFLibNullableStorage {
+
+	protected:
+		T value;
+		bool nullFlag;
+
+		constexpr TCFLibNullableStorage()
+		: value(),
+		  nullFlag( true )
+		{
+		}
+
+		constexpr TCFLibNullableStorage( const T arg )
+		: value( arg ),
+		  nullFlag( false )
+		{
+		}
+
+		constexpr void store( const T arg ) {
+			value = arg;
+			nullFlag = false;
+		}
+
+		constexpr void storeNull() {
+			nullFlag = true;
+		}
+
+	public:
+		constexpr bool isNull() const {
+			return( nullFlag );
+		}
+	};
+
+	/**
+	 *	The storage of a floating point TCFLibNullable that represents null
+	 *	as a quiet NaN instead of a flag, so it is no bigger than T.  Setting
+	 *	a NaN value therefore makes it null.
+	 */
+	template< class T > class TCFLibNullableStorage<T, true> {
+
+		static_assert( std::numeric_limits<T>::has_quiet_NaN, "NaN null packing needs a floating point type" );
+
+	protected:
+		T value;
+
+		constexpr TCFLibNullableStorage()
+		: value( std::numeric_limits<T>::quiet_NaN() )
+		{
+		}
+
+		constexpr TCFLibNullableStorage( const T arg )
+		: value( arg )
+		{
+		}
+
+		constexpr void store( const T arg ) {
+			value = arg;
+		}
+
+		constexpr void storeNull() {
+			value = std::numeric_limits<T>::quiet_NaN();
+		}
+
+	public:
+		constexpr bool isNull() const {
+			return( value != value );
+		}
+	};
+
+	/**
+	 *	A T value that may be null.  All accessors are constexpr and inline,
+	 *	and the class is trivially copyable, so it can be copied with memcpy
+	 *	and kept in arrays like the plain value.
+	 *	<p>
+	 *	With NaNIsNull a floating point value uses NaN as its null and has
+	 *	no separate flag.  The CFLibNullableBool ... CFLibNullableDouble
+	 *	classes derive from the flagged instantiations, so a stored NaN
+	 *	stays a non-null value for them as it always has.
+	 *	<p>
+	 *	CFLibPackedNullableFloat and CFLibPackedNullableDouble are typedefs,
+	 *	so unlike the CFLibNullable* classes they cannot be forward declared
+	 *	with "class CFLibPackedNullableDouble;"; include this header instead.
+	 */
+	template< class T, bool NaNIsNull = false > class TCFLibNullable
+	: public CFLibNullable,
+	  public TCFLibNullableStorage<T, NaNIsNull>
+	{
+
+	public:
+		static const std::string CLASS_NAME;
+
+		/**
+		 *	Construct a null value.
+		 */
+		constexpr TCFLibNullable()
+		: CFLibNullable(),
+		  TCFLibNullableStorage<T, NaNIsNull>()
+		{
+		}
+
+		constexpr TCFLibNullable( const T arg )
+		: CFLibNullable(),
+		  TCFLibNullableStorage<T, NaNIsNull>( arg )
+		{
+		}
+
+		/**
+		 *	@returns	The value, throwing a CFLibNullArgumentException if it
+		 *		is null.
+		 */
+		constexpr const T getValue() const {
+			if( this->isNull() ) {
+				throwNullValue( CLASS_NAME );
+			}
+			return( this->value );
+		}
+
+		/**
+		 *	@returns	A pointer to the value, or NULL if it is null.
+		 */
+		constexpr const T* getReference() const {
+			return( this->isNull() ? NULL : &this->value );
+		}
+
+		constexpr void setValue( const T arg ) {
+			this->store( arg );
+		}
+
+		constexpr void setNull() {
+			this->storeNull();
+		}
+	};
+
+	template< class T, bool NaNIsNull > const std::string TCFLibNullable<T, NaNIsNull>::CLASS_NAME( "TCFLibNullable" );
+
+	// The historical class names, defined in CFLibNullable.cpp
+	template<> const std::string TCFLibNullable<bool>::CLASS_NAME;
+	template<> const std::string TCFLibNullable<int16_t>::CLASS_NAME;
+	template<> const std::string TCFLibNullable<int32_t>::CLASS_NAME;
+	template<> const std::string TCFLibNullable<int64_t>::CLASS_NAME;
+	template<> const std::string TCFLibNullable<uint16_t>::CLASS_NAME;
+	template<> const std::string TCFLibNullable<uint32_t>::CLASS_NAME;
+	template<> const std::string TCFLibNullable<uint64_t>::CLASS_NAME;
+	template<> const std::string TCFLibNullable<float>::CLASS_NAME;
+	template<> const std::string TCFLibNullable<double>::CLASS_NAME;
+	template<> const std::string TCFLibNullable<float, true>::CLASS_NAME;
+	template<> const std::string TCFLibNullable<double, true>::CLASS_NAME;
+
+	typedef TCFLibNullable<float, true> CFLibPackedNullableFloat;
+	typedef TCFLibNullable<double, true> CFLibPackedNullableDouble;
+
+	static_assert( std::is_trivially_copyable< TCFLibNullable<int32_t> >::value, "TCFLibNullable must be trivially copyable" );
+	static_assert( sizeof( CFLibPackedNullableDouble ) == sizeof( double ), "NaN packed nullables must carry no flag" );
+}
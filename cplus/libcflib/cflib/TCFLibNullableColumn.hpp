@@ -0,0 +1,388 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cflib/CFLib.hpp>
+#include <cflib/CFLibNullArgumentException.hpp>
+
+namespace cflib {
+
+	/**
+	 *	A column of nullable T values, stored as a contiguous array of values
+	 *	plus a bitmap with one bit per row that is set for non-null rows.  A
+	 *	column of int32_t takes 4 1/8 bytes per row where a vector of
+	 *	CFLibNullableInt32 takes 8, and scans touch only the values and the
+	 *	bitmap words.
+	 *	<p>
+	 *	Null rows hold T(), so sums can add every value without consulting
+	 *	the bitmap, and the aggregate loops are written without branches so
+	 *	the compiler can vectorize them.
+	 *	<p>
+	 *	A bool column stores its values as uint8_t 0 or 1, since
+	 *	std::vector<bool> packs its bits and has no data() to scan, so for
+	 *	bool getReference() and data() return pointers to uint8_t.
+	 *	<p>
+	 *	Row indexes are not range checked, as with std::vector::operator[].
+	 */
+	template< class T > class TCFLibNullableColumn {
+
+		static_assert( std::is_arithmetic<T>::value, "TCFLibNullableColumn values must be arithmetic" );
+
+	public:
+		static const std::string CLASS_NAME;
+
+		/**
+		 *	Integer columns are summed as 64-bit integers of the same
+		 *	signedness, floating point columns as double.
+		 */
+		typedef typename std::conditional< std::is_floating_point<T>::value,
+			double,
+			typename std::conditional< std::is_signed<T>::value, int64_t, uint64_t >::type >::type SumType;
+
+		/**
+		 *	The type each value is stored as: T itself, except uint8_t for bool.
+		 */
+		typedef typename std::conditional< std::is_same<T, bool>::value, uint8_t, T >::type StorageType;
+
+	protected:
+		static constexpr size_t BITS_PER_WORD = 64;
+
+		std::vector<StorageType> values;
+
+		/**
+		 *	One bit per row, set when the row is not null.  Bits past the
+		 *	last row are always clear.
+		 */
+		std::vector<uint64_t> present;
+
+		static inline size_t popCount( uint64_t word ) {
+#if defined(__GNUC__)
+			return( (size_t)__builtin_popcountll( word ) );
+#else
+			size_t count = 0;
+			while( word != 0 ) {
+				word &= word - 1;
+				count ++;
+			}
+			return( count );
+#endif
+		}
+
+		inline void growBitmap( size_t rowCount ) {
+			present.resize( ( rowCount + BITS_PER_WORD - 1 ) / BITS_PER_WORD, 0 );
+		}
+
+		/**
+		 *	Fold the non-null values with pick( best, candidate ), which
+		 *	returns the one to keep.  Fully populated words use a plain loop
+		 *	over the values, others select with the row's bit.
+		 */
+		template< class Pick > bool fold( T& target, Pick pick ) const {
+			size_t rowCount = values.size();
+			size_t firstRow = rowCount;
+			for( size_t word = 0; word < present.size(); word ++ ) {
+				if( present[word] != 0 ) {
+					firstRow = ( word * BITS_PER_WORD ) + countTrailingZeros( present[word] );
+					break;
+				}
+			}
+			if( firstRow >= rowCount ) {
+				return( false );
+			}
+			T best = (T)values[firstRow];
+			const StorageType* data = values.data();
+			for( size_t word = firstRow / BITS_PER_WORD; word < present.size(); word ++ ) {
+				uint64_t bits = present[word];
+				size_t base = word * BITS_PER_WORD;
+				size_t limit = ( base + BITS_PER_WORD < rowCount ) ? BITS_PER_WORD : rowCount - base;
+				if( bits == ~(uint64_t)0 ) {
+					for( size_t i = 0; i < limit; i++ ) {
+						best = pick( best, (T)data[base + i] );
+					}
+				}
+				else if( bits != 0 ) {
+					for( size_t i = 0; i < limit; i++ ) {
+						T candidate = ( ( bits >> i ) & 1 ) ? (T)data[base + i] : best;
+						best = pick( best, candidate );
+					}
+				}
+			}
+			target = best;
+			return( true );
+		}
+
+		static inline size_t countTrailingZeros( uint64_t word ) {
+#if defined(__GNUC__)
+			return( (size_t)__builtin_ctzll( word ) );
+#else
+			size_t count = 0;
+			while( ( word & 1 ) == 0 ) {
+				word >>= 1;
+				count ++;
+			}
+			return( count );
+#endif
+		}
+
+	public:
+
+		TCFLibNullableColumn()
+		: values(),
+		  present()
+		{
+		}
+
+		/**
+		 *	Construct a column of rowCount null rows.
+		 */
+		TCFLibNullableColumn( size_t rowCount )
+		: values( rowCount, StorageType() ),
+		  present( ( rowCount + BITS_PER_WORD - 1 ) / BITS_PER_WORD, 0 )
+		{
+		}
+
+		inline size_t size() const {
+			return( values.size() );
+		}
+
+		inline bool empty() const {
+			return( values.empty() );
+		}
+
+		void reserve( size_t rowCount ) {
+			values.reserve( rowCount );
+			present.reserve( ( rowCount + BITS_PER_WORD - 1 ) / BITS_PER_WORD );
+		}
+
+		void clear() {
+			values.clear();
+			present.clear();
+		}
+
+		/**
+		 *	Grow or shrink the column to rowCount rows, with new rows null.
+		 */
+		void resize( size_t rowCount ) {
+			size_t oldCount = values.size();
+			values.resize( rowCount, StorageType() );
+			growBitmap( rowCount );
+			if( ( rowCount < oldCount ) && ( ( rowCount % BITS_PER_WORD ) != 0 ) ) {
+				present.back() &= ( (uint64_t)1 << ( rowCount % BITS_PER_WORD ) ) - 1;
+			}
+		}
+
+		inline bool isNull( size_t row ) const {
+			return( ( ( present[row / BITS_PER_WORD] >> ( row % BITS_PER_WORD ) ) & 1 ) == 0 );
+		}
+
+		/**
+		 *	@returns	The value of row, throwing a CFLibNullArgumentException
+		 *		if it is null.
+		 */
+		const T getValue( size_t row ) const {
+			static const std::string S_ProcName( "getValue" );
+			static const std::string S_Value( "value" );
+			if( isNull( row ) ) {
+				throw CFLibNullArgumentException( CLASS_NAME,
+					S_ProcName,
+					0,
+					S_Value );
+			}
+			return( (T)values[row] );
+		}
+
+		/**
+		 *	@returns	A pointer to the value of row, or NULL if it is null.
+		 */
+		inline const StorageType* getReference( size_t row ) const {
+			return( isNull( row ) ? NULL : &values[row] );
+		}
+
+		inline void setValue( size_t row, const T arg ) {
+			values[row] = arg;
+			present[row / BITS_PER_WORD] |= (uint64_t)1 << ( row % BITS_PER_WORD );
+		}
+
+		inline void setNull( size_t row ) {
+			values[row] = StorageType();
+			present[row / BITS_PER_WORD] &= ~( (uint64_t)1 << ( row % BITS_PER_WORD ) );
+		}
+
+		inline void push_back( const T arg ) {
+			size_t row = values.size();
+			values.push_back( arg );
+			if( ( row % BITS_PER_WORD ) == 0 ) {
+				present.push_back( 0 );
+			}
+			present.back() |= (uint64_t)1 << ( row % BITS_PER_WORD );
+		}
+
+		/**
+		 *	Append *arg, or a null row if arg is NULL, as returned by the
+		 *	getReference() of the CFLibNullable classes.
+		 */
+		inline void pushReference( const T* arg ) {
+			if( arg != NULL ) {
+				push_back( *arg );
+			}
+			else {
+				push_back_null();
+			}
+		}
+
+		inline void push_back_null() {
+			size_t row = values.size();
+			values.push_back( StorageType() );
+			if( ( row % BITS_PER_WORD ) == 0 ) {
+				present.push_back( 0 );
+			}
+		}
+
+		/**
+		 *	Append count non-null rows copied from src.
+		 */
+		void append( const T* src, size_t count ) {
+			size_t row = values.size();
+			values.insert( values.end(), src, src + count );
+			growBitmap( row + count );
+			// Set the bits a word at a time once row is word aligned
+			size_t end = row + count;
+			while( ( row < end ) && ( ( row % BITS_PER_WORD ) != 0 ) ) {
+				present[row / BITS_PER_WORD] |= (uint64_t)1 << ( row % BITS_PER_WORD );
+				row ++;
+			}
+			while( row + BITS_PER_WORD <= end ) {
+				present[row / BITS_PER_WORD] = ~(uint64_t)0;
+				row += BITS_PER_WORD;
+			}
+			if( row < end ) {
+				present[row / BITS_PER_WORD] |= ( (uint64_t)1 << ( end - row ) ) - 1;
+			}
+		}
+
+		/**
+		 *	Append count null rows.
+		 */
+		void appendNulls( size_t count ) {
+			values.resize( values.size() + count, StorageType() );
+			growBitmap( values.size() );
+		}
+
+		/**
+		 *	Set every row to arg.
+		 */
+		void fill( const T arg ) {
+			std::fill( values.begin(), values.end(), arg );
+			std::fill( present.begin(), present.end(), ~(uint64_t)0 );
+			if( ( values.size() % BITS_PER_WORD ) != 0 ) {
+				present.back() = ( (uint64_t)1 << ( values.size() % BITS_PER_WORD ) ) - 1;
+			}
+		}
+
+		/**
+		 *	Call fn( row, value ) for each non-null row in order, skipping
+		 *	null rows a bitmap word at a time.
+		 */
+		template< class Fn > void forEachNonNull( Fn fn ) const {
+			for( size_t word = 0; word < present.size(); word ++ ) {
+				uint64_t bits = present[word];
+				while( bits != 0 ) {
+					size_t row = ( word * BITS_PER_WORD ) + countTrailingZeros( bits );
+					fn( row, (T)values[row] );
+					bits &= bits - 1;
+				}
+			}
+		}
+
+		/**
+		 *	@returns	The number of non-null rows.
+		 */
+		size_t countNonNull() const {
+			size_t count = 0;
+			for( uint64_t word : present ) {
+				count += popCount( word );
+			}
+			return( count );
+		}
+
+		/**
+		 *	@returns	The sum of the non-null rows, or 0 if there are none.
+		 */
+		SumType sum() const {
+			// Null rows hold T(), so every row can be added; four partial
+			// sums keep floating point adds from serializing on one register
+			const StorageType* data = values.data();
+			size_t rowCount = values.size();
+			SumType partial[4] = { 0, 0, 0, 0 };
+			size_t row = 0;
+			for( ; row + 4 <= rowCount; row += 4 ) {
+				partial[0] += (SumType)data[row];
+				partial[1] += (SumType)data[row + 1];
+				partial[2] += (SumType)data[row + 2];
+				partial[3] += (SumType)data[row + 3];
+			}
+			for( ; row < rowCount; row ++ ) {
+				partial[0] += (SumType)data[row];
+			}
+			return( ( partial[0] + partial[1] ) + ( partial[2] + partial[3] ) );
+		}
+
+		/**
+		 *	Set target to the smallest non-null value.
+		 *
+		 *	@returns	false, leaving target unchanged, if every row is null.
+		 */
+		bool min( T& target ) const {
+			return( fold( target, []( T best, T candidate ) { return( ( candidate < best ) ? candidate : best ); } ) );
+		}
+
+		/**
+		 *	Set target to the largest non-null value.
+		 *
+		 *	@returns	false, leaving target unchanged, if every row is null.
+		 */
+		bool max( T& target ) const {
+			return( fold( target, []( T best, T candidate ) { return( ( candidate > best ) ? candidate : best ); } ) );
+		}
+
+		/**
+		 *	@returns	The values array, in which null rows hold T().
+		 */
+		inline const StorageType* data() const {
+			return( values.data() );
+		}
+	};
+
+	template< class T > const std::string TCFLibNullableColumn<T>::CLASS_NAME( "TCFLibNullableColumn" );
+}
@@ -33,6 +33,39 @@ namespace std {
 
 	template< class EltClass > class TCFLibOwningList : public std::list< EltClass > {
 
+	protected:
+
+		/**
+		 *	Append clones of the elements of src, in order, leaving NULL
+		 *	entries NULL.  If any clone() throws, the clones made so far are
+		 *	deleted, the list is left empty, and the exception is rethrown.
+		 */
+		void cloneElements( const std::list<EltClass>& src ) {
+			try {
+				auto iter = src.begin();
+				auto endit = src.end();
+				while( iter != endit ) {
+					if( *iter != NULL ) {
+						std::list<EltClass>::push_back( dynamic_cast<EltClass>( (*iter)->clone() ) );
+					}
+					else {
+						std::list<EltClass>::push_back( *iter );
+					}
+					iter ++;
+				}
+			}
+			catch( ... ) {
+				for( EltClass& elt : *this ) {
+					if( elt != NULL ) {
+						delete elt;
+						elt = NULL;
+					}
+				}
+				std::list<EltClass>::clear();
+				throw;
+			}
+		}
+
 	public:
 
 		/**
@@ -49,17 +82,7 @@ namespace std {
 		TCFLibOwningList<EltClass>( const TCFLibOwningList<EltClass>& src )
 		: std::list<EltClass>()
 		{
-			auto iter = src.begin();
-			auto endit = src.end();
-			while( iter != endit ) {
-				if( *iter != NULL ) {
-					std::list<EltClass>::push_back( dynamic_cast<EltClass>( (*iter)->clone() ) );
-				}
-				else {
-					std::list<EltClass>::push_back( *iter );
-				}
-				iter ++;
-			}
+			cloneElements( src );
 		}
 
 		/**
@@ -68,17 +91,42 @@ namespace std {
 		TCFLibOwningList<EltClass>( const std::list<EltClass>& src )
 		: std::list<EltClass>()
 		{
-			auto iter = src.begin();
-			auto endit = src.end();
-			while( iter != endit ) {
-				if( *iter != NULL ) {
-					std::list<EltClass>::push_back( dynamic_cast<EltClass>( (*iter)->clone() ) );
-				}
-				else {
-					std::list<EltClass>::push_back( *iter );
-				}
-				iter ++;
+			cloneElements( src );
+		}
+
+		/**
+		 *	Move constructor.  Takes over the elements of src without
+		 *	cloning them, leaving src empty.
+		 */
+		TCFLibOwningList( TCFLibOwningList<EltClass>&& src ) noexcept
+		: std::list<EltClass>( std::move( src ) )
+		{
+			src.clear();
+		}
+
+		/**
+		 *	Copy assignment.  Clones the elements of src with the copy
+		 *	constructor, then releases the current elements.  If a clone()
+		 *	throws, this list is left unchanged.
+		 */
+		TCFLibOwningList<EltClass>& operator =( const TCFLibOwningList<EltClass>& src ) {
+			if( this != &src ) {
+				TCFLibOwningList<EltClass> cloned( src );
+				std::list<EltClass>::swap( cloned );
+			}
+			return( *this );
+		}
+
+		/**
+		 *	Move assignment.  Releases the current elements and takes over
+		 *	those of src without cloning them, leaving src empty.
+		 */
+		TCFLibOwningList<EltClass>& operator =( TCFLibOwningList<EltClass>&& src ) noexcept {
+			if( this != &src ) {
+				TCFLibOwningList<EltClass> released( std::move( *this ) );
+				std::list<EltClass>::swap( src );
 			}
+			return( *this );
 		}
 
 		/**
@@ -27,12 +27,114 @@
 
 #include <memory.h>
 
+#include <atomic>
+#include <exception>
+
 #include <cflib/CFLib.hpp>
+#include <cflib/CFLibWorkerPool.hpp>
 
 namespace std {
 
 	template< class EltClass > class TCFLibOwningVector : public std::vector< EltClass > {
 
+	public:
+
+		/**
+		 *	parallelClone() gives each task at least this many elements, so
+		 *	vectors of fewer than twice as many are cloned on the calling thread.
+		 */
+		static constexpr size_t PARALLEL_CLONE_CHUNK = 16384;
+
+	protected:
+
+		/**
+		 *	Clone src[begin..end) into the same positions of this vector,
+		 *	leaving NULL entries NULL.
+		 */
+		void cloneRange( const std::vector<EltClass>& src, size_t begin, size_t end ) {
+			for( size_t idx = begin; idx < end; idx ++ ) {
+				if( src[idx] != NULL ) {
+					(*this)[idx] = dynamic_cast<EltClass>( src[idx]->clone() );
+				}
+			}
+		}
+
+		/**
+		 *	Delete every element and empty the vector.
+		 */
+		void releaseElements() {
+			for( EltClass& elt : *this ) {
+				if( elt != NULL ) {
+					delete elt;
+					elt = NULL;
+				}
+			}
+			std::vector<EltClass>::clear();
+		}
+
+		/**
+		 *	Fill this empty vector with clones of the elements of src, in
+		 *	order, sizing it once up front.  If any clone() throws, every
+		 *	clone made so far is deleted, the vector is left empty, and the
+		 *	exception is rethrown.
+		 */
+		void cloneElements( const std::vector<EltClass>& src ) {
+			std::vector<EltClass>::assign( src.size(), NULL );
+			try {
+				cloneRange( src, 0, src.size() );
+			}
+			catch( ... ) {
+				releaseElements();
+				throw;
+			}
+		}
+
+		/**
+		 *	Fill this empty vector with clones of the elements of src, split
+		 *	into contiguous chunks of at least PARALLEL_CLONE_CHUNK elements
+		 *	that are cloned by the threads of pool and the calling thread.
+		 *	If any clone() throws, every clone made is deleted, the vector is
+		 *	left empty, and the first exception is rethrown.
+		 */
+		void parallelCloneElements( const std::vector<EltClass>& src, cflib::CFLibWorkerPool& pool ) {
+			size_t eltCount = src.size();
+			size_t numChunks = eltCount / PARALLEL_CLONE_CHUNK;
+			if( numChunks > (size_t)pool.getNumThreads() + 1 ) {
+				numChunks = (size_t)pool.getNumThreads() + 1;
+			}
+			if( numChunks < 2 ) {
+				cloneElements( src );
+				return;
+			}
+
+			std::vector<EltClass>::assign( eltCount, NULL );
+			size_t chunkSize = ( eltCount + numChunks - 1 ) / numChunks;
+			std::vector<std::exception_ptr> failures( numChunks );
+			std::atomic<bool> failed( false );
+			pool.forEach( numChunks, [this, &src, &failures, &failed, chunkSize, eltCount]( size_t chunkIdx ) {
+				size_t begin = chunkIdx * chunkSize;
+				size_t end = ( begin + chunkSize < eltCount ) ? begin + chunkSize : eltCount;
+				// Once one chunk has failed the rest would only be deleted again
+				if( ( begin >= end ) || failed.load( std::memory_order_relaxed ) ) {
+					return;
+				}
+				try {
+					cloneRange( src, begin, end );
+				}
+				catch( ... ) {
+					failures[chunkIdx] = std::current_exception();
+					failed.store( true, std::memory_order_relaxed );
+				}
+			} );
+
+			for( const std::exception_ptr& chunkFailure : failures ) {
+				if( chunkFailure ) {
+					releaseElements();
+					std::rethrow_exception( chunkFailure );
+				}
+			}
+		}
+
 	public:
 
 		/**
@@ -45,40 +147,78 @@ namespace std {
 
 		/**
 		 *	Copy constructor.  Note that elements MUST implement ICFLibCloneableObj.
+		 *	The elements are cloned on the calling thread; use parallelClone()
+		 *	to spread a large copy over a worker pool.
 		 */
 		TCFLibOwningVector<EltClass>( const TCFLibOwningVector<EltClass>& src )
 		: std::vector<EltClass>()
 		{
-			auto iter = src.begin();
-			auto endit = src.end();
-			while( iter != endit ) {
-				if( *iter != NULL ) {
-					std::vector<EltClass>::push_back( dynamic_cast<EltClass>( (*iter)->clone() ) );
-				}
-				else {
-					std::vector<EltClass>::push_back( *iter );
-				}
-				iter ++;
-			}
+			cloneElements( src );
 		}
 
 		/**
 		 *	Copy constructor.  Note that elements MUST implement ICFLibCloneableObj.
+		 *	The elements are cloned on the calling thread; use parallelClone()
+		 *	to spread a large copy over a worker pool.
 		 */
 		TCFLibOwningVector<EltClass>( const std::vector<EltClass>& src )
 		: std::vector<EltClass>()
 		{
-			auto iter = src.begin();
-			auto endit = src.end();
-			while( iter != endit ) {
-				if( *iter != NULL ) {
-					std::vector<EltClass>::push_back( dynamic_cast<EltClass>( (*iter)->clone() ) );
-				}
-				else {
-					std::vector<EltClass>::push_back( *iter );
-				}
-				iter ++;
+			cloneElements( src );
+		}
+
+		/**
+		 *	Move constructor.  Takes over the elements of src without
+		 *	cloning them, leaving src empty.
+		 */
+		TCFLibOwningVector( TCFLibOwningVector<EltClass>&& src ) noexcept
+		: std::vector<EltClass>( std::move( src ) )
+		{
+			src.clear();
+		}
+
+		/**
+		 *	Copy assignment.  Clones the elements of src with the copy
+		 *	constructor, then releases the current elements.  If a clone()
+		 *	throws, this vector is left unchanged.
+		 */
+		TCFLibOwningVector<EltClass>& operator =( const TCFLibOwningVector<EltClass>& src ) {
+			if( this != &src ) {
+				TCFLibOwningVector<EltClass> cloned( src );
+				std::vector<EltClass>::swap( cloned );
+			}
+			return( *this );
+		}
+
+		/**
+		 *	Replace the elements of this vector with clones of those of src,
+		 *	cloned by the threads of pool and the calling thread at once when
+		 *	src is large, so clone() must be safe to call concurrently on
+		 *	different elements.  Order and NULL entries are kept.  If a
+		 *	clone() throws, the clones made are deleted, this vector is left
+		 *	unchanged, and the first exception is rethrown.
+		 */
+		void parallelClone( const std::vector<EltClass>& src,
+			cflib::CFLibWorkerPool& pool = cflib::CFLibWorkerPool::getSharedPool() )
+		{
+			if( this == &src ) {
+				return;
+			}
+			TCFLibOwningVector<EltClass> cloned;
+			cloned.parallelCloneElements( src, pool );
+			std::vector<EltClass>::swap( cloned );
+		}
+
+		/**
+		 *	Move assignment.  Releases the current elements and takes over
+		 *	those of src without cloning them, leaving src empty.
+		 */
+		TCFLibOwningVector<EltClass>& operator =( TCFLibOwningVector<EltClass>&& src ) noexcept {
+			if( this != &src ) {
+				TCFLibOwningVector<EltClass> released( std::move( *this ) );
+				std::vector<EltClass>::swap( src );
 			}
+			return( *this );
 		}
 
 		/**
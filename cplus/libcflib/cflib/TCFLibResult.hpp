@@ -0,0 +1,134 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <string>
+
+#include <cflib/CFLibStatus.hpp>
+
+namespace cflib {
+
+	/**
+	 *	An expected-style result: a value of type T, or the CFLibStatus
+	 *	describing why there is no value.
+	 *	<p>
+	 *	A failed status copies the input it describes (see CFLibStatus), so
+	 *	the result may outlive that input.
+	 *	getValue() throws the exception the status describes when there is
+	 *	no value, so code that wants the old throwing behaviour can simply
+	 *	call it.
+	 */
+	template< class T > class TCFLibResult {
+
+	protected:
+		T value;
+		CFLibStatus status;
+
+	public:
+
+		/**
+		 *	Construct a successful result holding a default-constructed value.
+		 */
+		TCFLibResult()
+		: value(),
+		  status()
+		{
+		}
+
+		/**
+		 *	Construct a successful result.
+		 */
+		TCFLibResult( const T& argValue )
+		: value( argValue ),
+		  status()
+		{
+		}
+
+		/**
+		 *	Construct a result with no value.
+		 */
+		TCFLibResult( const CFLibStatus& argStatus )
+		: value(),
+		  status( argStatus )
+		{
+		}
+
+		TCFLibResult( const TCFLibResult<T>& src )
+		: value( src.value ),
+		  status( src.status )
+		{
+		}
+
+		~TCFLibResult() {
+		}
+
+		TCFLibResult<T>& operator =( const TCFLibResult<T>& src ) {
+			value = src.value;
+			status = src.status;
+			return( *this );
+		}
+
+		inline bool isOk() const {
+			return( status.isOk() );
+		}
+
+		inline bool isNull() const {
+			return( status.isNull() );
+		}
+
+		inline bool isError() const {
+			return( status.isError() );
+		}
+
+		inline const CFLibStatus& getStatus() const {
+			return( status );
+		}
+
+		/**
+		 *	Get the value, throwing the exception described by the status
+		 *	if there is none.
+		 */
+		const T& getValue() const {
+			if( ! status.isOk() ) {
+				status.throwException();
+			}
+			return( value );
+		}
+
+		/**
+		 *	Get the value, or defaultValue if there is none.
+		 */
+		inline const T& getValueOr( const T& defaultValue ) const {
+			if( status.isOk() ) {
+				return( value );
+			}
+			return( defaultValue );
+		}
+	};
+}
@@ -0,0 +1,675 @@
+#pragma once
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#	include <emmintrin.h>
+#endif
+
+#include <cflib/CFLib.hpp>
+#include <cflib/CFLibNullArgumentException.hpp>
+
+namespace cflib {
+
+	/**
+	 *	A TCFLibUuidHashMap maps uuid_t keys to values of type V in a flat,
+	 *	open-addressed table laid out like a Swiss table: the 16-byte keys
+	 *	are copied into the entry array next to their values, and a parallel
+	 *	array of one control byte per entry holds 7 bits of each key's hash.
+	 *	Lookups compare a whole group of 16 control bytes at once (with SSE2
+	 *	where available) and only touch the entries whose control byte
+	 *	matches, so a cache of primary keys needs no per-entry allocation and
+	 *	rarely more than one key comparison per lookup.
+	 *	<p>
+	 *	Pointers to values and iterators are invalidated by any insert that
+	 *	grows or rehashes the table, and by reserve().  erase() invalidates
+	 *	only the erased entry.
+	 *	<p>
+	 *	An insert, reserve or copy that throws, whether from allocation or
+	 *	from copying a value, leaves the map as it was.
+	 */
+	template< class V > class TCFLibUuidHashMap {
+
+	public:
+
+		/**
+		 *	One key/value pair, as visited by the iterators.
+		 */
+		class Entry {
+		public:
+			uuid_t key;
+			V value;
+
+			Entry( const unsigned char* argKey, const V& argValue )
+			: value( argValue )
+			{
+				memcpy( key, argKey, sizeof( uuid_t ) );
+			}
+
+			Entry( Entry&& src ) noexcept( std::is_nothrow_move_constructible<V>::value )
+			: value( std::move( src.value ) )
+			{
+				memcpy( key, src.key, sizeof( uuid_t ) );
+			}
+
+			Entry( const Entry& src )
+			: value( src.value )
+			{
+				memcpy( key, src.key, sizeof( uuid_t ) );
+			}
+		};
+
+	protected:
+		static constexpr size_t GROUP_WIDTH = 16;
+		static constexpr size_t NPOS = (size_t)-1;
+		static constexpr int8_t CTRL_EMPTY = -128;
+		static constexpr int8_t CTRL_DELETED = -2;
+
+		/**
+		 *	One control byte per entry: CTRL_EMPTY, CTRL_DELETED, or the low
+		 *	7 bits of the hash of the key held by a full entry.
+		 */
+		int8_t* ctrl;
+
+		/**
+		 *	Raw storage for entryCapacity entries, of which only those with
+		 *	a full control byte are constructed.
+		 */
+		Entry* entries;
+
+		size_t entryCapacity;
+		size_t entryCount;
+
+		/**
+		 *	How many more empty entries may be filled before the table has
+		 *	to grow or be rehashed to clear deleted entries.
+		 */
+		size_t growthLeft;
+
+		static inline size_t lowestBit( uint32_t mask ) {
+#if defined(__GNUC__)
+			return( (size_t)__builtin_ctz( mask ) );
+#else
+			size_t idx = 0;
+			while( ( mask & 1 ) == 0 ) {
+				mask >>= 1;
+				idx ++;
+			}
+			return( idx );
+#endif
+		}
+
+		/**
+		 *	@returns	A bit mask of the control bytes in the group equal to value.
+		 */
+		static inline uint32_t matchByte( const int8_t* group, int8_t value ) {
+#if defined(__SSE2__)
+			__m128i ctrlBytes = _mm_loadu_si128( (const __m128i*)group );
+			return( (uint32_t)_mm_movemask_epi8( _mm_cmpeq_epi8( ctrlBytes, _mm_set1_epi8( value ) ) ) );
+#else
+			uint32_t mask = 0;
+			for( size_t i = 0; i < GROUP_WIDTH; i++ ) {
+				if( group[i] == value ) {
+					mask |= ( 1U << i );
+				}
+			}
+			return( mask );
+#endif
+		}
+
+		/**
+		 *	@returns	A bit mask of the empty and deleted control bytes in the
+		 *		group, which are the only negative ones.
+		 */
+		static inline uint32_t matchFree( const int8_t* group ) {
+#if defined(__SSE2__)
+			return( (uint32_t)_mm_movemask_epi8( _mm_loadu_si128( (const __m128i*)group ) ) );
+#else
+			uint32_t mask = 0;
+			for( size_t i = 0; i < GROUP_WIDTH; i++ ) {
+				if( group[i] < 0 ) {
+					mask |= ( 1U << i );
+				}
+			}
+			return( mask );
+#endif
+		}
+
+		static inline size_t maxEntriesFor( size_t capacity ) {
+			return( capacity - ( capacity / 8 ) );
+		}
+
+		/**
+		 *	@returns	The smallest power of two capacity, at least one group,
+		 *		that holds count entries at a load factor of 7/8.
+		 */
+		static size_t capacityFor( size_t count ) {
+			size_t capacity = GROUP_WIDTH;
+			while( maxEntriesFor( capacity ) < count ) {
+				capacity <<= 1;
+			}
+			return( capacity );
+		}
+
+		/**
+		 *	Find the entry holding key, probing whole groups in triangular
+		 *	order until a group with an empty control byte ends the chain.
+		 *	<p>
+		 *	When key is not found and freeIdx is not NULL, it is set to the
+		 *	first empty or deleted entry on the chain, which is where
+		 *	findFreeIndex() would place key, or NPOS if the table is empty.
+		 */
+		size_t findIndex( const unsigned char* key, size_t hash, size_t* freeIdx = NULL ) const {
+			if( entryCapacity == 0 ) {
+				if( freeIdx != NULL ) {
+					*freeIdx = NPOS;
+				}
+				return( NPOS );
+			}
+			size_t groupMask = ( entryCapacity / GROUP_WIDTH ) - 1;
+			size_t group = ( hash >> 7 ) & groupMask;
+			int8_t h2 = (int8_t)( hash & 0x7f );
+			size_t firstFree = NPOS;
+			for( size_t probe = 1; ; probe ++ ) {
+				const int8_t* groupCtrl = ctrl + ( group * GROUP_WIDTH );
+				uint32_t candidates = matchByte( groupCtrl, h2 );
+				while( candidates != 0 ) {
+					size_t idx = ( group * GROUP_WIDTH ) + lowestBit( candidates );
+					if( 0 == memcmp( entries[idx].key, key, sizeof( uuid_t ) ) ) {
+						return( idx );
+					}
+					candidates &= candidates - 1;
+				}
+				if( firstFree == NPOS ) {
+					uint32_t free = matchFree( groupCtrl );
+					if( free != 0 ) {
+						firstFree = ( group * GROUP_WIDTH ) + lowestBit( free );
+					}
+				}
+				if( matchByte( groupCtrl, CTRL_EMPTY ) != 0 ) {
+					if( freeIdx != NULL ) {
+						*freeIdx = firstFree;
+					}
+					return( NPOS );
+				}
+				group = ( group + probe ) & groupMask;
+			}
+		}
+
+		/**
+		 *	Find the first empty or deleted entry on the probe sequence of hash
+		 *	in a table of capacity control bytes.
+		 */
+		static size_t findFreeIndex( const int8_t* tableCtrl, size_t capacity, size_t hash ) {
+			size_t groupMask = ( capacity / GROUP_WIDTH ) - 1;
+			size_t group = ( hash >> 7 ) & groupMask;
+			for( size_t probe = 1; ; probe ++ ) {
+				uint32_t free = matchFree( tableCtrl + ( group * GROUP_WIDTH ) );
+				if( free != 0 ) {
+					return( ( group * GROUP_WIDTH ) + lowestBit( free ) );
+				}
+				group = ( group + probe ) & groupMask;
+			}
+		}
+
+		/**
+		 *	Allocate the control bytes and entry storage for a table of
+		 *	capacity entries, every one of them empty.
+		 */
+		static void allocateTable( size_t capacity, int8_t*& newCtrl, Entry*& newEntries ) {
+			newCtrl = new int8_t[capacity];
+			try {
+				newEntries = static_cast<Entry*>( ::operator new( capacity * sizeof( Entry ) ) );
+			}
+			catch( ... ) {
+				delete[] newCtrl;
+				throw;
+			}
+			memset( newCtrl, CTRL_EMPTY, capacity );
+		}
+
+		static void destroyEntries( int8_t* tableCtrl, Entry* tableEntries, size_t capacity ) {
+			for( size_t idx = 0; idx < capacity; idx ++ ) {
+				if( tableCtrl[idx] >= 0 ) {
+					tableEntries[idx].~Entry();
+				}
+			}
+		}
+
+		static void freeTable( int8_t* tableCtrl, Entry* tableEntries ) {
+			delete[] tableCtrl;
+			::operator delete( tableEntries );
+		}
+
+		/**
+		 *	Move every entry into a new table of newCapacity entries,
+		 *	dropping the deleted entries.  The new table is filled before it
+		 *	replaces the old one, and values whose move constructor may
+		 *	throw are copied instead, so a failure leaves the map unchanged.
+		 */
+		void rehash( size_t newCapacity ) {
+			int8_t* newCtrl;
+			Entry* newEntries;
+			allocateTable( newCapacity, newCtrl, newEntries );
+
+			try {
+				for( size_t oldIdx = 0; oldIdx < entryCapacity; oldIdx ++ ) {
+					if( ctrl[oldIdx] >= 0 ) {
+						Entry& oldEntry = entries[oldIdx];
+						size_t hash = CFLib::hash( (const uuid_ptr_t)oldEntry.key );
+						size_t idx = findFreeIndex( newCtrl, newCapacity, hash );
+						new( &newEntries[idx] ) Entry( std::move_if_noexcept( oldEntry ) );
+						newCtrl[idx] = (int8_t)( hash & 0x7f );
+					}
+				}
+			}
+			catch( ... ) {
+				destroyEntries( newCtrl, newEntries, newCapacity );
+				freeTable( newCtrl, newEntries );
+				throw;
+			}
+
+			if( ctrl != NULL ) {
+				destroyEntries( ctrl, entries, entryCapacity );
+				freeTable( ctrl, entries );
+			}
+			ctrl = newCtrl;
+			entries = newEntries;
+			entryCapacity = newCapacity;
+			growthLeft = maxEntriesFor( newCapacity ) - entryCount;
+		}
+
+		void release() {
+			if( ctrl != NULL ) {
+				destroyEntries( ctrl, entries, entryCapacity );
+				freeTable( ctrl, entries );
+				ctrl = NULL;
+				entries = NULL;
+			}
+			entryCapacity = 0;
+			entryCount = 0;
+			growthLeft = 0;
+		}
+
+		/**
+		 *	Copy src into this map, which must be empty and hold no storage.
+		 *	Each control byte is only copied once its entry is constructed.
+		 */
+		void copyFrom( const TCFLibUuidHashMap<V>& src ) {
+			if( src.entryCapacity == 0 ) {
+				return;
+			}
+			int8_t* newCtrl;
+			Entry* newEntries;
+			allocateTable( src.entryCapacity, newCtrl, newEntries );
+			try {
+				for( size_t idx = 0; idx < src.entryCapacity; idx ++ ) {
+					if( src.ctrl[idx] >= 0 ) {
+						new( &newEntries[idx] ) Entry( src.entries[idx] );
+					}
+					newCtrl[idx] = src.ctrl[idx];
+				}
+			}
+			catch( ... ) {
+				destroyEntries( newCtrl, newEntries, src.entryCapacity );
+				freeTable( newCtrl, newEntries );
+				throw;
+			}
+			ctrl = newCtrl;
+			entries = newEntries;
+			entryCapacity = src.entryCapacity;
+			entryCount = src.entryCount;
+			growthLeft = src.growthLeft;
+		}
+
+		/**
+		 *	Map key, which is not mapped, to value in the entry at freeIdx
+		 *	as found by findIndex(), growing the table first if freeIdx is
+		 *	NPOS or would use up the last empty entry allowed.
+		 *
+		 *	@returns	The index of the new entry.
+		 */
+		size_t insertAt( const unsigned char* key, size_t hash, size_t freeIdx, const V& value ) {
+			if( ( freeIdx == NPOS ) || ( ( ctrl[freeIdx] == CTRL_EMPTY ) && ( growthLeft == 0 ) ) ) {
+				// Rehash in place when deleted entries hold most of the room
+				if( ( entryCapacity > 0 ) && ( entryCount < ( maxEntriesFor( entryCapacity ) / 2 ) ) ) {
+					rehash( entryCapacity );
+				}
+				else {
+					rehash( ( entryCapacity == 0 ) ? GROUP_WIDTH : ( entryCapacity * 2 ) );
+				}
+				freeIdx = findFreeIndex( ctrl, entryCapacity, hash );
+			}
+			new( &entries[freeIdx] ) Entry( key, value );
+			if( ctrl[freeIdx] == CTRL_EMPTY ) {
+				growthLeft --;
+			}
+			ctrl[freeIdx] = (int8_t)( hash & 0x7f );
+			entryCount ++;
+			return( freeIdx );
+		}
+
+		static void checkKey( const std::string& procName, const unsigned char* key ) {
+			if( key == NULL ) {
+				throw CFLibNullArgumentException( CLASS_NAME, procName, 1, S_Key );
+			}
+		}
+
+		static const std::string S_ProcFind;
+		static const std::string S_ProcInsert;
+		static const std::string S_ProcIndex;
+		static const std::string S_ProcErase;
+		static const std::string S_Key;
+
+	public:
+		static const std::string CLASS_NAME;
+
+		template< class MapClass, class EntryClass > class TIterator {
+		protected:
+			MapClass* map;
+			size_t idx;
+
+			void skipFree() {
+				while( ( idx < map->entryCapacity ) && ( map->ctrl[idx] < 0 ) ) {
+					idx ++;
+				}
+			}
+
+		public:
+			TIterator( MapClass* argMap, size_t argIdx )
+			: map( argMap ),
+			  idx( argIdx )
+			{
+				skipFree();
+			}
+
+			inline EntryClass& operator *() const {
+				return( map->entries[idx] );
+			}
+
+			inline EntryClass* operator ->() const {
+				return( &map->entries[idx] );
+			}
+
+			inline TIterator& operator ++() {
+				idx ++;
+				skipFree();
+				return( *this );
+			}
+
+			inline bool operator ==( const TIterator& rhs ) const {
+				return( ( map == rhs.map ) && ( idx == rhs.idx ) );
+			}
+
+			inline bool operator !=( const TIterator& rhs ) const {
+				return( ( map != rhs.map ) || ( idx != rhs.idx ) );
+			}
+
+			inline size_t getIndex() const {
+				return( idx );
+			}
+		};
+
+		typedef TIterator< TCFLibUuidHashMap<V>, Entry > iterator;
+		typedef TIterator< const TCFLibUuidHashMap<V>, const Entry > const_iterator;
+
+		TCFLibUuidHashMap()
+		: ctrl( NULL ),
+		  entries( NULL ),
+		  entryCapacity( 0 ),
+		  entryCount( 0 ),
+		  growthLeft( 0 )
+		{
+		}
+
+		/**
+		 *	Construct a map with room for expectedCount entries.
+		 */
+		TCFLibUuidHashMap( size_t expectedCount )
+		: ctrl( NULL ),
+		  entries( NULL ),
+		  entryCapacity( 0 ),
+		  entryCount( 0 ),
+		  growthLeft( 0 )
+		{
+			reserve( expectedCount );
+		}
+
+		TCFLibUuidHashMap( const TCFLibUuidHashMap<V>& src )
+		: ctrl( NULL ),
+		  entries( NULL ),
+		  entryCapacity( 0 ),
+		  entryCount( 0 ),
+		  growthLeft( 0 )
+		{
+			copyFrom( src );
+		}
+
+		TCFLibUuidHashMap( TCFLibUuidHashMap<V>&& src ) noexcept
+		: ctrl( src.ctrl ),
+		  entries( src.entries ),
+		  entryCapacity( src.entryCapacity ),
+		  entryCount( src.entryCount ),
+		  growthLeft( src.growthLeft )
+		{
+			src.ctrl = NULL;
+			src.entries = NULL;
+			src.entryCapacity = 0;
+			src.entryCount = 0;
+			src.growthLeft = 0;
+		}
+
+		TCFLibUuidHashMap<V>& operator =( const TCFLibUuidHashMap<V>& src ) {
+			if( this != &src ) {
+				TCFLibUuidHashMap<V> copied( src );
+				swap( copied );
+			}
+			return( *this );
+		}
+
+		TCFLibUuidHashMap<V>& operator =( TCFLibUuidHashMap<V>&& src ) noexcept {
+			if( this != &src ) {
+				release();
+				swap( src );
+			}
+			return( *this );
+		}
+
+		void swap( TCFLibUuidHashMap<V>& other ) noexcept {
+			std::swap( ctrl, other.ctrl );
+			std::swap( entries, other.entries );
+			std::swap( entryCapacity, other.entryCapacity );
+			std::swap( entryCount, other.entryCount );
+			std::swap( growthLeft, other.growthLeft );
+		}
+
+		~TCFLibUuidHashMap() {
+			release();
+		}
+
+		inline size_t size() const {
+			return( entryCount );
+		}
+
+		inline bool empty() const {
+			return( entryCount == 0 );
+		}
+
+		/**
+		 *	@returns	The number of entries the table has storage for.
+		 */
+		inline size_t capacity() const {
+			return( entryCapacity );
+		}
+
+		/**
+		 *	Make room for count entries without further growth.
+		 */
+		void reserve( size_t count ) {
+			size_t needed = capacityFor( count );
+			if( needed > entryCapacity ) {
+				rehash( needed );
+			}
+		}
+
+		/**
+		 *	Destroy every entry, keeping the table storage for reuse.
+		 */
+		void clear() {
+			if( ctrl != NULL ) {
+				destroyEntries( ctrl, entries, entryCapacity );
+				memset( ctrl, CTRL_EMPTY, entryCapacity );
+			}
+			entryCount = 0;
+			growthLeft = maxEntriesFor( entryCapacity );
+		}
+
+		/**
+		 *	@returns	The value mapped to key, or NULL if there is none.
+		 */
+		V* find( const unsigned char* key ) {
+			checkKey( S_ProcFind, key );
+			size_t idx = findIndex( key, CFLib::hash( (const uuid_ptr_t)key ) );
+			return( ( idx == NPOS ) ? NULL : &entries[idx].value );
+		}
+
+		const V* find( const unsigned char* key ) const {
+			checkKey( S_ProcFind, key );
+			size_t idx = findIndex( key, CFLib::hash( (const uuid_ptr_t)key ) );
+			return( ( idx == NPOS ) ? NULL : &entries[idx].value );
+		}
+
+		inline bool contains( const unsigned char* key ) const {
+			return( find( key ) != NULL );
+		}
+
+		/**
+		 *	Map key to value unless key is already mapped.
+		 *
+		 *	@returns	The mapped value, and true if it was inserted or false if
+		 *		key was already present and its value left unchanged.
+		 */
+		std::pair<V*, bool> insert( const unsigned char* key, const V& value ) {
+			checkKey( S_ProcInsert, key );
+			size_t hash = CFLib::hash( (const uuid_ptr_t)key );
+			size_t freeIdx;
+			size_t idx = findIndex( key, hash, &freeIdx );
+			if( idx != NPOS ) {
+				return( std::pair<V*, bool>( &entries[idx].value, false ) );
+			}
+			idx = insertAt( key, hash, freeIdx, value );
+			return( std::pair<V*, bool>( &entries[idx].value, true ) );
+		}
+
+		/**
+		 *	@returns	The value mapped to key, inserting a default-constructed
+		 *		value if there is none.
+		 */
+		V& operator []( const unsigned char* key ) {
+			checkKey( S_ProcIndex, key );
+			size_t hash = CFLib::hash( (const uuid_ptr_t)key );
+			size_t freeIdx;
+			size_t idx = findIndex( key, hash, &freeIdx );
+			if( idx == NPOS ) {
+				idx = insertAt( key, hash, freeIdx, V() );
+			}
+			return( entries[idx].value );
+		}
+
+		/**
+		 *	Remove the mapping for key.
+		 *
+		 *	@returns	true if key was mapped.
+		 */
+		bool erase( const unsigned char* key ) {
+			checkKey( S_ProcErase, key );
+			size_t idx = findIndex( key, CFLib::hash( (const uuid_ptr_t)key ) );
+			if( idx == NPOS ) {
+				return( false );
+			}
+			eraseIndex( idx );
+			return( true );
+		}
+
+		/**
+		 *	Remove the entry at pos.
+		 *
+		 *	@returns	An iterator to the entry after pos.
+		 */
+		iterator erase( iterator pos ) {
+			size_t idx = pos.getIndex();
+			eraseIndex( idx );
+			return( iterator( this, idx + 1 ) );
+		}
+
+		iterator begin() {
+			return( iterator( this, 0 ) );
+		}
+
+		iterator end() {
+			return( iterator( this, entryCapacity ) );
+		}
+
+		const_iterator begin() const {
+			return( const_iterator( this, 0 ) );
+		}
+
+		const_iterator end() const {
+			return( const_iterator( this, entryCapacity ) );
+		}
+
+	protected:
+		void eraseIndex( size_t idx ) {
+			entries[idx].~Entry();
+			entryCount --;
+			// A probe chain never continues past a group with an empty entry,
+			// so the entry can be made empty again if its group has one
+			const int8_t* groupCtrl = ctrl + ( ( idx / GROUP_WIDTH ) * GROUP_WIDTH );
+			if( matchByte( groupCtrl, CTRL_EMPTY ) != 0 ) {
+				ctrl[idx] = CTRL_EMPTY;
+				growthLeft ++;
+			}
+			else {
+				ctrl[idx] = CTRL_DELETED;
+			}
+		}
+	};
+
+	template< class V > const std::string TCFLibUuidHashMap<V>::CLASS_NAME( "TCFLibUuidHashMap" );
+	template< class V > const std::string TCFLibUuidHashMap<V>::S_ProcFind( "find" );
+	template< class V > const std::string TCFLibUuidHashMap<V>::S_ProcInsert( "insert" );
+	template< class V > const std::string TCFLibUuidHashMap<V>::S_ProcIndex( "operator[]" );
+	template< class V > const std::string TCFLibUuidHashMap<V>::S_ProcErase( "erase" );
+	template< class V > const std::string TCFLibUuidHashMap<V>::S_Key( "key" );
+}
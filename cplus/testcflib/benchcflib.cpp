@@ -0,0 +1,914 @@
+// Description: Throughput benchmarks for the CFLib XML parsing and logging support.
+
+/*
+ *  MSS Code Factory CFLib 2.13
+ *
+ *	Copyright 2020-2021 Mark Stephen Sobkow
+ *
+ *	This file is part of MSS Code Factory.
+ *
+ *	MSS Code Factory is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	MSS Code Factory is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	You should have received a copy of the GNU Lesser General Public License
+ *	along with MSS Code Factory.  If not, see https://www.gnu.org/licenses/.
+ *
+ *	Donations to support MSS Code Factory can be made at
+ *	https://www.paypal.com/paypalme2/MarkSobkow
+ *
+ *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
+ */
+
+using namespace std;
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <list>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <cflib/ICFLibPublic.hpp>
+
+static const std::string CLASS_NAME( "BenchCFLib" );
+
+/**
+ *	A parser that accepts any document and discards the SAX events, so the
+ *	benchmark measures Xerces scanning and validation rather than application
+ *	element handlers.
+ */
+class BenchSaxParser : public cflib::CFLibXmlCoreSaxParser {
+public:
+	BenchSaxParser( cflib::ICFLibMessageLog* jLogger )
+	: cflib::CFLibXmlCoreSaxParser( jLogger )
+	{
+	}
+
+	virtual ~BenchSaxParser() {
+	}
+
+	virtual void startElement(
+		const XMLCh* const uri,
+		const XMLCh* const localname,
+		const XMLCh* const qname,
+		const xercesc::Attributes& attrs )
+	{
+	}
+
+	virtual void endElement(
+		const XMLCh* const uri,
+		const XMLCh* const localname,
+		const XMLCh* const qname )
+	{
+	}
+
+	virtual void characters(
+		const XMLCh* const chars,
+		const XMLSize_t length )
+	{
+	}
+};
+
+class BenchSaxParserFactory : public cflib::ICFLibXmlCoreSaxParserFactory {
+public:
+	virtual cflib::CFLibXmlCoreSaxParser* newXmlCoreSaxParser( cflib::ICFLibMessageLog* jLogger ) const {
+		return( new BenchSaxParser( jLogger ) );
+	}
+};
+
+static void usage( const std::string& progName ) {
+	std::cerr << "Usage: " << progName << " parse <directory> [xsd]\n";
+	std::cerr << "       " << progName << " split <file> [xsd]\n";
+	std::cerr << "       " << progName << " throw [iterations]\n";
+	std::cerr << "       " << progName << " catch [iterations]\n";
+	std::cerr << "       " << progName << " hash [keys]\n";
+	std::cerr << "       " << progName << " uuidmap [entries]\n";
+	std::cerr << "       " << progName << " owning [elements]\n";
+	std::cerr << "       " << progName << " column [rows]\n";
+	std::cerr << "       " << progName << " civil [iterations] [threads]\n";
+	std::cerr << "       " << progName << " clock [iterations]\n";
+	std::cerr << "       " << progName << " config [iterations] [tags]\n";
+}
+
+static int benchParse( const std::string& dirName, const std::string& xsdFileName ) {
+	std::vector<std::string> fileNames;
+	uintmax_t totalBytes = 0;
+	for( const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator( dirName ) ) {
+		if( entry.is_regular_file() && ( entry.path().extension() == ".xml" ) ) {
+			fileNames.push_back( entry.path().string() );
+			totalBytes += entry.file_size();
+		}
+	}
+	if( fileNames.empty() ) {
+		std::cerr << CLASS_NAME << " ERROR: No *.xml files found in " << dirName << "\n";
+		return( 1 );
+	}
+
+	if( ! xsdFileName.empty() ) {
+		cflib::CFLibXmlCoreParallelParser::loadSharedGrammar( xsdFileName );
+	}
+
+	std::cout << "Parsing " << fileNames.size() << " documents, " << totalBytes << " bytes\n";
+	std::cout << "threads\tseconds\tdocs/sec\tMB/sec\tfailed\n";
+
+	BenchSaxParserFactory factory;
+	unsigned maxThreads = std::thread::hardware_concurrency();
+	if( maxThreads == 0 ) {
+		maxThreads = 1;
+	}
+	for( unsigned numThreads = 1; ; numThreads *= 2 ) {
+		if( numThreads > maxThreads ) {
+			numThreads = maxThreads;
+		}
+		cflib::CFLibXmlCoreParallelParser parallelParser( &factory, numThreads );
+		for( auto iter = fileNames.begin(); iter != fileNames.end(); iter++ ) {
+			parallelParser.addFile( *iter );
+		}
+
+		std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+		const std::TCFLibOwningVector<cflib::CFLibXmlCoreParseResult*>& results = parallelParser.run();
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - started;
+
+		size_t numFailed = 0;
+		for( auto iter = results.begin(); iter != results.end(); iter++ ) {
+			if( ! (*iter)->getSucceeded() ) {
+				numFailed ++;
+			}
+		}
+		double secs = elapsed.count();
+		std::cout << numThreads
+			<< "\t" << std::fixed << std::setprecision( 3 ) << secs
+			<< "\t" << std::setprecision( 1 ) << ( fileNames.size() / secs )
+			<< "\t" << ( totalBytes / ( 1024.0 * 1024.0 ) / secs )
+			<< "\t" << numFailed << "\n";
+
+		if( numThreads >= maxThreads ) {
+			break;
+		}
+	}
+	return( 0 );
+}
+
+static int benchSplit( const std::string& fileName, const std::string& xsdFileName ) {
+	uintmax_t totalBytes = std::filesystem::file_size( fileName );
+
+	if( ! xsdFileName.empty() ) {
+		cflib::CFLibXmlCoreParallelParser::loadSharedGrammar( xsdFileName );
+	}
+
+	std::cout << "Splitting " << fileName << ", " << totalBytes << " bytes\n";
+	std::cout << "threads\tchunks\tseconds\tMB/sec\tfailed\n";
+
+	BenchSaxParserFactory factory;
+	unsigned maxThreads = std::thread::hardware_concurrency();
+	if( maxThreads == 0 ) {
+		maxThreads = 1;
+	}
+	for( unsigned numThreads = 1; ; numThreads *= 2 ) {
+		if( numThreads > maxThreads ) {
+			numThreads = maxThreads;
+		}
+		cflib::CFLibXmlCoreChunkedParser chunkedParser( &factory, numThreads );
+
+		std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+		std::vector<std::string>::size_type numChunks = chunkedParser.splitFile( fileName );
+		const std::TCFLibOwningVector<cflib::CFLibXmlCoreParseResult*>& results = chunkedParser.run();
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - started;
+
+		size_t numFailed = 0;
+		for( auto iter = results.begin(); iter != results.end(); iter++ ) {
+			if( ! (*iter)->getSucceeded() ) {
+				numFailed ++;
+			}
+		}
+		double secs = elapsed.count();
+		std::cout << numThreads
+			<< "\t" << numChunks
+			<< "\t" << std::fixed << std::setprecision( 3 ) << secs
+			<< "\t" << std::setprecision( 1 ) << ( totalBytes / ( 1024.0 * 1024.0 ) / secs )
+			<< "\t" << numFailed << "\n";
+
+		if( numThreads >= maxThreads ) {
+			break;
+		}
+	}
+	return( 0 );
+}
+
+/**
+ *	Throw and catch one exception per iteration, optionally asking it for
+ *	its what() text, and return the average nanoseconds per iteration.
+ */
+static double timeThrow( unsigned long iterations, bool formatWhat, const std::function<void()>& thrower ) {
+	size_t whatLength = 0;
+	std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+	for( unsigned long i = 0; i < iterations; i++ ) {
+		try {
+			thrower();
+		}
+		catch( const cflib::CFLibRuntimeException& e ) {
+			if( formatWhat ) {
+				whatLength += strlen( e.what() );
+			}
+		}
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - started;
+	if( formatWhat && ( whatLength == 0 ) ) {
+		std::cerr << "what() returned no text\n";
+	}
+	return( elapsed.count() / iterations );
+}
+
+static int benchThrow( unsigned long iterations ) {
+	static const std::string S_ProcName( "benchThrow" );
+	static const std::string S_ArgName( "Arg" );
+	static const std::string S_Message( "bench exception" );
+
+	std::vector<std::pair<std::string, std::function<void()>>> throwers;
+	throwers.push_back( std::make_pair( std::string( "CFLibRuntimeException" ), [&]() {
+		throw cflib::CFLibRuntimeException( CLASS_NAME, S_ProcName, S_Message );
+	} ) );
+	throwers.push_back( std::make_pair( std::string( "CFLibUsageException" ), [&]() {
+		throw cflib::CFLibUsageException( CLASS_NAME, S_ProcName, S_Message );
+	} ) );
+	throwers.push_back( std::make_pair( std::string( "CFLibNullArgumentException" ), [&]() {
+		throw cflib::CFLibNullArgumentException( CLASS_NAME, S_ProcName, 1, S_ArgName );
+	} ) );
+	throwers.push_back( std::make_pair( std::string( "CFLibInvalidArgumentException" ), [&]() {
+		throw cflib::CFLibInvalidArgumentException( CLASS_NAME, S_ProcName, 1, S_ArgName, S_Message );
+	} ) );
+	throwers.push_back( std::make_pair( std::string( "CFLibArgumentRangeException(int64)" ), [&]() {
+		throw cflib::CFLibArgumentRangeException( CLASS_NAME, S_ProcName, 1, S_ArgName, (int64_t)42, (int64_t)0, (int64_t)10 );
+	} ) );
+	throwers.push_back( std::make_pair( std::string( "CFLibArgumentOverflowException(double)" ), [&]() {
+		throw cflib::CFLibArgumentOverflowException( CLASS_NAME, S_ProcName, 1, S_ArgName, 4.2, 1.0 );
+	} ) );
+
+	std::cout << "Throwing " << iterations << " exceptions of each type\n";
+	std::cout << "exception\tns/throw\tns/throw+what\n";
+	for( auto iter = throwers.begin(); iter != throwers.end(); iter++ ) {
+		double bare = timeThrow( iterations, false, iter->second );
+		double formatted = timeThrow( iterations, true, iter->second );
+		std::cout << iter->first
+			<< "\t" << std::fixed << std::setprecision( 1 ) << bare
+			<< "\t" << formatted << "\n";
+	}
+	return( 0 );
+}
+
+/**
+ *	Throw one exception per iteration and record it with
+ *	CFLIB_EXCEPTION_CATCH_FALLTHROUGH, optionally formatting the recorded
+ *	message, and return the average nanoseconds per iteration.
+ */
+static double timeCatch( unsigned long iterations, bool formatMessage, const std::function<void()>& thrower ) {
+	static const std::string S_ProcName( "timeCatch" );
+	CFLIB_EXCEPTION_DECLINFO
+	size_t messageLength = 0;
+	std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+	for( unsigned long i = 0; i < iterations; i++ ) {
+		try {
+			thrower();
+		}
+		CFLIB_EXCEPTION_CATCH_FALLTHROUGH
+		if( formatMessage ) {
+			messageLength += CFLIB_EXCEPTION_FORMATTEDMESSAGE.length();
+		}
+		CFLIB_EXCEPTION_RESET
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - started;
+	if( formatMessage && ( messageLength == 0 ) ) {
+		std::cerr << "getFormattedMessage() returned no text\n";
+	}
+	return( elapsed.count() / iterations );
+}
+
+static int benchCatch( unsigned long iterations ) {
+	static const std::string S_ProcName( "benchCatch" );
+	static const std::string S_ArgName( "Arg" );
+	static const std::string S_Message( "bench exception" );
+
+	std::vector<std::pair<std::string, std::function<void()>>> throwers;
+	throwers.push_back( std::make_pair( std::string( "CFLibRuntimeException" ), [&]() {
+		throw cflib::CFLibRuntimeException( CLASS_NAME, S_ProcName, S_Message );
+	} ) );
+	throwers.push_back( std::make_pair( std::string( "CFLibArgumentRangeException(int64)" ), [&]() {
+		throw cflib::CFLibArgumentRangeException( CLASS_NAME, S_ProcName, 1, S_ArgName, (int64_t)42, (int64_t)0, (int64_t)10 );
+	} ) );
+	throwers.push_back( std::make_pair( std::string( "SAXException" ), [&]() {
+		throw xercesc::SAXException( S_Message.c_str() );
+	} ) );
+	throwers.push_back( std::make_pair( std::string( "std::out_of_range" ), [&]() {
+		throw std::out_of_range( S_Message );
+	} ) );
+	throwers.push_back( std::make_pair( std::string( "std::exception" ), [&]() {
+		throw std::bad_exception();
+	} ) );
+
+	std::cout << "Throwing and catching " << iterations << " exceptions of each type\n";
+	std::cout << "exception\tns/catch\tns/catch+format\n";
+	for( auto iter = throwers.begin(); iter != throwers.end(); iter++ ) {
+		double bare = timeCatch( iterations, false, iter->second );
+		double formatted = timeCatch( iterations, true, iter->second );
+		std::cout << iter->first
+			<< "\t" << std::fixed << std::setprecision( 1 ) << bare
+			<< "\t" << formatted << "\n";
+	}
+	return( 0 );
+}
+
+/**
+ *	The sampled hashes CFLib::hash() used before it hashed the full input,
+ *	kept so the benchmark can show the difference.
+ */
+static size_t sampledUuidHash( const unsigned char* value ) {
+	return( ( ( ((size_t)( value[0] )) & 0x0f ) << 24 )
+		+ ( ( ((size_t)( value[3] )) & 0x0f ) << 16 )
+		+ ( ( ((size_t)( value[9] )) & 0x0f ) << 8 )
+		+ ( ((size_t)( value[15] ) & 0x0f ) ) );
+}
+
+static size_t sampledBytesHash( const unsigned char* value, size_t len ) {
+	if( len > 4 ) {
+		return( ( value[len - 1] << 24 ) + ( value[( len / 4 ) * 2] << 16 ) + ( value[len / 4] << 8 ) + value[0] );
+	}
+	else if( len > 2 ) {
+		return( ( value[2] << 16 ) + ( value[1] << 8 ) + value[0] );
+	}
+	else if( len > 1 ) {
+		return( ( value[1] << 16 ) + value[0] );
+	}
+	else if( len == 1 ) {
+		return( value[0] );
+	}
+	return( 0 );
+}
+
+/**
+ *	Hash every key, then report the time per hash, the number of distinct
+ *	hashes, and the longest chain the keys would form in a table with one
+ *	bucket per key.
+ */
+static void reportHash( const std::string& keyKind,
+	const std::string& hashName,
+	const std::vector<std::string>& keys,
+	const std::function<size_t( const std::string& )>& hasher )
+{
+	std::vector<size_t> hashes( keys.size() );
+	std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+	for( size_t i = 0; i < keys.size(); i++ ) {
+		hashes[i] = hasher( keys[i] );
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - started;
+
+	std::unordered_set<size_t> distinct( hashes.begin(), hashes.end() );
+	std::vector<uint32_t> buckets( keys.size(), 0 );
+	uint32_t longestChain = 0;
+	for( size_t i = 0; i < hashes.size(); i++ ) {
+		uint32_t chain = ++ buckets[hashes[i] % buckets.size()];
+		if( chain > longestChain ) {
+			longestChain = chain;
+		}
+	}
+	std::cout << keyKind << "\t" << hashName
+		<< "\t" << std::fixed << std::setprecision( 1 ) << ( elapsed.count() / keys.size() )
+		<< "\t" << distinct.size()
+		<< "\t" << longestChain << "\n";
+}
+
+static int benchHash( size_t keyCount ) {
+	std::vector<std::string> randomUuids;
+	std::vector<std::string> timeUuids;
+	std::vector<std::string> names;
+	std::vector<std::string> blobs;
+	uuid_t uuid;
+	char name[64];
+	for( size_t i = 0; i < keyCount; i++ ) {
+		uuid_generate_random( uuid );
+		randomUuids.push_back( std::string( (const char*)uuid, sizeof( uuid_t ) ) );
+		uuid_generate_time( uuid );
+		timeUuids.push_back( std::string( (const char*)uuid, sizeof( uuid_t ) ) );
+		snprintf( name, sizeof( name ), "SecUser.%zu.EMailAddress", i );
+		names.push_back( std::string( name ) );
+		std::string blob( 64, '\0' );
+		memcpy( &blob[24], &i, sizeof( i ) );
+		blobs.push_back( blob );
+	}
+
+	std::function<size_t( const std::string& )> sampledUuid = []( const std::string& key ) {
+		return( sampledUuidHash( (const unsigned char*)key.data() ) );
+	};
+	std::function<size_t( const std::string& )> fullUuid = []( const std::string& key ) {
+		return( cflib::CFLib::hash( (const uuid_ptr_t)key.data() ) );
+	};
+	std::function<size_t( const std::string& )> sampledBytes = []( const std::string& key ) {
+		return( sampledBytesHash( (const unsigned char*)key.data(), key.length() ) );
+	};
+	std::function<size_t( const std::string& )> fullBytes = []( const std::string& key ) {
+		return( cflib::CFLib::hash( key ) );
+	};
+
+	std::cout << "Hashing " << keyCount << " keys of each kind\n";
+	std::cout << "keys\thash\tns/hash\tdistinct\tlongest chain\n";
+	reportHash( "uuid_generate_random", "sampled", randomUuids, sampledUuid );
+	reportHash( "uuid_generate_random", "full", randomUuids, fullUuid );
+	reportHash( "uuid_generate_time", "sampled", timeUuids, sampledUuid );
+	reportHash( "uuid_generate_time", "full", timeUuids, fullUuid );
+	reportHash( "names", "sampled", names, sampledBytes );
+	reportHash( "names", "full", names, fullBytes );
+	reportHash( "64-byte blobs", "sampled", blobs, sampledBytes );
+	reportHash( "64-byte blobs", "full", blobs, fullBytes );
+	return( 0 );
+}
+
+static void reportMap( const std::string& mapName,
+	const std::string& opName,
+	size_t ops,
+	const std::chrono::steady_clock::time_point& start,
+	size_t checksum )
+{
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	std::cout << mapName << "\t" << opName
+		<< "\t" << std::fixed << std::setprecision( 1 ) << ( elapsed.count() / ops )
+		<< "\t" << checksum << "\n";
+}
+
+/**
+ *	Insert entryCount random UUIDs into a TCFLibUuidHashMap and into the
+ *	std::unordered_map a cache of primary keys would otherwise use, then
+ *	time hits and misses in shuffled order and erasing half the entries.
+ */
+static int benchUuidMap( size_t entryCount ) {
+	std::vector<unsigned char> keys( entryCount * sizeof( uuid_t ) );
+	std::vector<unsigned char> missingKeys( entryCount * sizeof( uuid_t ) );
+	for( size_t i = 0; i < entryCount; i++ ) {
+		uuid_generate_random( &keys[i * sizeof( uuid_t )] );
+		uuid_generate_random( &missingKeys[i * sizeof( uuid_t )] );
+	}
+	std::vector<size_t> order( entryCount );
+	for( size_t i = 0; i < entryCount; i++ ) {
+		order[i] = i;
+	}
+	std::shuffle( order.begin(), order.end(), std::mt19937_64( 42 ) );
+
+	std::cout << "Mapping " << entryCount << " random UUIDs\n";
+	std::cout << "map\top\tns/op\tchecksum\n";
+
+	{
+		cflib::TCFLibUuidHashMap<size_t> map;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		map.reserve( entryCount );
+		for( size_t i = 0; i < entryCount; i++ ) {
+			map.insert( &keys[i * sizeof( uuid_t )], i );
+		}
+		reportMap( "TCFLibUuidHashMap", "insert", entryCount, start, map.size() );
+
+		size_t checksum = 0;
+		start = std::chrono::steady_clock::now();
+		for( size_t i = 0; i < entryCount; i++ ) {
+			checksum += *map.find( &keys[order[i] * sizeof( uuid_t )] );
+		}
+		reportMap( "TCFLibUuidHashMap", "hit", entryCount, start, checksum );
+
+		checksum = 0;
+		start = std::chrono::steady_clock::now();
+		for( size_t i = 0; i < entryCount; i++ ) {
+			checksum += ( map.find( &missingKeys[i * sizeof( uuid_t )] ) == NULL ) ? 0 : 1;
+		}
+		reportMap( "TCFLibUuidHashMap", "miss", entryCount, start, checksum );
+
+		checksum = 0;
+		start = std::chrono::steady_clock::now();
+		for( size_t i = 0; i < entryCount; i += 2 ) {
+			checksum += map.erase( &keys[order[i] * sizeof( uuid_t )] ) ? 1 : 0;
+		}
+		reportMap( "TCFLibUuidHashMap", "erase", ( entryCount + 1 ) / 2, start, checksum );
+	}
+
+	{
+		std::unordered_map<const unsigned char*, size_t, cflib::CFLibUuidHash, cflib::CFLibUuidEqualTo> map;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		map.reserve( entryCount );
+		for( size_t i = 0; i < entryCount; i++ ) {
+			map.emplace( &keys[i * sizeof( uuid_t )], i );
+		}
+		reportMap( "std::unordered_map", "insert", entryCount, start, map.size() );
+
+		size_t checksum = 0;
+		start = std::chrono::steady_clock::now();
+		for( size_t i = 0; i < entryCount; i++ ) {
+			checksum += map.find( &keys[order[i] * sizeof( uuid_t )] )->second;
+		}
+		reportMap( "std::unordered_map", "hit", entryCount, start, checksum );
+
+		checksum = 0;
+		start = std::chrono::steady_clock::now();
+		for( size_t i = 0; i < entryCount; i++ ) {
+			checksum += ( map.find( &missingKeys[i * sizeof( uuid_t )] ) == map.end() ) ? 0 : 1;
+		}
+		reportMap( "std::unordered_map", "miss", entryCount, start, checksum );
+
+		checksum = 0;
+		start = std::chrono::steady_clock::now();
+		for( size_t i = 0; i < entryCount; i += 2 ) {
+			checksum += map.erase( &keys[order[i] * sizeof( uuid_t )] );
+		}
+		reportMap( "std::unordered_map", "erase", ( entryCount + 1 ) / 2, start, checksum );
+	}
+	return( 0 );
+}
+
+/**
+ *	A small cached-record stand-in for the owning container benchmark.
+ */
+class BenchBuff : public cflib::ICFLibCloneableObj {
+public:
+	uuid_t id;
+	int64_t revision;
+	double amount;
+
+	BenchBuff( int64_t argRevision )
+	: cflib::ICFLibCloneableObj(),
+	  revision( argRevision ),
+	  amount( argRevision * 0.5 )
+	{
+		memset( id, 0, sizeof( id ) );
+		memcpy( id, &argRevision, sizeof( argRevision ) );
+	}
+
+	BenchBuff( const BenchBuff& src )
+	: cflib::ICFLibCloneableObj(),
+	  revision( src.revision ),
+	  amount( src.amount )
+	{
+		memcpy( id, src.id, sizeof( id ) );
+	}
+
+	virtual ~BenchBuff() {
+	}
+
+	virtual cflib::ICFLibCloneableObj* clone() {
+		return( new BenchBuff( *this ) );
+	}
+};
+
+static void reportOwning( const std::string& containerName,
+	const std::string& opName,
+	size_t eltCount,
+	const std::chrono::steady_clock::time_point& start )
+{
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	std::cout << containerName << "\t" << opName
+		<< "\t" << std::fixed << std::setprecision( 1 ) << ( elapsed.count() / eltCount ) << "\n";
+}
+
+/**
+ *	Build, move and destroy a result set of eltCount elements in each of
+ *	the owning containers, and deep copy the TCFLibOwningVector one with
+ *	its copy constructor and with parallelClone().
+ */
+static int benchOwning( size_t eltCount ) {
+	std::cout << "Building " << eltCount << " element result sets\n";
+	std::cout << "container\top\tns/element\n";
+
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		std::TCFLibOwningVector<BenchBuff*>* results = new std::TCFLibOwningVector<BenchBuff*>();
+		for( size_t i = 0; i < eltCount; i++ ) {
+			results->push_back( new BenchBuff( (int64_t)i ) );
+		}
+		reportOwning( "TCFLibOwningVector", "build", eltCount, start );
+		start = std::chrono::steady_clock::now();
+		std::TCFLibOwningVector<BenchBuff*>* copied = new std::TCFLibOwningVector<BenchBuff*>( *results );
+		reportOwning( "TCFLibOwningVector", "copy", eltCount, start );
+		delete copied;
+		start = std::chrono::steady_clock::now();
+		copied = new std::TCFLibOwningVector<BenchBuff*>();
+		copied->parallelClone( *results );
+		reportOwning( "TCFLibOwningVector", "parallelClone", eltCount, start );
+		delete copied;
+		start = std::chrono::steady_clock::now();
+		std::TCFLibOwningVector<BenchBuff*>* moved = new std::TCFLibOwningVector<BenchBuff*>( std::move( *results ) );
+		reportOwning( "TCFLibOwningVector", "move", eltCount, start );
+		delete results;
+		start = std::chrono::steady_clock::now();
+		delete moved;
+		reportOwning( "TCFLibOwningVector", "destroy", eltCount, start );
+	}
+
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		std::TCFLibOwningList<BenchBuff*>* results = new std::TCFLibOwningList<BenchBuff*>();
+		for( size_t i = 0; i < eltCount; i++ ) {
+			results->push_back( new BenchBuff( (int64_t)i ) );
+		}
+		reportOwning( "TCFLibOwningList", "build", eltCount, start );
+		start = std::chrono::steady_clock::now();
+		std::TCFLibOwningList<BenchBuff*>* moved = new std::TCFLibOwningList<BenchBuff*>( std::move( *results ) );
+		reportOwning( "TCFLibOwningList", "move", eltCount, start );
+		delete results;
+		start = std::chrono::steady_clock::now();
+		delete moved;
+		reportOwning( "TCFLibOwningList", "destroy", eltCount, start );
+	}
+
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		cflib::TCFLibArenaVector<BenchBuff>* results = new cflib::TCFLibArenaVector<BenchBuff>();
+		for( size_t i = 0; i < eltCount; i++ ) {
+			results->emplace_back( (int64_t)i );
+		}
+		reportOwning( "TCFLibArenaVector", "build", eltCount, start );
+		start = std::chrono::steady_clock::now();
+		cflib::TCFLibArenaVector<BenchBuff>* moved = new cflib::TCFLibArenaVector<BenchBuff>( std::move( *results ) );
+		reportOwning( "TCFLibArenaVector", "move", eltCount, start );
+		delete results;
+		start = std::chrono::steady_clock::now();
+		delete moved;
+		reportOwning( "TCFLibArenaVector", "destroy", eltCount, start );
+	}
+	return( 0 );
+}
+
+/**
+ *	Sum, count and take the minimum of rowCount nullable int32_t values,
+ *	one in ten null, stored as CFLibNullableInt32 objects and as a
+ *	TCFLibNullableColumn.
+ */
+static int benchColumn( size_t rowCount ) {
+	std::vector<cflib::CFLibNullableInt32> rows( rowCount );
+	cflib::TCFLibNullableColumn<int32_t> column;
+	column.reserve( rowCount );
+	for( size_t i = 0; i < rowCount; i++ ) {
+		if( ( i % 10 ) == 0 ) {
+			column.push_back_null();
+		}
+		else {
+			rows[i].setValue( (int32_t)i );
+			column.push_back( (int32_t)i );
+		}
+	}
+
+	std::cout << "Scanning " << rowCount << " nullable int32_t rows\n";
+	std::cout << "storage\tbytes/row\tns/row\tnon-null\tsum\tmin\n";
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	size_t nonNull = 0;
+	int64_t sum = 0;
+	int32_t min = 0;
+	for( const cflib::CFLibNullableInt32& row : rows ) {
+		if( ! row.isNull() ) {
+			int32_t value = row.getValue();
+			if( ( nonNull == 0 ) || ( value < min ) ) {
+				min = value;
+			}
+			nonNull ++;
+			sum += value;
+		}
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	std::cout << "CFLibNullableInt32\t" << sizeof( cflib::CFLibNullableInt32 )
+		<< "\t" << std::fixed << std::setprecision( 2 ) << ( elapsed.count() / rowCount )
+		<< "\t" << nonNull << "\t" << sum << "\t" << min << "\n";
+
+	start = std::chrono::steady_clock::now();
+	nonNull = column.countNonNull();
+	sum = column.sum();
+	column.min( min );
+	elapsed = std::chrono::steady_clock::now() - start;
+	std::cout << "TCFLibNullableColumn\t" << std::setprecision( 3 ) << ( sizeof( int32_t ) + 1.0 / 8 )
+		<< "\t" << std::setprecision( 2 ) << ( elapsed.count() / rowCount )
+		<< "\t" << nonNull << "\t" << sum << "\t" << min << "\n";
+	return( 0 );
+}
+
+/**
+ *	The mktime() conversion getUTCGregorianCalendarInstance() used before it
+ *	switched to CFLib::daysFromCivil(), kept here for comparison.
+ */
+static std::chrono::system_clock::time_point mktimeGregorian( int year, int month, int day, int hour, int minute, int second ) {
+	struct tm tmRead = { 0 };
+	tmRead.tm_year = year - 1900;
+	tmRead.tm_mon = month - 1;
+	tmRead.tm_mday = day;
+	tmRead.tm_hour = hour;
+	tmRead.tm_min = minute;
+	tmRead.tm_sec = second;
+	return( std::chrono::system_clock::from_time_t( mktime( &tmRead ) ) );
+}
+
+/**
+ *	Run iterations conversions on each of threadCount threads at once and
+ *	report the wall time per conversion.
+ */
+static void reportCivil( const std::string& convName,
+	unsigned long iterations,
+	unsigned threadCount,
+	const std::function<std::chrono::system_clock::time_point( int, int, int, int, int, int )>& convert )
+{
+	std::vector<int64_t> checksums( threadCount, 0 );
+	std::vector<std::thread> workers;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for( unsigned threadIdx = 0; threadIdx < threadCount; threadIdx++ ) {
+		workers.push_back( std::thread( [&checksums, &convert, iterations, threadIdx]() {
+			int64_t checksum = 0;
+			for( unsigned long i = 0; i < iterations; i++ ) {
+				checksum += convert( 1990 + (int)( i % 50 ), 1 + (int)( i % 12 ), 1 + (int)( i % 28 ),
+					(int)( i % 24 ), (int)( i % 60 ), (int)( i % 59 ) ).time_since_epoch().count();
+			}
+			checksums[threadIdx] = checksum;
+		} ) );
+	}
+	for( std::thread& worker : workers ) {
+		worker.join();
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	int64_t checksum = 0;
+	for( int64_t threadChecksum : checksums ) {
+		checksum += threadChecksum;
+	}
+	std::cout << convName << "\t" << threadCount
+		<< "\t" << std::fixed << std::setprecision( 1 ) << ( elapsed.count() / ( (double)iterations * threadCount ) )
+		<< "\t" << checksum << "\n";
+}
+
+static int benchCivil( unsigned long iterations, unsigned threadCount ) {
+	if( threadCount == 0 ) {
+		threadCount = std::thread::hardware_concurrency();
+		if( threadCount == 0 ) {
+			threadCount = 1;
+		}
+	}
+	std::cout << "Converting " << iterations << " UTC calendar times on each of " << threadCount << " threads\n";
+	std::cout << "conversion\tthreads\tns/conversion\tchecksum\n";
+	reportCivil( "mktime", iterations, 1, mktimeGregorian );
+	reportCivil( "daysFromCivil", iterations, 1, cflib::CFLib::getUTCGregorianCalendarInstance );
+	if( threadCount > 1 ) {
+		reportCivil( "mktime", iterations, threadCount, mktimeGregorian );
+		reportCivil( "daysFromCivil", iterations, threadCount, cflib::CFLib::getUTCGregorianCalendarInstance );
+	}
+	return( 0 );
+}
+
+static void reportClock( const std::string& clockName,
+	unsigned long iterations,
+	const std::function<int64_t()>& stamp )
+{
+	int64_t checksum = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for( unsigned long i = 0; i < iterations; i++ ) {
+		checksum ^= stamp();
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	std::cout << clockName
+		<< "\t" << std::fixed << std::setprecision( 1 ) << ( elapsed.count() / iterations )
+		<< "\t" << checksum << "\n";
+}
+
+/**
+ *	Time the per-call cost of each way of stamping the current UTC time.
+ */
+static int benchClock( unsigned long iterations ) {
+	std::cout << "Reading the UTC time " << iterations << " times\n";
+	std::cout << "Coarse clock resolution "
+		<< cflib::CFLib::getUTCTimestampResolution( cflib::CFLib::CLOCK_COARSE ).count() << " ns\n";
+	std::cout << "clock\tns/call\tchecksum\n";
+	reportClock( "getUTCTimestamp", iterations, []() {
+		std::chrono::system_clock::time_point* stamp = cflib::CFLib::getUTCTimestamp();
+		int64_t count = stamp->time_since_epoch().count();
+		delete stamp;
+		return( count );
+	} );
+	reportClock( "getUTCTimestampInstance", iterations, []() {
+		return( (int64_t)cflib::CFLib::getUTCTimestampInstance().time_since_epoch().count() );
+	} );
+	reportClock( "CLOCK_COARSE", iterations, []() {
+		return( (int64_t)cflib::CFLib::getUTCTimestampInstance( cflib::CFLib::CLOCK_COARSE ).time_since_epoch().count() );
+	} );
+	return( 0 );
+}
+
+/**
+ *	Time CFLib::getValue() lookups spread across every tag of a
+ *	generated tag=value file.
+ */
+static int benchConfig( unsigned long iterations, unsigned long tagCount ) {
+	std::filesystem::path fileName = std::filesystem::temp_directory_path() / "benchcflib-config.txt";
+	std::vector<std::string> tags;
+	{
+		std::ofstream out( fileName );
+		out << "# Generated by benchcflib config\n";
+		for( unsigned long i = 0; i < tagCount; i++ ) {
+			tags.push_back( "TAG" + std::to_string( i ) );
+			out << tags.back() << "=\"value-" << i << "\"\n";
+		}
+	}
+	std::cout << "Looking up " << iterations << " values among " << tagCount << " tags\n";
+	char value[64];
+	size_t checksum = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for( unsigned long i = 0; i < iterations; i++ ) {
+		if( cflib::CFLib::getValue( fileName.c_str(), tags[ i % tagCount ].c_str(), value, sizeof( value ) ) != NULL ) {
+			checksum += strlen( value );
+		}
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	std::filesystem::remove( fileName );
+	std::cout << "getValue\t" << std::fixed << std::setprecision( 1 ) << ( elapsed.count() / iterations )
+		<< " ns/call\t" << checksum << "\n";
+	return( 0 );
+}
+
+int main( int argc, char* argv[] ) {
+
+	if( argc < 1 ) {
+		std::cerr << CLASS_NAME + " ERROR: Program name is not available\n";
+		return( 1 );
+	}
+	std::string S_ProcName( argv[0] );
+	CFLIB_EXCEPTION_DECLINFO
+
+	if( argc < 2 ) {
+		usage( S_ProcName );
+		return( 1 );
+	}
+	std::string command( argv[1] );
+
+	cflib::CFLib::init();
+
+	int retval = 0;
+
+	try {
+		if( ( command == "parse" ) && ( ( argc == 3 ) || ( argc == 4 ) ) ) {
+			retval = benchParse( argv[2], ( argc == 4 ) ? argv[3] : "" );
+		}
+		else if( ( command == "split" ) && ( ( argc == 3 ) || ( argc == 4 ) ) ) {
+			retval = benchSplit( argv[2], ( argc == 4 ) ? argv[3] : "" );
+		}
+		else if( ( command == "throw" ) && ( ( argc == 2 ) || ( argc == 3 ) ) ) {
+			retval = benchThrow( ( argc == 3 ) ? std::stoul( argv[2] ) : 1000000UL );
+		}
+		else if( ( command == "catch" ) && ( ( argc == 2 ) || ( argc == 3 ) ) ) {
+			retval = benchCatch( ( argc == 3 ) ? std::stoul( argv[2] ) : 1000000UL );
+		}
+		else if( ( command == "hash" ) && ( ( argc == 2 ) || ( argc == 3 ) ) ) {
+			retval = benchHash( ( argc == 3 ) ? std::stoul( argv[2] ) : 1000000UL );
+		}
+		else if( ( command == "uuidmap" ) && ( ( argc == 2 ) || ( argc == 3 ) ) ) {
+			retval = benchUuidMap( ( argc == 3 ) ? std::stoul( argv[2] ) : 1000000UL );
+		}
+		else if( ( command == "owning" ) && ( ( argc == 2 ) || ( argc == 3 ) ) ) {
+			retval = benchOwning( ( argc == 3 ) ? std::stoul( argv[2] ) : 1000000UL );
+		}
+		else if( ( command == "column" ) && ( ( argc == 2 ) || ( argc == 3 ) ) ) {
+			retval = benchColumn( ( argc == 3 ) ? std::stoul( argv[2] ) : 10000000UL );
+		}
+		else if( ( command == "civil" ) && ( ( argc >= 2 ) && ( argc <= 4 ) ) ) {
+			retval = benchCivil( ( argc >= 3 ) ? std::stoul( argv[2] ) : 1000000UL,
+				( argc == 4 ) ? (unsigned)std::stoul( argv[3] ) : 0 );
+		}
+		else if( ( command == "clock" ) && ( ( argc == 2 ) || ( argc == 3 ) ) ) {
+			retval = benchClock( ( argc == 3 ) ? std::stoul( argv[2] ) : 10000000UL );
+		}
+		else if( ( command == "config" ) && ( ( argc >= 2 ) && ( argc <= 4 ) ) ) {
+			retval = benchConfig( ( argc >= 3 ) ? std::stoul( argv[2] ) : 1000000UL,
+				( argc == 4 ) ? std::max( std::stoul( argv[3] ), 1UL ) : 100UL );
+		}
+		else {
+			usage( S_ProcName );
+			retval = 1;
+		}
+	}
+	CFLIB_EXCEPTION_CATCH_FALLTHROUGH
+
+	if( ! CFLIB_EXCEPTION_EMPTY ) {
+		std::cerr << S_ProcName + " EXCEPTION: " + CFLIB_EXCEPTION_FORMATTEDMESSAGE + "\n";
+		retval = 1;
+	}
+
+	try {
+		cflib::CFLib::release();
+	}
+	catch( ... ) {
+	}
+
+	return( retval );
+}
@@ -1,3 +1,5 @@
+// Description: Renders a CFLibBinaryMessageLog file as text.
+
 /*
  *  MSS Code Factory CFLib 2.13
  *
@@ -24,52 +26,53 @@
  *	Please contact Mark Stephen Sobkow at mark.sobkow@gmail.com for commercial licensing.
  */
 
-#include <cflib/CFLib.hpp>
-#include <cflib/CFLibNullableUInt32.hpp>
-#include <cflib/CFLibNullArgumentException.hpp>
-
-namespace cflib {
+using namespace std;
 
-const std::string CFLibNullableUInt32::CLASS_NAME( "CFLibNullableUInt32" );;
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <string>
 
-CFLibNullableUInt32::CFLibNullableUInt32() {
-	value = 0;
-}
+#include <cflib/ICFLibPublic.hpp>
 
-CFLibNullableUInt32::CFLibNullableUInt32( const uint32_t arg ) {
-	setNullFlag( false );
-	value = arg;
-}
+static const std::string CLASS_NAME( "DecodeCFLibLog" );
 
-CFLibNullableUInt32::~CFLibNullableUInt32() {
-}
+int main( int argc, char* argv[] ) {
 
-const uint32_t CFLibNullableUInt32::getValue() const {
-	if( nullFlag ) {
-		throw CFLibNullArgumentException( CLASS_NAME,
-			S_GET_VALUE,
-			0,
-			S_VALUE );
+	if( argc < 1 ) {
+		std::cerr << CLASS_NAME + " ERROR: Program name is not available\n";
+		return( 1 );
 	}
-	return( value );
-}
+	std::string S_ProcName( argv[0] );
+	CFLIB_EXCEPTION_DECLINFO
 
-const uint32_t* CFLibNullableUInt32::getReference() const {
-	if( nullFlag ) {
-		return( NULL );
+	if( argc < 2 ) {
+		std::cerr << "Usage: " << S_ProcName << " <binary-log> ...\n";
+		return( 1 );
 	}
-	else {
-		return( &value );
-	}
-}
 
-void CFLibNullableUInt32::setValue( const uint32_t arg ) {
-	setNullFlag( false );
-	value = arg;
-}
+	cflib::CFLib::init();
 
-void CFLibNullableUInt32::setNull() {
-	setNullFlag( true );
-}
+	int retval = 0;
+
+	for( int argIdx = 1; argIdx < argc; argIdx++ ) {
+		try {
+			cflib::CFLibBinaryMessageLog::decodeFile( argv[argIdx], std::cout );
+		}
+		CFLIB_EXCEPTION_CATCH_FALLTHROUGH
+
+		if( ! CFLIB_EXCEPTION_EMPTY ) {
+			std::cerr << S_ProcName + " EXCEPTION: " + CFLIB_EXCEPTION_FORMATTEDMESSAGE + "\n";
+			CFLIB_EXCEPTION_RESET
+			retval = 1;
+		}
+	}
+
+	try {
+		cflib::CFLib::release();
+	}
+	catch( ... ) {
+	}
 
+	return( retval );
 }
@@ -28,19 +28,202 @@
 
 using namespace std;
 
+#include <unistd.h>
+
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <chrono>
+#include <cstring>
 #include <ctime>
+#include <fstream>
 #include <functional>
+#include <limits>
 #include <list>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <cflib/ICFLibPublic.hpp>
 
 static const std::string CLASS_NAME( "TestCFLib" );
 
+/**
+ *	A cloneable element that counts its live instances, and whose clone()
+ *	can be made to fail after a given number of calls.
+ */
+class TestCloneable : public cflib::ICFLibCloneableObj {
+public:
+	static std::atomic<int64_t> liveCount;
+	static std::atomic<int64_t> clonesBeforeFailure;
+
+	int64_t value;
+
+	TestCloneable( int64_t argValue )
+	: cflib::ICFLibCloneableObj(),
+	  value( argValue )
+	{
+		liveCount ++;
+	}
+
+	virtual ~TestCloneable() {
+		liveCount --;
+	}
+
+	virtual cflib::ICFLibCloneableObj* clone() {
+		if( clonesBeforeFailure.fetch_sub( 1 ) == 0 ) {
+			throw std::runtime_error( "TestCloneable clone() failure" );
+		}
+		return( new TestCloneable( value ) );
+	}
+};
+
+std::atomic<int64_t> TestCloneable::liveCount( 0 );
+std::atomic<int64_t> TestCloneable::clonesBeforeFailure( -1 );
+
+/**
+ *	A map value that counts its live instances, and whose copy constructor
+ *	can be made to fail after a given number of copies.  Its move
+ *	constructor is not noexcept, so containers must copy it to stay
+ *	exception safe.
+ */
+class TestCopyable {
+public:
+	static int64_t liveCount;
+	static int64_t copiesBeforeFailure;
+
+	int64_t value;
+
+	TestCopyable()
+	: value( 0 )
+	{
+		liveCount ++;
+	}
+
+	TestCopyable( int64_t argValue )
+	: value( argValue )
+	{
+		liveCount ++;
+	}
+
+	TestCopyable( const TestCopyable& src )
+	: value( src.value )
+	{
+		if( copiesBeforeFailure -- == 0 ) {
+			throw std::runtime_error( "TestCopyable copy failure" );
+		}
+		liveCount ++;
+	}
+
+	TestCopyable( TestCopyable&& src )
+	: value( src.value )
+	{
+		liveCount ++;
+	}
+
+	~TestCopyable() {
+		liveCount --;
+	}
+};
+
+int64_t TestCopyable::liveCount( 0 );
+int64_t TestCopyable::copiesBeforeFailure( -1 );
+
+/**
+ *	Parse text and format it again, entirely in a constant expression.
+ *
+ *	@returns	true if text parsed and formatted as expected.
+ */
+static constexpr bool uuidParsesAs( std::string_view text, std::string_view expected ) {
+	cflib::CFLibUuid parsed;
+	if( ! cflib::CFLibUuid::tryParse( text, parsed ) ) {
+		return( false );
+	}
+	char formatted[ cflib::CFLibUuid::FORMATTED_LENGTH ] = {};
+	parsed.format( formatted );
+	for( size_t i = 0; i < cflib::CFLibUuid::FORMATTED_LENGTH; i++ ) {
+		if( formatted[i] != expected[i] ) {
+			return( false );
+		}
+	}
+	return( true );
+}
+
+static constexpr bool uuidRejects( std::string_view text ) {
+	cflib::CFLibUuid parsed;
+	return( ! cflib::CFLibUuid::tryParse( text, parsed ) );
+}
+
+static_assert( uuidParsesAs( "0f8fad5b-d9cb-469f-a165-70867728950e", "0f8fad5b-d9cb-469f-a165-70867728950e" ), "CFLibUuid must parse at compile time" );
+static_assert( uuidParsesAs( "0F8FAD5B-D9CB-469F-A165-70867728950E", "0f8fad5b-d9cb-469f-a165-70867728950e" ), "CFLibUuid must parse upper case hex" );
+static_assert( uuidParsesAs( "00000000-0000-0000-0000-000000000000", "00000000-0000-0000-0000-000000000000" ), "CFLibUuid must parse the nil UUID" );
+static_assert( uuidRejects( "0f8fad5b-d9cb-469f-a165-70867728950g" ), "CFLibUuid must reject a non-hex digit" );
+static_assert( uuidRejects( "0f8fad5b-d9cb-469f-a165-70867728950" ), "CFLibUuid must reject short text" );
+static_assert( uuidRejects( "0f8fad5bd-9cb-469f-a165-70867728950e" ), "CFLibUuid must reject a misplaced hyphen" );
+static_assert( uuidRejects( "" ), "CFLibUuid must reject empty text" );
+
+static_assert( cflib::CFLibNullableInt32().isNull(), "A default CFLibNullableInt32 must be null" );
+static_assert( cflib::CFLibNullableInt32( 42 ).getValue() == 42, "CFLibNullableInt32 must be usable in constant expressions" );
+static_assert( cflib::CFLibPackedNullableDouble().isNull(), "A default CFLibPackedNullableDouble must be null" );
+static_assert( ! cflib::CFLibPackedNullableDouble( 0.0 ).isNull(), "A zero CFLibPackedNullableDouble must not be null" );
+static_assert( sizeof( cflib::CFLibPackedNullableFloat ) == sizeof( float ), "CFLibPackedNullableFloat must carry no flag" );
+
+/**
+ *	Arena elements of different sizes and alignments, counting their live
+ *	instances.  TestArenaBig is larger than the small chunks the test uses.
+ */
+class TestArenaElt {
+public:
+	static int64_t liveCount;
+
+	int64_t value;
+
+	TestArenaElt( int64_t argValue )
+	: value( argValue )
+	{
+		if( argValue < 0 ) {
+			throw std::runtime_error( "TestArenaElt negative value" );
+		}
+		liveCount ++;
+	}
+
+	virtual ~TestArenaElt() {
+		liveCount --;
+	}
+
+	virtual size_t alignment() const {
+		return( alignof( TestArenaElt ) );
+	}
+};
+
+int64_t TestArenaElt::liveCount( 0 );
+
+class alignas( alignof( std::max_align_t ) ) TestArenaAligned : public TestArenaElt {
+public:
+	char padding[ 3 ];
+
+	TestArenaAligned( int64_t argValue )
+	: TestArenaElt( argValue )
+	{
+	}
+
+	virtual size_t alignment() const {
+		return( alignof( TestArenaAligned ) );
+	}
+};
+
+class TestArenaBig : public TestArenaElt {
+public:
+	char payload[ 1000 ];
+
+	TestArenaBig( int64_t argValue )
+	: TestArenaElt( argValue )
+	{
+		memset( payload, (int)( argValue & 0x7f ), sizeof( payload ) );
+	}
+};
+
 int main( int argc, char* argv[] ) {
 
 	if( argc < 1 ) {
@@ -713,6 +896,1159 @@ int main( int argc, char* argv[] ) {
 		else {
 			std::cout << "Success! cflibTenRemainderFive is " << cflibTenRemainderFive.toString() << "\n";
 		}
+
+		// The wyhash final4 reference test vectors: each message hashed with its index as the seed
+		static const char* const hashMessages[7] = {
+			"",
+			"a",
+			"abc",
+			"message digest",
+			"abcdefghijklmnopqrstuvwxyz",
+			"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+			"12345678901234567890123456789012345678901234567890123456789012345678901234567890"
+		};
+		static const uint64_t hashExpected[7] = {
+			0x93228a4de0eec5a2ULL,
+			0xc5bac3db178713c4ULL,
+			0xa97f2f7b1d9b3314ULL,
+			0x786d1f1df3801df4ULL,
+			0xdca5a8138ad37c87ULL,
+			0xb9e734f117cfaf70ULL,
+			0x6cc5eab49a92d617ULL
+		};
+		for( int hashIdx = 0; hashIdx < 7; hashIdx++ ) {
+			uint64_t hashed = cflib::CFLib::hashBytes( hashMessages[hashIdx], strlen( hashMessages[hashIdx] ), hashIdx );
+			if( hashed != hashExpected[hashIdx] ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! hashBytes( \"" << hashMessages[hashIdx] << "\", " << hashIdx << " ) is " << std::hex << hashed << ", should be " << hashExpected[hashIdx] << std::dec << "\n";
+			}
+			else {
+				std::cout << "Success! hashBytes( \"" << hashMessages[hashIdx] << "\", " << hashIdx << " ) is " << std::hex << hashed << std::dec << "\n";
+			}
+		}
+
+		// parallelClone() must keep the order and the NULL entries, and delete
+		// every clone it made when one clone() fails
+		{
+			const size_t cloneCount = ( 3 * std::TCFLibOwningVector<TestCloneable*>::PARALLEL_CLONE_CHUNK ) + 5;
+			cflib::CFLibWorkerPool clonePool( 3 );
+			std::TCFLibOwningVector<TestCloneable*> originals;
+			for( size_t i = 0; i < cloneCount; i++ ) {
+				originals.push_back( ( ( i % 7 ) == 0 ) ? NULL : new TestCloneable( (int64_t)i ) );
+			}
+			int64_t originalCount = TestCloneable::liveCount.load();
+
+			std::TCFLibOwningVector<TestCloneable*> clones;
+			clones.parallelClone( originals, clonePool );
+			bool clonesMatch = ( clones.size() == cloneCount );
+			for( size_t i = 0; clonesMatch && ( i < cloneCount ); i++ ) {
+				if( ( i % 7 ) == 0 ) {
+					clonesMatch = ( clones[i] == NULL );
+				}
+				else {
+					clonesMatch = ( clones[i] != NULL ) && ( clones[i] != originals[i] ) && ( clones[i]->value == (int64_t)i );
+				}
+			}
+			if( ! clonesMatch ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! parallelClone() did not reproduce the " << cloneCount << " elements in order\n";
+			}
+			else {
+				std::cout << "Success! parallelClone() reproduced the " << cloneCount << " elements in order\n";
+			}
+
+			TestCloneable::clonesBeforeFailure.store( (int64_t)( cloneCount / 2 ) );
+			bool cloneThrew = false;
+			try {
+				clones.parallelClone( originals, clonePool );
+			}
+			catch( const std::runtime_error& e ) {
+				cloneThrew = true;
+			}
+			TestCloneable::clonesBeforeFailure.store( -1 );
+			if( ( ! cloneThrew )
+				|| ( TestCloneable::liveCount.load() != ( 2 * originalCount ) )
+				|| ( clones.size() != cloneCount )
+				|| ( clones[1]->value != 1 ) )
+			{
+				anyTestsFailed = true;
+				std::cout << "Failed! parallelClone() did not roll back after a clone() failure, "
+					<< TestCloneable::liveCount.load() << " elements are live, should be " << ( 2 * originalCount ) << "\n";
+			}
+			else {
+				std::cout << "Success! parallelClone() rolled back after a clone() failure\n";
+			}
+		}
+
+		// daysFromCivil() against known day counts, including dates before 1970
+		// and leap days of years divisible by 100 and 400
+		{
+			static const int civilDates[8][3] = {
+				{ 1970, 1, 1 },
+				{ 1969, 12, 31 },
+				{ 2000, 2, 29 },
+				{ 2000, 3, 1 },
+				{ 1900, 2, 28 },
+				{ 1900, 3, 1 },
+				{ 1600, 2, 29 },
+				{ 1, 1, 1 }
+			};
+			static const int64_t civilDays[8] = { 0, -1, 11016, 11017, -25509, -25508, -135081, -719162 };
+			for( int civilIdx = 0; civilIdx < 8; civilIdx++ ) {
+				int64_t days = cflib::CFLib::daysFromCivil( civilDates[civilIdx][0], civilDates[civilIdx][1], civilDates[civilIdx][2] );
+				if( days != civilDays[civilIdx] ) {
+					anyTestsFailed = true;
+					std::cout << "Failed! daysFromCivil( " << civilDates[civilIdx][0] << ", " << civilDates[civilIdx][1] << ", " << civilDates[civilIdx][2]
+						<< " ) is " << days << ", should be " << civilDays[civilIdx] << "\n";
+				}
+				else {
+					std::cout << "Success! daysFromCivil( " << civilDates[civilIdx][0] << ", " << civilDates[civilIdx][1] << ", " << civilDates[civilIdx][2]
+						<< " ) is " << days << "\n";
+				}
+			}
+		}
+
+		// getUTCGregorianCalendarInstance() round trips through gmtime_r() and
+		// timegm() for every day from 1700-01-01 through 2200-12-31, which
+		// stays inside the range of a nanosecond system_clock::time_point
+		{
+			const int64_t firstDay = cflib::CFLib::daysFromCivil( 1700, 1, 1 );
+			const int64_t lastDay = cflib::CFLib::daysFromCivil( 2200, 12, 31 );
+			int64_t mismatches = 0;
+			for( int64_t day = firstDay; day <= lastDay; day++ ) {
+				int64_t secondOfDay = ( day * 7919 ) % 86400;
+				if( secondOfDay < 0 ) {
+					secondOfDay += 86400;
+				}
+				time_t expected = (time_t)( ( day * 86400 ) + secondOfDay );
+				struct tm civil;
+				memset( &civil, 0, sizeof( civil ) );
+				if( gmtime_r( &expected, &civil ) == NULL ) {
+					mismatches++;
+					continue;
+				}
+				std::chrono::system_clock::time_point converted = cflib::CFLib::getUTCGregorianCalendarInstance(
+					civil.tm_year + 1900, civil.tm_mon + 1, civil.tm_mday, civil.tm_hour, civil.tm_min, civil.tm_sec );
+				int64_t convertedSeconds = std::chrono::duration_cast<std::chrono::seconds>( converted.time_since_epoch() ).count();
+				if( ( convertedSeconds != (int64_t)expected ) || ( timegm( &civil ) != expected ) ) {
+					if( mismatches == 0 ) {
+						std::cout << "Failed! getUTCGregorianCalendarInstance( " << ( civil.tm_year + 1900 ) << ", " << ( civil.tm_mon + 1 ) << ", " << civil.tm_mday
+							<< ", " << civil.tm_hour << ", " << civil.tm_min << ", " << civil.tm_sec << " ) is " << convertedSeconds << ", should be " << (int64_t)expected << "\n";
+					}
+					mismatches++;
+				}
+			}
+			if( mismatches != 0 ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! getUTCGregorianCalendarInstance() disagreed with timegm() on " << mismatches << " days\n";
+			}
+			else {
+				std::cout << "Success! getUTCGregorianCalendarInstance() agreed with timegm() on " << ( lastDay - firstDay + 1 ) << " days\n";
+			}
+		}
+
+		// Out of range months and days carry into the neighbouring month or year
+		{
+			static const int carryDates[5][6] = {
+				{ 1969, 12, 31, 23, 59, 59 },
+				{ 1999, 13, 1, 0, 0, 0 },
+				{ 2000, 0, 1, 0, 0, 0 },
+				{ 1900, 2, 29, 0, 0, 0 },
+				{ 2000, 3, 0, 0, 0, 0 }
+			};
+			static const int carryExpected[5][6] = {
+				{ 1969, 12, 31, 23, 59, 59 },
+				{ 2000, 1, 1, 0, 0, 0 },
+				{ 1999, 12, 1, 0, 0, 0 },
+				{ 1900, 3, 1, 0, 0, 0 },
+				{ 2000, 2, 29, 0, 0, 0 }
+			};
+			for( int carryIdx = 0; carryIdx < 5; carryIdx++ ) {
+				const int* in = carryDates[carryIdx];
+				const int* out = carryExpected[carryIdx];
+				std::chrono::system_clock::time_point carried = cflib::CFLib::getUTCGregorianCalendarInstance( in[0], in[1], in[2], in[3], in[4], in[5] );
+				std::chrono::system_clock::time_point normal = cflib::CFLib::getUTCGregorianCalendarInstance( out[0], out[1], out[2], out[3], out[4], out[5] );
+				if( carried != normal ) {
+					anyTestsFailed = true;
+					std::cout << "Failed! getUTCGregorianCalendarInstance( " << in[0] << ", " << in[1] << ", " << in[2]
+						<< " ) should be " << out[0] << "-" << out[1] << "-" << out[2] << "\n";
+				}
+				else {
+					std::cout << "Success! getUTCGregorianCalendarInstance( " << in[0] << ", " << in[1] << ", " << in[2]
+						<< " ) is " << out[0] << "-" << out[1] << "-" << out[2] << "\n";
+				}
+			}
+			std::chrono::system_clock::time_point beforeEpoch = cflib::CFLib::getUTCGregorianCalendarInstance( 1969, 12, 31, 23, 59, 59 );
+			if( std::chrono::duration_cast<std::chrono::seconds>( beforeEpoch.time_since_epoch() ).count() != -1 ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! 1969-12-31 23:59:59 UTC should be -1 seconds since the epoch\n";
+			}
+			else {
+				std::cout << "Success! 1969-12-31 23:59:59 UTC is -1 seconds since the epoch\n";
+			}
+		}
+
+		// The DB server time is dbServerTZOffsetSeconds east of UTC, and the two
+		// conversions are exact inverses that keep sub-second precision
+		{
+			time_t savedOffset = cflib::CFLibDbUtil::getDbServerTZOffsetSeconds();
+			static const time_t dbOffsets[3] = { 3600, -18000, 0 };
+			std::chrono::system_clock::time_point utc = cflib::CFLib::getUTCGregorianCalendarInstance( 1969, 12, 31, 23, 30, 0 )
+				+ std::chrono::duration_cast<std::chrono::system_clock::duration>( std::chrono::microseconds( 123456 ) );
+			for( int offsetIdx = 0; offsetIdx < 3; offsetIdx++ ) {
+				cflib::CFLibDbUtil::setDbServerTZOffsetSeconds( dbOffsets[offsetIdx] );
+				std::chrono::system_clock::time_point server = cflib::CFLibDbUtil::getDbServerTimeFromUTCTimeInstance( utc );
+				std::chrono::system_clock::time_point roundTrip = cflib::CFLibDbUtil::getUTCTimeFromDBServerTimeInstance( server );
+				if( ( server - utc ) != std::chrono::seconds( dbOffsets[offsetIdx] ) ) {
+					anyTestsFailed = true;
+					std::cout << "Failed! getDbServerTimeFromUTCTimeInstance() with an offset of " << dbOffsets[offsetIdx] << " seconds did not add the offset\n";
+				}
+				else if( roundTrip != utc ) {
+					anyTestsFailed = true;
+					std::cout << "Failed! getUTCTimeFromDBServerTimeInstance() with an offset of " << dbOffsets[offsetIdx] << " seconds did not invert the conversion\n";
+				}
+				else {
+					std::cout << "Success! DB server time conversions with an offset of " << dbOffsets[offsetIdx] << " seconds round trip\n";
+				}
+			}
+			if( cflib::CFLibDbUtil::getDbServerTimeFromUTCTime( NULL ) != NULL ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! getDbServerTimeFromUTCTime( NULL ) should be NULL\n";
+			}
+			cflib::CFLibDbUtil::setDbServerTZOffsetSeconds( savedOffset );
+		}
+
+		// Only ASCII compatible documents can be split into chunks on their '<' bytes
+		{
+			static const std::string encodingDocs[8] = {
+				std::string( "<?xml version=\"1.0\"?><a/>" ),
+				std::string( "<?xml version=\"1.0\" encoding=\"UTF-8\"?><a/>" ),
+				std::string( "<?xml version='1.0' encoding='iso-8859-1'?><a/>" ),
+				std::string( "\xef\xbb\xbf<a/>" ),
+				std::string( "<?xml version=\"1.0\" encoding=\"Shift_JIS\"?><a/>" ),
+				std::string( "<?xml version=\"1.0\" encoding=\"UTF-16\"?><a/>" ),
+				std::string( "\xff\xfe\x00\x00<\x00\x00\x00", 8 ),
+				std::string( "\x00\x00\xfe\xff\x00\x00\x00<", 8 )
+			};
+			for( int docIdx = 0; docIdx < 8; docIdx++ ) {
+				bool expected = ( docIdx < 4 );
+				if( cflib::CFLibXmlCoreChunkedParser::isSplittableEncoding( encodingDocs[docIdx].data(), encodingDocs[docIdx].length() ) != expected ) {
+					anyTestsFailed = true;
+					std::cout << "Failed! isSplittableEncoding() of document " << docIdx << " should be " << ( expected ? "true" : "false" ) << "\n";
+				}
+				else {
+					std::cout << "Success! isSplittableEncoding() of document " << docIdx << " is " << ( expected ? "true" : "false" ) << "\n";
+				}
+			}
+		}
+
+		// VALIDATION_FIRST_N counts only documents that validate cleanly, so
+		// invalid documents never switch validation off
+		{
+			std::string schemaName( "/tmp/testcflib-" + std::to_string( getpid() ) + ".xsd" );
+			std::string validName( "/tmp/testcflib-" + std::to_string( getpid() ) + "-valid.xml" );
+			std::string invalidName( "/tmp/testcflib-" + std::to_string( getpid() ) + "-invalid.xml" );
+			std::ofstream( schemaName ) << "<?xml version=\"1.0\"?>\n"
+				"<xs:schema xmlns:xs=\"http://www.w3.org/2001/XMLSchema\">\n"
+				"<xs:element name=\"records\"><xs:complexType><xs:sequence>\n"
+				"<xs:element name=\"record\" maxOccurs=\"unbounded\"><xs:complexType>\n"
+				"<xs:attribute name=\"id\" type=\"xs:int\" use=\"required\"/>\n"
+				"</xs:complexType></xs:element>\n"
+				"</xs:sequence></xs:complexType></xs:element>\n"
+				"</xs:schema>\n";
+			std::string docHead( "<?xml version=\"1.0\"?>\n<records xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\""
+				" xsi:noNamespaceSchemaLocation=\"" + schemaName + "\">\n" );
+			std::ofstream( validName ) << docHead << "<record id=\"1\"/>\n</records>\n";
+			std::ofstream( invalidName ) << docHead << "<record id=\"one\"/>\n</records>\n";
+
+			cflib::CFLibCachedMessageLog validationLog;
+			cflib::CFLibXmlRecordReader validationReader( &validationLog );
+			validationReader.setValidationMode( cflib::CFLibXmlCoreSaxParser::VALIDATION_FIRST_N );
+			validationReader.setValidateFirstCount( 1 );
+			static const bool docIsValid[4] = { false, false, true, false };
+			bool validationKept = true;
+			for( int docIdx = 0; docIdx < 4; docIdx++ ) {
+				validationLog.clearCache();
+				validationReader.open( docIsValid[docIdx] ? validName : invalidName );
+				while( validationReader.next() ) {
+				}
+				validationReader.close();
+				bool errorLogged = ( validationLog.getCacheContents().find( "ERROR" ) != std::string::npos );
+				// The first two invalid documents must be validated and reported;
+				// once the valid one is counted, validation is off
+				if( errorLogged != ( docIdx < 2 ) ) {
+					validationKept = false;
+				}
+			}
+			if( ( ! validationKept ) || ( validationReader.getDocumentsValidated() != 1 ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! VALIDATION_FIRST_N counted " << validationReader.getDocumentsValidated()
+					<< " documents as validated, should be 1 after two invalid and one valid document\n";
+			}
+			else {
+				std::cout << "Success! VALIDATION_FIRST_N kept validating invalid documents until one validated\n";
+			}
+			remove( invalidName.c_str() );
+			remove( validName.c_str() );
+			remove( schemaName.c_str() );
+		}
+
+		// An exception's text is only formatted when first asked for, but what() and the
+		// formatted message must still read the same as when they were built eagerly.
+		try {
+			throw cflib::CFLibArgumentRangeException( std::string( "TestClass" ),
+				std::string( "testMethod" ),
+				3,
+				std::string( "argValue" ),
+				static_cast<int64_t>( 42 ),
+				static_cast<int64_t>( 0 ),
+				static_cast<int64_t>( 10 ) );
+		}
+		catch( cflib::CFLibArgumentRangeException& e ) {
+			cflib::CFLibArgumentRangeException beforeWhat( e );
+			std::string whatText( e.what() );
+			std::string messageText( e.getFormattedMessage() );
+			if( whatText != messageText ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! Deferred what() \"" << whatText
+					<< "\" differs from getFormattedMessage() \"" << messageText << "\"\n";
+			}
+			else if( e.getArgValueString() != "42"
+				|| e.getArgMinValueString() != "0"
+				|| e.getArgMaxValueString() != "10"
+				|| whatText.find( e.getMessageText() ) == std::string::npos )
+			{
+				anyTestsFailed = true;
+				std::cout << "Failed! Deferred argument values formatted as \"" << e.getArgValueString()
+					<< "\", \"" << e.getArgMinValueString() << "\", \"" << e.getArgMaxValueString()
+					<< "\" in \"" << whatText << "\"\n";
+			}
+			else if( whatText != beforeWhat.what() || e.what() != e.what() ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! A copy taken before what() was called formatted \"" << beforeWhat.what()
+					<< "\", should be \"" << whatText << "\"\n";
+			}
+			else {
+				std::cout << "Success! Deferred exception text matches getFormattedMessage(): " << whatText << "\n";
+			}
+		}
+
+		// Each tryParse method must agree with its throwing parse counterpart: the same value for
+		// good content, STATUS_NULL where parse returns NULL, and an error where parse throws.
+		{
+			int parseMismatches = 0;
+			auto compareParse = [&parseMismatches]( const std::string& methodName, const std::string& value, auto tryParser, auto parser ) {
+				auto result = tryParser( value );
+				auto parsed = decltype( parser( value ) )( NULL );
+				bool parseThrew = false;
+				try {
+					parsed = parser( value );
+				}
+				catch( cflib::CFLibInvalidArgumentException& ) {
+					parseThrew = true;
+				}
+				bool agrees;
+				if( parseThrew ) {
+					agrees = result.isError();
+				}
+				else if( parsed == NULL ) {
+					agrees = result.isNull();
+				}
+				else {
+					agrees = result.isOk() && ( result.getValue() == *parsed );
+				}
+				delete parsed;
+				if( ! agrees ) {
+					parseMismatches ++;
+					std::cout << "Failed! " << methodName << "( \"" << value << "\" ) disagrees with its parse method, status "
+						<< result.getStatus().getStatusCode() << ( parseThrew ? ", parse threw\n" : "\n" );
+				}
+			};
+
+			static const char* intValues[] = { "0", "12345", "-42", "+7", "", "12a", "abc", "1.5" };
+			for( const char* value : intValues ) {
+				compareParse( "tryParseInt16", value,
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::tryParseInt16( v ) ); },
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::parseInt16( v ) ); } );
+				compareParse( "tryParseInt32", value,
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::tryParseInt32( v ) ); },
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::parseInt32( v ) ); } );
+				compareParse( "tryParseInt64", value,
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::tryParseInt64( v ) ); },
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::parseInt64( v ) ); } );
+			}
+
+			static const char* uintValues[] = { "0", "12345", "65535", "", "12a", "-1", "1.5" };
+			for( const char* value : uintValues ) {
+				compareParse( "tryParseUInt16", value,
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::tryParseUInt16( v ) ); },
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::parseUInt16( v ) ); } );
+				compareParse( "tryParseUInt32", value,
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::tryParseUInt32( v ) ); },
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::parseUInt32( v ) ); } );
+				compareParse( "tryParseUInt64", value,
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::tryParseUInt64( v ) ); },
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::parseUInt64( v ) ); } );
+			}
+
+			static const char* decimalValues[] = { "0", "1.5", "-2.25", "1024", "", "1.5x", "abc" };
+			for( const char* value : decimalValues ) {
+				compareParse( "tryParseFloat", value,
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::tryParseFloat( v ) ); },
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::parseFloat( v ) ); } );
+				compareParse( "tryParseDouble", value,
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::tryParseDouble( v ) ); },
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::parseDouble( v ) ); } );
+			}
+
+			static const char* timestampValues[] = { "2024-03-15T12:34:56", "1999-12-31T23:59:59", "2023-13-01T00:00:00",
+				"", "2024-03-15 12:34:56", "2024-03-15T12:34", "2024-O3-15T12:34:56" };
+			for( const char* value : timestampValues ) {
+				compareParse( "tryParseTimestamp", value,
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::tryParseTimestamp( v ) ); },
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::parseTimestamp( v ) ); } );
+			}
+
+			static const char* uuidValues[] = { "0f8fad5b-d9cb-469f-a165-70867728950e", "", "0f8fad5b-d9cb-469f-a165-70867728950", "0f8fad5b+d9cb-469f-a165-70867728950e" };
+			for( const char* value : uuidValues ) {
+				compareParse( "tryParseUuid", value,
+					[]( const std::string& v ) { return( cflib::CFLibXmlUtil::tryParseUuid( v ) ); },
+					[]( const std::string& v ) {
+						if( v.empty() ) {
+							return( static_cast<cflib::CFLibUuid*>( NULL ) );
+						}
+						cflib::CFLibUuid* parsed = new cflib::CFLibUuid();
+						try {
+							cflib::CFLibXmlUtil::parseUuid( *parsed, v );
+						}
+						catch( ... ) {
+							delete parsed;
+							throw;
+						}
+						return( parsed );
+					} );
+			}
+
+			if( parseMismatches == 0 ) {
+				std::cout << "Success! tryParse methods agree with the parse methods on valid, empty and invalid content\n";
+			}
+			else {
+				anyTestsFailed = true;
+			}
+		}
+
+		// Values parse truncates are reported by tryParse as overflows or underflows
+		{
+			cflib::TCFLibResult<int16_t> overflowed = cflib::CFLibXmlUtil::tryParseInt16( "32768" );
+			cflib::TCFLibResult<int16_t> underflowed = cflib::CFLibXmlUtil::tryParseInt16( "-32769" );
+			cflib::TCFLibResult<uint32_t> uoverflowed = cflib::CFLibXmlUtil::tryParseUInt32( "4294967296" );
+			if( ( overflowed.getStatus().getStatusCode() != cflib::CFLibStatus::STATUS_OVERFLOW )
+				|| ( underflowed.getStatus().getStatusCode() != cflib::CFLibStatus::STATUS_UNDERFLOW )
+				|| ( uoverflowed.getStatus().getStatusCode() != cflib::CFLibStatus::STATUS_OVERFLOW ) )
+			{
+				anyTestsFailed = true;
+				std::cout << "Failed! Out of range integers reported statuses " << overflowed.getStatus().getStatusCode()
+					<< ", " << underflowed.getStatus().getStatusCode()
+					<< ", " << uoverflowed.getStatus().getStatusCode() << "\n";
+			}
+			else {
+				std::cout << "Success! Out of range integers are reported as overflows and underflows\n";
+			}
+		}
+
+		// CFLibStatus: the default is OK, copies keep the input they describe, and each code
+		// produces the exception it names.
+		{
+			cflib::CFLibStatus okStatus;
+			std::string fieldName( "Field" );
+			std::string fieldValue( "99999" );
+			cflib::CFLibStatus overflowStatus( cflib::CFLibStatus::STATUS_OVERFLOW, CLASS_NAME, S_ProcName, 1, fieldName, fieldValue, cflib::CFLibXmlUtil::S_EXPECTED_DIGITS );
+			overflowStatus.setBound( (int64_t)32767 );
+			fieldValue.assign( "clobbered" );
+			cflib::CFLibStatus copiedStatus( overflowStatus );
+			cflib::CFLibStatus assignedStatus;
+			assignedStatus = copiedStatus;
+			cflib::CFLibStatus nullStatus( cflib::CFLibStatus::STATUS_NULL, CLASS_NAME, S_ProcName, 2, fieldName, cflib::CFLibExceptionInfo::S_Empty, cflib::CFLibXmlUtil::S_EXPECTED_DIGITS );
+			cflib::CFLibStatus invalidStatus( cflib::CFLibStatus::STATUS_INVALID_ARGUMENT, CLASS_NAME, S_ProcName, 3, fieldName, "x1", cflib::CFLibXmlUtil::S_EXPECTED_DIGITS );
+
+			bool overflowThrown = false;
+			bool nullThrown = false;
+			bool invalidThrown = false;
+			try {
+				assignedStatus.throwException();
+			}
+			catch( cflib::CFLibArgumentOverflowException& ) {
+				overflowThrown = true;
+			}
+			try {
+				nullStatus.throwException();
+			}
+			catch( cflib::CFLibNullArgumentException& ) {
+				nullThrown = true;
+			}
+			try {
+				invalidStatus.throwException();
+			}
+			catch( cflib::CFLibInvalidArgumentException& ) {
+				invalidThrown = true;
+			}
+			cflib::CFLibRuntimeException* overflowExc = assignedStatus.newException();
+			std::string overflowWhat( ( overflowExc != NULL ) ? overflowExc->what() : "" );
+			delete overflowExc;
+
+			if( ! okStatus.isOk() || okStatus.isError() || ! okStatus.getMessage().empty() || ( okStatus.newException() != NULL ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! A default CFLibStatus is not OK\n";
+			}
+			else if( ! assignedStatus.isError() || ( assignedStatus.getArgValue() != "99999" ) || ( assignedStatus.getArgName() != "Field" ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! A copied CFLibStatus describes \"" << assignedStatus.getArgName() << "\" = \""
+					<< assignedStatus.getArgValue() << "\", should be \"Field\" = \"99999\"\n";
+			}
+			else if( ! overflowThrown || ! nullThrown || ! invalidThrown || ! nullStatus.isNull() || nullStatus.isError() ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! CFLibStatus::throwException() threw the wrong exception for overflow " << overflowThrown
+					<< ", null " << nullThrown << ", invalid " << invalidThrown << "\n";
+			}
+			else if( ( overflowWhat != assignedStatus.getMessage() ) || ( overflowWhat.find( "32767" ) == std::string::npos ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! CFLibStatus overflow message \"" << overflowWhat << "\" should name the bound 32767\n";
+			}
+			else {
+				std::cout << "Success! CFLibStatus copies its input and throws the exception each status names\n";
+			}
+		}
+
+		// TCFLibResult: values come back from getValue() and getValueOr(), and a result without
+		// one throws from getValue() but still yields the default from getValueOr().
+		{
+			cflib::TCFLibResult<int32_t> good( 17 );
+			cflib::TCFLibResult<int32_t> bad = cflib::CFLibXmlUtil::tryParseInt32( "seventeen" );
+			cflib::TCFLibResult<int32_t> empty = cflib::CFLibXmlUtil::tryParseInt32( "" );
+			cflib::TCFLibResult<int32_t> copied( good );
+			cflib::TCFLibResult<int32_t> assigned;
+			assigned = bad;
+			bool badThrew = false;
+			try {
+				(void)assigned.getValue();
+			}
+			catch( cflib::CFLibInvalidArgumentException& ) {
+				badThrew = true;
+			}
+			if( ! good.isOk() || ( good.getValue() != 17 ) || ( copied.getValue() != 17 ) || ( good.getValueOr( 3 ) != 17 ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! A successful TCFLibResult did not return its value 17\n";
+			}
+			else if( ! assigned.isError() || ! badThrew || ( assigned.getValueOr( 3 ) != 3 ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! A failed TCFLibResult should throw from getValue() and default from getValueOr()\n";
+			}
+			else if( ! empty.isNull() || empty.isError() || ( empty.getValueOr( 5 ) != 5 ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! A TCFLibResult for empty content should be null, not an error\n";
+			}
+			else {
+				std::cout << "Success! TCFLibResult reports values, nulls and errors\n";
+			}
+		}
+
+		// TCFLibUuidHashMap: growth, erase and reuse of deleted entries, operator[], copies and
+		// moves, and a copy that fails part way through leaving the map as it was.
+		{
+			const size_t keyCount = 200;
+			std::vector<cflib::CFLibUuid> keys;
+			for( size_t i = 0; i < keyCount; i ++ ) {
+				unsigned char raw[16];
+				for( size_t b = 0; b < 16; b ++ ) {
+					raw[b] = (unsigned char)( ( i * 37 ) + ( b * 101 ) + ( i >> 3 ) );
+				}
+				raw[0] = (unsigned char)i;
+				raw[1] = (unsigned char)( i >> 8 );
+				keys.push_back( cflib::CFLibUuid( raw ) );
+			}
+
+			auto holdsExactly = []( const cflib::TCFLibUuidHashMap<TestCopyable>& map, const std::vector<cflib::CFLibUuid>& allKeys, size_t step ) {
+				size_t expected = 0;
+				for( size_t i = 0; i < allKeys.size(); i ++ ) {
+					const TestCopyable* found = map.find( allKeys[i].data() );
+					if( ( i % step ) == 0 ) {
+						if( ( found == NULL ) || ( found->value != (int64_t)i ) ) {
+							return( false );
+						}
+						expected ++;
+					}
+					else if( found != NULL ) {
+						return( false );
+					}
+				}
+				return( map.size() == expected );
+			};
+
+			int64_t liveBefore = TestCopyable::liveCount;
+			bool mapOk = false;
+			{
+				cflib::TCFLibUuidHashMap<TestCopyable> map;
+				bool insertsOk = true;
+				for( size_t i = 0; i < keyCount; i ++ ) {
+					insertsOk = insertsOk && map.insert( keys[i].data(), TestCopyable( (int64_t)i ) ).second;
+				}
+				insertsOk = insertsOk && ! map.insert( keys[5].data(), TestCopyable( -1 ) ).second;
+				bool grownOk = insertsOk && holdsExactly( map, keys, 1 );
+
+				for( size_t i = 0; i < keyCount; i ++ ) {
+					if( ( i % 2 ) != 0 ) {
+						map.erase( keys[i].data() );
+					}
+				}
+				bool erasedOk = holdsExactly( map, keys, 2 ) && ! map.erase( keys[1].data() );
+
+				size_t capacityBefore = map.capacity();
+				for( size_t round = 0; round < 4; round ++ ) {
+					for( size_t i = 1; i < keyCount; i += 2 ) {
+						map[ keys[i].data() ].value = (int64_t)i;
+					}
+					for( size_t i = 1; i < keyCount; i += 2 ) {
+						map.erase( keys[i].data() );
+					}
+				}
+				bool reusedOk = holdsExactly( map, keys, 2 ) && ( map.capacity() == capacityBefore );
+
+				map[ keys[0].data() ].value = 0;
+				bool indexOk = ( map[ keys[3].data() ].value == 0 ) && ( map.size() == ( keyCount / 2 ) + 1 );
+				map.erase( keys[3].data() );
+
+				cflib::TCFLibUuidHashMap<TestCopyable> copied( map );
+				cflib::TCFLibUuidHashMap<TestCopyable> moved( std::move( copied ) );
+				cflib::TCFLibUuidHashMap<TestCopyable> assigned;
+				assigned = moved;
+				cflib::TCFLibUuidHashMap<TestCopyable> moveAssigned;
+				moveAssigned = std::move( assigned );
+				bool copiesOk = holdsExactly( moved, keys, 2 ) && holdsExactly( moveAssigned, keys, 2 )
+					&& copied.empty() && ( copied.find( keys[0].data() ) == NULL ) && assigned.empty();
+
+				// Fail the tenth copy of a copy construction, then of a growing insert
+				bool failedCopyOk = false;
+				TestCopyable::copiesBeforeFailure = 10;
+				try {
+					cflib::TCFLibUuidHashMap<TestCopyable> failedCopy( map );
+				}
+				catch( std::runtime_error& ) {
+					failedCopyOk = holdsExactly( map, keys, 2 );
+				}
+				cflib::TCFLibUuidHashMap<TestCopyable> small;
+				size_t smallCount = 0;
+				TestCopyable::copiesBeforeFailure = -1;
+				while( ( small.size() + 1 ) <= ( small.capacity() - ( small.capacity() / 8 ) ) || ( small.capacity() == 0 ) ) {
+					small.insert( keys[ smallCount * 2 ].data(), TestCopyable( (int64_t)( smallCount * 2 ) ) );
+					smallCount ++;
+				}
+				size_t smallCapacity = small.capacity();
+				bool failedGrowOk = false;
+				TestCopyable::copiesBeforeFailure = 10;
+				try {
+					small.insert( keys[ smallCount * 2 ].data(), TestCopyable( (int64_t)( smallCount * 2 ) ) );
+				}
+				catch( std::runtime_error& ) {
+					std::vector<cflib::CFLibUuid> smallKeys( keys.begin(), keys.begin() + ( smallCount * 2 ) );
+					failedGrowOk = holdsExactly( small, smallKeys, 2 ) && ( small.capacity() == smallCapacity );
+				}
+				TestCopyable::copiesBeforeFailure = -1;
+
+				if( ! grownOk || ! erasedOk ) {
+					anyTestsFailed = true;
+					std::cout << "Failed! TCFLibUuidHashMap lost or kept the wrong entries while growing or erasing\n";
+				}
+				else if( ! reusedOk || ! indexOk ) {
+					anyTestsFailed = true;
+					std::cout << "Failed! TCFLibUuidHashMap operator[] or reuse of erased entries went wrong, capacity "
+						<< map.capacity() << " was " << capacityBefore << "\n";
+				}
+				else if( ! copiesOk ) {
+					anyTestsFailed = true;
+					std::cout << "Failed! TCFLibUuidHashMap copies and moves do not hold the same entries\n";
+				}
+				else if( ! failedCopyOk ) {
+					anyTestsFailed = true;
+					std::cout << "Failed! A failed TCFLibUuidHashMap copy construction changed the map it copied\n";
+				}
+				else if( ! failedGrowOk ) {
+					anyTestsFailed = true;
+					std::cout << "Failed! A TCFLibUuidHashMap insert that failed while growing did not leave the map as it was\n";
+				}
+				else {
+					mapOk = true;
+				}
+			}
+			if( TestCopyable::liveCount != liveBefore ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! TCFLibUuidHashMap leaked or double destroyed " << ( TestCopyable::liveCount - liveBefore ) << " values\n";
+			}
+			else if( mapOk ) {
+				std::cout << "Success! TCFLibUuidHashMap grows, erases, copies and moves, and survives failed copies\n";
+			}
+		}
+
+		// TCFLibNullableColumn: push, null, sum, min and max on either side of a bitmap word
+		// boundary, for a bool column (stored as uint8_t) and an int32_t column.
+		{
+			int columnMismatches = 0;
+			auto checkColumn = [&columnMismatches]( const std::string& typeName, auto column, size_t rowCount, auto valueOf ) {
+				typedef typename decltype( column )::SumType SumType;
+				auto expectedMin = valueOf( 0 );
+				auto expectedMax = valueOf( 0 );
+				SumType expectedSum = 0;
+				size_t expectedCount = 0;
+				bool anyValue = false;
+				for( size_t row = 0; row < rowCount; row ++ ) {
+					if( ( row % 3 ) == 1 ) {
+						column.push_back_null();
+						continue;
+					}
+					auto value = valueOf( row );
+					column.push_back( value );
+					expectedSum += (SumType)value;
+					expectedCount ++;
+					if( ! anyValue || ( value < expectedMin ) ) {
+						expectedMin = value;
+					}
+					if( ! anyValue || ( value > expectedMax ) ) {
+						expectedMax = value;
+					}
+					anyValue = true;
+				}
+				auto foundMin = valueOf( 1 );
+				auto foundMax = valueOf( 1 );
+				bool hasMin = column.min( foundMin );
+				bool hasMax = column.max( foundMax );
+				bool nullsOk = true;
+				for( size_t row = 0; row < rowCount; row ++ ) {
+					nullsOk = nullsOk && ( column.isNull( row ) == ( ( row % 3 ) == 1 ) );
+					nullsOk = nullsOk && ( column.isNull( row ) || ( column.getValue( row ) == valueOf( row ) ) );
+				}
+				if( ( column.size() != rowCount ) || ( column.countNonNull() != expectedCount ) || ! nullsOk
+					|| ( column.sum() != expectedSum )
+					|| ! hasMin || ! hasMax || ( foundMin != expectedMin ) || ( foundMax != expectedMax ) )
+				{
+					columnMismatches ++;
+					std::cout << "Failed! TCFLibNullableColumn<" << typeName << "> of " << rowCount << " rows counted "
+						<< column.countNonNull() << " non-null rows summing to " << column.sum()
+						<< " from " << foundMin << " to " << foundMax << ", should be " << expectedCount
+						<< " summing to " << expectedSum << " from " << expectedMin << " to " << expectedMax << "\n";
+				}
+				for( size_t row = 0; row < rowCount; row ++ ) {
+					column.setNull( row );
+				}
+				if( column.min( foundMin ) || column.max( foundMax ) || ( column.sum() != 0 ) || ( column.countNonNull() != 0 ) ) {
+					columnMismatches ++;
+					std::cout << "Failed! An all null TCFLibNullableColumn<" << typeName << "> of " << rowCount << " rows still has values\n";
+				}
+			};
+
+			static const size_t rowCounts[] = { 63, 64, 65 };
+			for( size_t rowCount : rowCounts ) {
+				checkColumn( "bool", cflib::TCFLibNullableColumn<bool>(), rowCount,
+					[]( size_t row ) { return( ( row % 5 ) != 0 ); } );
+				checkColumn( "int32_t", cflib::TCFLibNullableColumn<int32_t>(), rowCount,
+					[]( size_t row ) { return( (int32_t)( ( row * 7919 ) % 1000 ) - 500 ); } );
+			}
+			if( columnMismatches == 0 ) {
+				std::cout << "Success! TCFLibNullableColumn push, null, sum, min and max agree at 63, 64 and 65 rows for bool and int32_t\n";
+			}
+			else {
+				anyTestsFailed = true;
+			}
+		}
+
+		// CFLib::getValue() caches parsed config files: a replaced file is only noticed once the
+		// stat recheck interval (one second) has passed, and only 64 files are kept, so the least
+		// recently used one is parsed afresh when it is next asked for.
+		{
+			std::string configPrefix( "/tmp/testcflib-" + std::to_string( getpid() ) + "-config" );
+			auto writeConfig = []( const std::string& fileName, const std::string& value ) {
+				std::string tempName( fileName + ".tmp" );
+				std::ofstream out( tempName );
+				out << "# test config\n";
+				out << "testTag=\"" << value << "\" trailing words\n";
+				out << "testTag=ignored\n";
+				out.close();
+				// Replace the file, as an editor or deployment would, giving it a new inode
+				rename( tempName.c_str(), fileName.c_str() );
+			};
+			auto readConfig = []( const std::string& fileName ) {
+				std::string value;
+				if( ! cflib::CFLib::getValue( fileName, "testTag", value ) ) {
+					value.assign( "(not found)" );
+				}
+				return( value );
+			};
+
+			std::string firstName( configPrefix + "-0.txt" );
+			writeConfig( firstName, "first" );
+			std::chrono::steady_clock::time_point firstRead = std::chrono::steady_clock::now();
+			std::string firstValue( readConfig( firstName ) );
+			writeConfig( firstName, "second" );
+			std::string throttledValue( readConfig( firstName ) );
+			bool throttleTimed = ( std::chrono::steady_clock::now() - firstRead ) < std::chrono::milliseconds( 900 );
+			std::this_thread::sleep_for( std::chrono::milliseconds( 1100 ) );
+			std::string replacedValue( readConfig( firstName ) );
+
+			// Read the first file, change it, then read 64 others to push it out of the cache
+			firstRead = std::chrono::steady_clock::now();
+			std::string beforeEvictValue( readConfig( firstName ) );
+			writeConfig( firstName, "third" );
+			std::vector<std::string> otherNames;
+			for( int i = 1; i <= 64; i ++ ) {
+				otherNames.push_back( configPrefix + "-" + std::to_string( i ) + ".txt" );
+				writeConfig( otherNames.back(), "other" + std::to_string( i ) );
+			}
+			bool othersOk = true;
+			for( int i = 1; i <= 64; i ++ ) {
+				othersOk = othersOk && ( readConfig( otherNames[i - 1] ) == "other" + std::to_string( i ) );
+			}
+			std::string evictedValue( readConfig( firstName ) );
+			bool evictTimed = ( std::chrono::steady_clock::now() - firstRead ) < std::chrono::milliseconds( 900 );
+
+			remove( firstName.c_str() );
+			std::this_thread::sleep_for( std::chrono::milliseconds( 1100 ) );
+			std::string removedValue( readConfig( firstName ) );
+			for( const std::string& otherName : otherNames ) {
+				remove( otherName.c_str() );
+			}
+
+			if( ( firstValue != "first" ) || ( replacedValue != "second" ) || ( removedValue != "(not found)" ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! CFLib::getValue() read \"" << firstValue << "\", then \"" << replacedValue
+					<< "\" after the file was replaced, then \"" << removedValue
+					<< "\" after it was removed, should be \"first\", \"second\", \"(not found)\"\n";
+			}
+			else if( throttleTimed && ( throttledValue != "first" ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! CFLib::getValue() read \"" << throttledValue
+					<< "\" from a file replaced within the stat recheck interval, should still be cached \"first\"\n";
+			}
+			else if( ! othersOk || ( beforeEvictValue != "second" ) || ( evictedValue != "third" ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! CFLib::getValue() read \"" << evictedValue
+					<< "\" from a file pushed out of its cache by 64 others, should be reparsed \"third\"\n";
+			}
+			else {
+				std::cout << "Success! CFLib::getValue() caches config files, notices replacements after the stat interval"
+					<< ( throttleTimed && evictTimed ? "" : " (timing checks skipped on a slow run)" )
+					<< ", and keeps at most 64 files\n";
+			}
+		}
+
+		// CFLibXmlCoreUtf8Transcoder: text delivered in chunks, split anywhere including between
+		// the halves of a surrogate pair, must transcode to the same UTF-8 as the whole text.
+		{
+			// A, U+00E9, U+20AC, U+1F600 as a surrogate pair, z, a lone low surrogate, q, and a
+			// high surrogate the text ends on
+			static const XMLCh utf16Text[] = { 'A', 0x00e9, 0x20ac, 0xd83d, 0xde00, 'z', 0xdc00, 'q', 0xd83d };
+			static const char expectedUtf8[] = "A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80z\xef\xbf\xbdq\xef\xbf\xbd";
+			const size_t textLength = sizeof( utf16Text ) / sizeof( utf16Text[0] );
+			cflib::CFLibXmlCoreUtf8Transcoder transcoder;
+			bool transcodedOk = true;
+			for( size_t chunkSize = 1; chunkSize <= textLength; chunkSize ++ ) {
+				std::string transcoded( "<" );
+				for( size_t offset = 0; offset < textLength; offset += chunkSize ) {
+					size_t length = ( offset + chunkSize <= textLength ) ? chunkSize : textLength - offset;
+					transcoder.append( transcoded, utf16Text + offset, length );
+				}
+				transcoder.reset( transcoded );
+				if( transcoded != std::string( "<" ) + expectedUtf8 ) {
+					transcodedOk = false;
+					anyTestsFailed = true;
+					std::cout << "Failed! CFLibXmlCoreUtf8Transcoder in chunks of " << chunkSize << " produced "
+						<< transcoded.length() << " bytes, should be " << sizeof( expectedUtf8 ) << "\n";
+				}
+			}
+			std::string untouched( "kept" );
+			transcoder.reset( untouched );
+			transcoder.append( untouched, NULL, 4 );
+			if( untouched != "kept" ) {
+				transcodedOk = false;
+				anyTestsFailed = true;
+				std::cout << "Failed! CFLibXmlCoreUtf8Transcoder changed text with nothing pending or to append\n";
+			}
+			if( transcodedOk ) {
+				std::cout << "Success! CFLibXmlCoreUtf8Transcoder gives the same UTF-8 however the text is chunked\n";
+			}
+		}
+
+		// CFLibAsyncFileMessageLog: messages from several threads are all written by close, each
+		// thread's in order, and with OVERFLOW_DROP every message is either written or counted.
+		{
+			std::string asyncLogName( "/tmp/testcflib-" + std::to_string( getpid() ) + "-async.log" );
+			const int threadCount = 4;
+			const int messagesPerThread = 2000;
+			remove( asyncLogName.c_str() );
+			{
+				cflib::CFLibAsyncFileMessageLog asyncLog( 64 );
+				asyncLog.openLogFile( asyncLogName );
+				std::vector<std::thread> producers;
+				for( int t = 0; t < threadCount; t ++ ) {
+					producers.push_back( std::thread( [&asyncLog, t, messagesPerThread]() {
+						for( int m = 0; m < messagesPerThread; m ++ ) {
+							asyncLog.message( "thread " + std::to_string( t ) + " message " + std::to_string( m ) );
+						}
+					} ) );
+				}
+				for( std::thread& producer : producers ) {
+					producer.join();
+				}
+				asyncLog.closeLogFile();
+			}
+			std::vector<int> nextMessage( threadCount, 0 );
+			bool orderOk = true;
+			{
+				std::ifstream in( asyncLogName );
+				std::string line;
+				while( std::getline( in, line ) ) {
+					int t = -1;
+					int m = -1;
+					std::string::size_type pos = line.find( "thread " );
+					if( ( pos == std::string::npos )
+						|| ( std::sscanf( line.c_str() + pos, "thread %d message %d", &t, &m ) != 2 )
+						|| ( t < 0 ) || ( t >= threadCount ) || ( m != nextMessage[t] ) )
+					{
+						orderOk = false;
+						break;
+					}
+					nextMessage[t] ++;
+				}
+			}
+			for( int t = 0; t < threadCount; t ++ ) {
+				orderOk = orderOk && ( nextMessage[t] == messagesPerThread );
+			}
+
+			remove( asyncLogName.c_str() );
+			uint64_t droppedCount = 0;
+			{
+				cflib::CFLibAsyncFileMessageLog droppingLog( 4, cflib::CFLibAsyncFileMessageLog::OVERFLOW_DROP );
+				droppingLog.openLogFile( asyncLogName );
+				for( int m = 0; m < messagesPerThread; m ++ ) {
+					droppingLog.message( "thread 0 message " + std::to_string( m ) );
+				}
+				droppingLog.flush();
+				droppedCount = droppingLog.getDroppedCount();
+			}
+			uint64_t writtenCount = 0;
+			{
+				std::ifstream in( asyncLogName );
+				std::string line;
+				while( std::getline( in, line ) ) {
+					writtenCount ++;
+				}
+			}
+			remove( asyncLogName.c_str() );
+
+			if( ! orderOk ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! CFLibAsyncFileMessageLog lost, duplicated or reordered messages from " << threadCount << " threads\n";
+			}
+			else if( ( writtenCount + droppedCount ) != (uint64_t)messagesPerThread ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! CFLibAsyncFileMessageLog with OVERFLOW_DROP wrote " << writtenCount << " and dropped "
+					<< droppedCount << " of " << messagesPerThread << " messages\n";
+			}
+			else {
+				std::cout << "Success! CFLibAsyncFileMessageLog wrote every message in order, and with OVERFLOW_DROP wrote "
+					<< writtenCount << " and counted " << droppedCount << " dropped\n";
+			}
+		}
+
+		// CFLibUuid: the constexpr parser (also checked by the static_asserts above) must read
+		// the same bytes as libuuid at run time, and toString() must match uuid_unparse_lower().
+		{
+			static const char* uuidTexts[] = { "0f8fad5b-d9cb-469f-a165-70867728950e",
+				"FFFFFFFF-FFFF-FFFF-FFFF-FFFFFFFFFFFF",
+				"00000000-0000-0000-0000-000000000000",
+				"123e4567-E89B-12d3-a456-426614174000" };
+			bool uuidOk = true;
+			for( const char* text : uuidTexts ) {
+				cflib::CFLibUuid parsed;
+				uuid_t expected;
+				char unparsed[ cflib::CFLibUuid::FORMATTED_LENGTH + 1 ];
+				uuid_parse( text, expected );
+				uuid_unparse_lower( expected, unparsed );
+				if( ! cflib::CFLibUuid::tryParse( text, parsed )
+					|| ( memcmp( parsed.data(), expected, sizeof( uuid_t ) ) != 0 )
+					|| ( parsed.toString() != unparsed )
+					|| ( cflib::CFLibUuid::parse( text ) != parsed ) )
+				{
+					uuidOk = false;
+					std::cout << "Failed! CFLibUuid parsed \"" << text << "\" as " << parsed.toString() << ", should be " << unparsed << "\n";
+				}
+			}
+			cflib::CFLibUuid unchanged = cflib::CFLibUuid::parse( uuidTexts[0] );
+			bool rejectedOk = ! cflib::CFLibUuid::tryParse( "0f8fad5b-d9cb-469f-a165-70867728950x", unchanged )
+				&& ( unchanged.toString() == uuidTexts[0] );
+			try {
+				cflib::CFLibUuid::parse( "not-a-uuid" );
+				rejectedOk = false;
+			}
+			catch( cflib::CFLibInvalidArgumentException& ) {
+			}
+			if( ! rejectedOk ) {
+				uuidOk = false;
+				std::cout << "Failed! CFLibUuid accepted malformed text or changed its target when rejecting it\n";
+			}
+			if( uuidOk ) {
+				std::cout << "Success! CFLibUuid parses at compile time and agrees with libuuid at run time\n";
+			}
+			else {
+				anyTestsFailed = true;
+			}
+		}
+
+		// Moving an owning vector or list hands over its elements without cloning or deleting
+		// any, moving into a non-empty one deletes the elements it held, and copying clones.
+		{
+			int64_t liveBefore = TestCloneable::liveCount.load();
+			std::TCFLibOwningVector<TestCloneable*> vectorSrc;
+			std::TCFLibOwningList<TestCloneable*> listSrc;
+			for( int64_t i = 0; i < 10; i ++ ) {
+				vectorSrc.push_back( ( i == 3 ) ? NULL : new TestCloneable( i ) );
+				listSrc.push_back( new TestCloneable( i + 100 ) );
+			}
+			TestCloneable* vectorFirst = vectorSrc[0];
+			TestCloneable* listFirst = listSrc.front();
+			int64_t liveFilled = TestCloneable::liveCount.load();
+
+			std::TCFLibOwningVector<TestCloneable*> vectorMoved( std::move( vectorSrc ) );
+			std::TCFLibOwningList<TestCloneable*> listMoved( std::move( listSrc ) );
+			bool movedOk = vectorSrc.empty() && listSrc.empty()
+				&& ( vectorMoved.size() == 10 ) && ( vectorMoved[0] == vectorFirst ) && ( vectorMoved[3] == NULL )
+				&& ( listMoved.size() == 10 ) && ( listMoved.front() == listFirst )
+				&& ( TestCloneable::liveCount.load() == liveFilled );
+
+			std::TCFLibOwningVector<TestCloneable*> vectorCopied;
+			vectorCopied = vectorMoved;
+			std::TCFLibOwningList<TestCloneable*> listCopied;
+			listCopied = listMoved;
+			bool copiedOk = ( vectorCopied.size() == 10 ) && ( vectorCopied[0] != vectorFirst ) && ( vectorCopied[0]->value == 0 )
+				&& ( vectorCopied[3] == NULL )
+				&& ( listCopied.size() == 10 ) && ( listCopied.front() != listFirst ) && ( listCopied.front()->value == 100 )
+				&& ( TestCloneable::liveCount.load() == liveBefore + ( 2 * ( liveFilled - liveBefore ) ) );
+
+			vectorCopied = std::move( vectorMoved );
+			listCopied = std::move( listMoved );
+			bool assignedOk = vectorMoved.empty() && listMoved.empty()
+				&& ( vectorCopied[0] == vectorFirst ) && ( listCopied.front() == listFirst )
+				&& ( TestCloneable::liveCount.load() == liveFilled );
+
+			if( ! movedOk || ! copiedOk || ! assignedOk ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! Owning container moves or copies went wrong: move " << movedOk << ", copy " << copiedOk
+					<< ", move assignment " << assignedOk << "\n";
+			}
+			else {
+				std::cout << "Success! Owning vectors and lists move without cloning and copy by cloning\n";
+			}
+		}
+
+		// TCFLibArenaVector: elements of every alignment up to std::max_align_t are aligned in
+		// small chunks and oversized ones, a throwing constructor leaves the vector unchanged,
+		// moves carry the elements over, and every element is destroyed exactly once.
+		{
+			int64_t liveBefore = TestArenaElt::liveCount;
+			bool arenaOk = true;
+			{
+				cflib::TCFLibArenaVector<TestArenaElt> arena( 256 );
+				for( int64_t i = 0; i < 200; i ++ ) {
+					switch( i % 4 ) {
+						case 0:
+							arena.emplace_back( i );
+							break;
+						case 1:
+							arena.emplace_back<TestArenaAligned>( i );
+							break;
+						case 2:
+							arena.emplace_back<TestArenaBig>( i );
+							break;
+						default:
+							arena.push_back_null();
+							break;
+					}
+				}
+				bool threw = false;
+				try {
+					arena.emplace_back<TestArenaAligned>( -1 );
+				}
+				catch( std::runtime_error& ) {
+					threw = true;
+				}
+				arenaOk = threw && ( arena.size() == 200 ) && ( TestArenaElt::liveCount == liveBefore + 150 );
+
+				cflib::TCFLibArenaVector<TestArenaElt> moved( std::move( arena ) );
+				cflib::TCFLibArenaVector<TestArenaElt> assigned;
+				assigned.emplace_back( 1000 );
+				assigned = std::move( moved );
+				arenaOk = arenaOk && arena.empty() && moved.empty() && ( assigned.size() == 200 )
+					&& ( TestArenaElt::liveCount == liveBefore + 150 );
+				for( size_t i = 0; arenaOk && ( i < assigned.size() ); i ++ ) {
+					TestArenaElt* elt = assigned[i];
+					if( ( i % 4 ) == 3 ) {
+						arenaOk = ( elt == NULL );
+					}
+					else {
+						arenaOk = ( elt != NULL ) && ( elt->value == (int64_t)i )
+							&& ( ( reinterpret_cast<uintptr_t>( elt ) % elt->alignment() ) == 0 );
+					}
+				}
+			}
+			if( ! arenaOk || ( TestArenaElt::liveCount != liveBefore ) ) {
+				anyTestsFailed = true;
+				std::cout << "Failed! TCFLibArenaVector misaligned, lost or failed to destroy elements, "
+					<< ( TestArenaElt::liveCount - liveBefore ) << " still live\n";
+			}
+			else {
+				std::cout << "Success! TCFLibArenaVector aligns, moves and destroys its elements\n";
+			}
+		}
+
+		// TCFLibNullable: set, null and copy through memcpy, the NaN packed floating point
+		// nullables, and the historical class name reported when a null value is read.
+		{
+			bool nullableOk = true;
+			cflib::CFLibNullableInt32 int32Value;
+			int32Value.setValue( -17 );
+			cflib::CFLibNullableInt32 int32Copy;
+			memcpy( (void*)&int32Copy, (const void*)&int32Value, sizeof( int32Copy ) );
+			nullableOk = ! int32Copy.isNull() && ( int32Copy.getValue() == -17 ) && ( *int32Copy.getReference() == -17 );
+			int32Value.setNull();
+			nullableOk = nullableOk && int32Value.isNull() && ( int32Value.getReference() == NULL ) && ! int32Copy.isNull();
+
+			std::string nullClassName;
+			try {
+				(void)int32Value.getValue();
+			}
+			catch( cflib::CFLibNullArgumentException& e ) {
+				nullClassName = e.getClassFieldName();
+			}
+			nullableOk = nullableOk && ( nullClassName == "CFLibNullableInt32" );
+
+			// A flagged double keeps a NaN as a value, a packed one treats it as null
+			cflib::CFLibNullableDouble flaggedNaN( std::numeric_limits<double>::quiet_NaN() );
+			cflib::CFLibPackedNullableDouble packedNaN( std::numeric_limits<double>::quiet_NaN() );
+			cflib::CFLibPackedNullableDouble packedValue( 2.5 );
+			nullableOk = nullableOk && ! flaggedNaN.isNull() && packedNaN.isNull()
+				&& ! packedValue.isNull() && ( packedValue.getValue() == 2.5 );
+			packedValue.setNull();
+			nullableOk = nullableOk && packedValue.isNull() && ( packedValue.getReference() == NULL );
+
+			cflib::CFLibNullableBool boolValue( false );
+			nullableOk = nullableOk && ! boolValue.isNull() && ( boolValue.getValue() == false );
+
+			if( nullableOk ) {
+				std::cout << "Success! TCFLibNullable sets, nulls and copies values, packs NaN nulls, and names its class\n";
+			}
+			else {
+				anyTestsFailed = true;
+				std::cout << "Failed! TCFLibNullable lost a value or null, or reported class \"" << nullClassName
+					<< "\" for a null CFLibNullableInt32\n";
+			}
+		}
 	}
 	CFLIB_EXCEPTION_CATCH_GOTO( report_test_failed )
 	goto cleanup_and_exit;